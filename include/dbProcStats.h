@@ -0,0 +1,133 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#ifndef INCdbProcStatsH
+#define INCdbProcStatsH
+
+#include "epicsTypes.h"
+#include "dbCoreAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file dbProcStats.h
+ * @brief Record processing time statistics
+ *
+ * Optional instrumentation of the IOC's processing, to help find records
+ * and device support that hold up the threads they run on.  While
+ * dbProcStatsEnable() has it on the time taken by the process() routine
+ * of each record is kept in a histogram for that record, the lateness of
+ * each periodic scan pass is kept for its scan rate, and the time callback
+ * requests wait in their queue is kept for each callback thread.
+ *
+ * The processing time of a record includes that of any records in the
+ * same lock set which it processes through links, but not the time an
+ * asynchronous record spends waiting for its completion.
+ *
+ * The histograms are read without locking when reported, so a report made
+ * while the IOC is busy may be slightly inconsistent.
+ */
+
+struct dbCommon;
+
+/** @brief Non-zero while the instrumentation is on.
+ *
+ * Read only, use dbProcStatsEnable() to change it.
+ */
+DBCORE_API extern int dbProcStatsActive;
+
+/** @brief Number of histogram buckets.
+ *
+ * Bucket 0 counts times below 1 microsecond, bucket i counts times from
+ * 2^(i-1) up to 2^i microseconds, and the last bucket also counts all
+ * longer times.
+ */
+#define DB_PROC_HIST_BUCKETS 24
+
+/** @brief A log-bucketed histogram of times. */
+typedef struct dbProcHist {
+    epicsUInt32 count;
+    epicsUInt64 sumNs;
+    epicsUInt64 maxNs;
+    epicsUInt32 bucket[DB_PROC_HIST_BUCKETS];
+} dbProcHist;
+
+/** @brief Add a time in nanoseconds to a histogram. */
+DBCORE_API void dbProcHistAdd(dbProcHist *phist, epicsUInt64 ns);
+
+/** @brief Add the counts of one histogram to another. */
+DBCORE_API void dbProcHistMerge(dbProcHist *pdst, const dbProcHist *psrc);
+
+/** @brief Time in nanoseconds below which a fraction of the counted times
+ * are, rounded up to the top of its bucket.
+ */
+DBCORE_API epicsUInt64 dbProcHistPercentile(const dbProcHist *phist,
+    double fraction);
+
+/** @brief Print a one line summary of a histogram in microseconds. */
+DBCORE_API void dbProcHistShow(const dbProcHist *phist);
+
+/** @brief Turn the instrumentation on or off.
+ *
+ * <em>Also provided as an IOC Shell command.</em>
+ *
+ * Turning it on allocates the statistics of every record which does not
+ * have them yet.  Turning it off keeps the statistics collected so far.
+ * May be called before or after iocInit().
+ *
+ * @param on Collect statistics if non-zero.
+ */
+DBCORE_API long dbProcStatsEnable(int on);
+
+/** @brief Allocate the statistics of a new record.
+ *
+ * Called by dbAllocRecord() for records created while the
+ * instrumentation is on.
+ */
+DBCORE_API void dbProcStatsInitRecord(struct dbCommon *precord);
+
+/** @brief Account the processing time of a record.
+ *
+ * Called by dbProcess() with the record locked.
+ */
+DBCORE_API void dbProcStatsAdd(struct dbCommon *precord, epicsUInt64 ns);
+
+/** @brief Copy the statistics of a record.
+ *
+ * Call with the record locked.
+ *
+ * @param precord The record.
+ * @param phist Receives the histogram of its processing times.
+ * @param plastNs Receives its last processing time, may be NULL.
+ * @return 0, or -1 if no statistics have been collected for the record.
+ */
+DBCORE_API long dbProcStatsGet(struct dbCommon *precord, dbProcHist *phist,
+    epicsUInt64 *plastNs);
+
+/** @brief Report the processing times of one record.
+ *
+ * <em>Also provided as an IOC Shell command.</em>
+ *
+ * @param pname Record name.
+ * @param reset Clear the statistics of the record afterwards if non-zero.
+ */
+DBCORE_API long dbProcStatsRecord(const char *pname, int reset);
+
+/** @brief Report the records with the longest processing times.
+ *
+ * <em>Also provided as an IOC Shell command.</em>
+ *
+ * @param count Number of records to list, 10 if zero.
+ * @param reset Clear the statistics of all records afterwards if non-zero.
+ */
+DBCORE_API long dbProcStats(int count, int reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCdbProcStatsH */
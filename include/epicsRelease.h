@@ -0,0 +1,27 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* epicsRelease.h */
+
+#ifndef INCepicsReleaseh
+#define INCepicsReleaseh
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "dbCoreAPI.h"
+DBCORE_API int coreRelease(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*INCepicsReleaseh*/
+
@@ -353,6 +353,98 @@ int epicsStdCall ca_create_channel (
     return ECA_NORMAL;
 }
 
+// extern "C"
+int epicsStdCall ca_create_channels (
+     unsigned count, const char * const * pNames, caCh * conn_func,
+     void * const * pUserPrivates, capri priority, chid * pChanIDs )
+{
+    if ( count == 0u ) {
+        return ECA_NORMAL;
+    }
+    if ( ! pNames ) {
+        return ECA_BADSTR;
+    }
+    if ( ! pChanIDs ) {
+        return ECA_BADCHID;
+    }
+
+    ca_client_context * pcac;
+    int caStatus = fetchClientContext ( & pcac );
+    if ( caStatus != ECA_NORMAL ) {
+        return caStatus;
+    }
+
+    {
+        CAFDHANDLER * pFunc = 0;
+        void * pArg = 0;
+        {
+            epicsGuard < epicsMutex >
+                guard ( pcac->mutex );
+            if ( pcac->fdRegFuncNeedsToBeCalled ) {
+                pFunc = pcac->fdRegFunc;
+                pArg = pcac->fdRegArg;
+                pcac->fdRegFuncNeedsToBeCalled = false;
+            }
+        }
+        if ( pFunc ) {
+            ( *pFunc ) ( pArg, pcac->sock, true );
+        }
+    }
+
+    // The lock is held for a chunk of channels at a time, so that their
+    // searches are packed together without keeping the other threads
+    // of the context waiting for the whole batch.
+    static const unsigned chunkSize = 256u;
+    for ( unsigned first = 0u; first < count; first += chunkSize ) {
+        const unsigned last =
+            count - first > chunkSize ? first + chunkSize : count;
+        epicsGuard < epicsMutex > guard ( pcac->mutex );
+        for ( unsigned i = first; i < last; i++ ) {
+            int status = ECA_NORMAL;
+            try {
+                void * puser = pUserPrivates ? pUserPrivates[i] : 0;
+                oldChannelNotify * pChanNotify =
+                    new ( pcac->oldChannelNotifyFreeList )
+                        oldChannelNotify ( guard, *pcac, pNames[i],
+                            conn_func, puser, priority );
+                pChanIDs[i] = pChanNotify;
+                pChanNotify->initiateConnect ( guard );
+            }
+            catch ( cacChannel::badString & ) {
+                status = ECA_BADSTR;
+            }
+            catch ( std::bad_alloc & ) {
+                status = ECA_ALLOCMEM;
+            }
+            catch ( cacChannel::badPriority & ) {
+                status = ECA_BADPRIORITY;
+            }
+            catch ( cacChannel::unsupportedByService & ) {
+                status = ECA_UNAVAILINSERV;
+            }
+            catch ( std :: exception & except ) {
+                epicsGuardRelease < epicsMutex > unguard ( guard );
+                pcac->printFormated (
+                    "ca_create_channels: "
+                    "unexpected exception was \"%s\"",
+                    except.what () );
+                status = ECA_INTERNAL;
+            }
+            catch ( ... ) {
+                status = ECA_INTERNAL;
+            }
+            if ( status != ECA_NORMAL ) {
+                pChanIDs[i] = 0;
+                if ( caStatus == ECA_NORMAL ) {
+                    caStatus = status;
+                }
+            }
+        }
+    }
+
+    return caStatus;
+}
+
 /*
  *  ca_clear_channel ()
  *
@@ -3290,6 +3290,43 @@ void verifyName (
     SEVCHK ( status, NULL );
 }
 
+void verifyBulkCreate ( const char * pName, unsigned interestLevel )
+{
+    enum { nChans = 100 };
+    const char * names[nChans + 1];
+    void * pvts[nChans + 1];
+    chid chans[nChans + 1];
+    unsigned i;
+    int status;
+
+    showProgressBegin ( "verifyBulkCreate", interestLevel );
+
+    for ( i = 0; i < nChans; i++ ) {
+        names[i] = pName;
+        pvts[i] = & chans[i];
+    }
+    /* a bad name fails without stopping the others */
+    names[nChans] = "";
+    pvts[nChans] = 0;
+
+    status = ca_create_channels ( nChans + 1, names, 0, pvts,
+        CA_PRIORITY_DEFAULT, chans );
+    verify ( status == ECA_BADSTR );
+    verify ( chans[nChans] == 0 );
+
+    status = ca_pend_io ( timeoutToPendIO );
+    SEVCHK ( status, NULL );
+
+    for ( i = 0; i < nChans; i++ ) {
+        verify ( ca_state ( chans[i] ) == cs_conn );
+        verify ( ca_puser ( chans[i] ) == & chans[i] );
+        status = ca_clear_channel ( chans[i] );
+        SEVCHK ( status, NULL );
+    }
+
+    showProgressEnd ( interestLevel );
+}
+
 void verifyContextRundownFlush ( const char * pName, unsigned interestLevel )
 {
     unsigned i;
@@ -3458,6 +3495,7 @@ int acctst ( const char * pName, unsigned interestLevel, unsigned channelCount,
     }
 
     verifyName ( pName, interestLevel );
+    verifyBulkCreate ( pName, interestLevel );
     verifyConnectWithDisconnectedChannels ( pName, interestLevel );
     grEnumTest ( chan, interestLevel );
     test_sync_groups ( chan, interestLevel );
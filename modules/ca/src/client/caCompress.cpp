@@ -0,0 +1,280 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Byte shuffle and LZ4 block codec, see caCompress.h
+ *
+ *  NOTES:
+ *
+ *  1) The LZ4 block format is a sequence of a token byte holding the
+ *  literal and match lengths, any extra literal length bytes, the
+ *  literals, a two byte little endian match offset and any extra match
+ *  length bytes. The last sequence has literals only. The last five
+ *  bytes are always literals, and no match starts in the last twelve.
+ *
+ *  2) The compressor is a single pass greedy one, which is fast rather
+ *  than thorough. The expander checks every length and offset, as its
+ *  input comes off the network.
+ */
+
+#include <string.h>
+
+#include "epicsTypes.h"
+
+#include "caCompress.h"
+
+static const unsigned lz4MinMatch = 4u;
+static const unsigned lz4LastLiterals = 5u;
+static const unsigned lz4MatchFromEnd = 12u;
+static const unsigned lz4MaxOffset = 0xffff;
+static const unsigned lz4HashLog = 13u;
+static const unsigned lz4HashBytes =
+    ( 1u << lz4HashLog ) * sizeof ( epicsUInt32 );
+
+static inline epicsUInt32 lz4Read32 ( const unsigned char * p )
+{
+    epicsUInt32 v;
+    memcpy ( & v, p, sizeof ( v ) );
+    return v;
+}
+
+static inline unsigned lz4Hash ( epicsUInt32 v )
+{
+    return ( v * 2654435761u ) >> ( 32u - lz4HashLog );
+}
+
+static inline unsigned char * lz4PutLength (
+    unsigned char * op, unsigned len )
+{
+    while ( len >= 255u ) {
+        *op++ = 255u;
+        len -= 255u;
+    }
+    *op++ = static_cast < unsigned char > ( len );
+    return op;
+}
+
+// a match length of zero writes the final literals only sequence
+static unsigned char * lz4PutSequence (
+    unsigned char * op, const unsigned char * opEnd,
+    const unsigned char * pLiterals, unsigned nLiterals,
+    unsigned offset, unsigned matchLength )
+{
+    size_t worstCase = 1u + nLiterals + nLiterals / 255u + 1u;
+    if ( matchLength ) {
+        worstCase += 2u + matchLength / 255u + 1u;
+    }
+    if ( worstCase > static_cast < size_t > ( opEnd - op ) ) {
+        return 0;
+    }
+
+    unsigned char * pToken = op++;
+    unsigned token = ( nLiterals < 15u ? nLiterals : 15u ) << 4u;
+    if ( nLiterals >= 15u ) {
+        op = lz4PutLength ( op, nLiterals - 15u );
+    }
+    memcpy ( op, pLiterals, nLiterals );
+    op += nLiterals;
+
+    if ( matchLength ) {
+        unsigned extra = matchLength - lz4MinMatch;
+        token |= extra < 15u ? extra : 15u;
+        *op++ = static_cast < unsigned char > ( offset );
+        *op++ = static_cast < unsigned char > ( offset >> 8u );
+        if ( extra >= 15u ) {
+            op = lz4PutLength ( op, extra - 15u );
+        }
+    }
+    *pToken = static_cast < unsigned char > ( token );
+    return op;
+}
+
+static unsigned lz4Compress ( const unsigned char * pSrc, unsigned srcSize,
+    unsigned char * pDest, unsigned destSize, epicsUInt32 * pTable )
+{
+    const unsigned char * const opEnd = pDest + destSize;
+    unsigned char * op = pDest;
+    unsigned anchor = 0u;
+
+    memset ( pTable, 0, lz4HashBytes );
+    if ( srcSize > lz4MatchFromEnd ) {
+        const unsigned ipLimit = srcSize - lz4MatchFromEnd;
+        const unsigned matchLimit = srcSize - lz4LastLiterals;
+        unsigned misses = 0u;
+        unsigned ip = 0u;
+        while ( ip < ipLimit ) {
+            epicsUInt32 sequence = lz4Read32 ( pSrc + ip );
+            unsigned hash = lz4Hash ( sequence );
+            unsigned ref = pTable[hash];
+            pTable[hash] = ip;
+            if ( ref >= ip || ip - ref > lz4MaxOffset ||
+                    lz4Read32 ( pSrc + ref ) != sequence ) {
+                // step further through data which does not compress
+                ip += 1u + ( misses++ >> 6u );
+                continue;
+            }
+            misses = 0u;
+            unsigned length = lz4MinMatch;
+            while ( ip + length < matchLimit &&
+                    pSrc[ref + length] == pSrc[ip + length] ) {
+                length++;
+            }
+            op = lz4PutSequence ( op, opEnd, pSrc + anchor, ip - anchor,
+                ip - ref, length );
+            if ( ! op ) {
+                return 0u;
+            }
+            ip += length;
+            anchor = ip;
+        }
+    }
+    op = lz4PutSequence ( op, opEnd, pSrc + anchor, srcSize - anchor, 0u, 0u );
+    if ( ! op ) {
+        return 0u;
+    }
+    return static_cast < unsigned > ( op - pDest );
+}
+
+// returns false if the length runs past the end of the input
+static inline bool lz4GetLength ( const unsigned char * & ip,
+    const unsigned char * ipEnd, size_t limit, size_t & length )
+{
+    unsigned byte;
+    do {
+        if ( ip >= ipEnd || length > limit ) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while ( byte == 255u );
+    return true;
+}
+
+static int lz4Expand ( const unsigned char * ip, unsigned srcSize,
+    unsigned char * pDest, unsigned destSize )
+{
+    const unsigned char * const ipEnd = ip + srcSize;
+    unsigned char * op = pDest;
+    unsigned char * const opEnd = pDest + destSize;
+
+    while ( ip < ipEnd ) {
+        unsigned token = *ip++;
+
+        size_t length = token >> 4u;
+        if ( length == 15u &&
+                ! lz4GetLength ( ip, ipEnd, destSize, length ) ) {
+            return -1;
+        }
+        if ( length > static_cast < size_t > ( ipEnd - ip ) ||
+                length > static_cast < size_t > ( opEnd - op ) ) {
+            return -1;
+        }
+        memcpy ( op, ip, length );
+        op += length;
+        ip += length;
+        if ( ip == ipEnd ) {
+            break;
+        }
+
+        if ( ipEnd - ip < 2 ) {
+            return -1;
+        }
+        size_t offset = ip[0] | ( ip[1] << 8u );
+        ip += 2;
+        if ( offset == 0u || offset > static_cast < size_t > ( op - pDest ) ) {
+            return -1;
+        }
+        length = token & 15u;
+        if ( length == 15u &&
+                ! lz4GetLength ( ip, ipEnd, destSize, length ) ) {
+            return -1;
+        }
+        length += lz4MinMatch;
+        if ( length > static_cast < size_t > ( opEnd - op ) ) {
+            return -1;
+        }
+        const unsigned char * pRef = op - offset;
+        if ( offset >= length ) {
+            memcpy ( op, pRef, length );
+            op += length;
+        }
+        else {
+            // overlapping copies repeat the last offset bytes
+            while ( length-- ) {
+                *op++ = *pRef++;
+            }
+        }
+    }
+    return op == opEnd ? 0 : -1;
+}
+
+static void caShuffle ( const unsigned char * pSrc, unsigned char * pDest,
+    unsigned size, unsigned elemSize )
+{
+    const unsigned nElem = size / elemSize;
+    for ( unsigned byte = 0u; byte < elemSize; byte++ ) {
+        const unsigned char * pIn = pSrc + byte;
+        unsigned char * pOut = pDest + byte * nElem;
+        for ( unsigned i = 0u; i < nElem; i++ ) {
+            pOut[i] = *pIn;
+            pIn += elemSize;
+        }
+    }
+    memcpy ( pDest + nElem * elemSize, pSrc + nElem * elemSize,
+        size - nElem * elemSize );
+}
+
+static void caUnshuffle ( const unsigned char * pSrc, unsigned char * pDest,
+    unsigned size, unsigned elemSize )
+{
+    const unsigned nElem = size / elemSize;
+    for ( unsigned byte = 0u; byte < elemSize; byte++ ) {
+        const unsigned char * pIn = pSrc + byte * nElem;
+        unsigned char * pOut = pDest + byte;
+        for ( unsigned i = 0u; i < nElem; i++ ) {
+            *pOut = pIn[i];
+            pOut += elemSize;
+        }
+    }
+    memcpy ( pDest + nElem * elemSize, pSrc + nElem * elemSize,
+        size - nElem * elemSize );
+}
+
+unsigned caCompressWorkSize ( unsigned srcSize )
+{
+    return lz4HashBytes + srcSize;
+}
+
+unsigned caCompress ( const void * pSrc, unsigned srcSize,
+    void * pDest, unsigned destSize, unsigned elemSize, void * pWork )
+{
+    const unsigned char * pIn = static_cast < const unsigned char * > ( pSrc );
+    epicsUInt32 * pTable = static_cast < epicsUInt32 * > ( pWork );
+    if ( elemSize > 1u ) {
+        unsigned char * pShuffled =
+            static_cast < unsigned char * > ( pWork ) + lz4HashBytes;
+        caShuffle ( pIn, pShuffled, srcSize, elemSize );
+        pIn = pShuffled;
+    }
+    return lz4Compress ( pIn, srcSize,
+        static_cast < unsigned char * > ( pDest ), destSize, pTable );
+}
+
+int caExpand ( const void * pSrc, unsigned srcSize,
+    void * pDest, unsigned destSize, unsigned elemSize, void * pWork )
+{
+    const unsigned char * pIn = static_cast < const unsigned char * > ( pSrc );
+    unsigned char * pOut = static_cast < unsigned char * > ( pDest );
+    if ( elemSize <= 1u ) {
+        return lz4Expand ( pIn, srcSize, pOut, destSize );
+    }
+    unsigned char * pShuffled = static_cast < unsigned char * > ( pWork );
+    if ( lz4Expand ( pIn, srcSize, pShuffled, destSize ) ) {
+        return -1;
+    }
+    caUnshuffle ( pShuffled, pOut, destSize, elemSize );
+    return 0;
+}
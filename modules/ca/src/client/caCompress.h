@@ -0,0 +1,51 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Compression of large CA array responses, see CA_PROTO_COMPRESSED.
+ *
+ *  The data are first byte shuffled, so that the first bytes of all
+ *  elements come first, then all of their second bytes and so on,
+ *  and then compressed in the LZ4 block format.
+ */
+
+#ifndef INC_caCompress_H
+#define INC_caCompress_H
+
+#include "libCaAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the codec carried in the m_available field of CA_PROTO_COMPRESSED */
+#define CA_COMPRESS_SHUFFLE_LZ4 1u
+
+/* bytes of work space needed by caCompress() for srcSize bytes */
+LIBCA_API unsigned caCompressWorkSize ( unsigned srcSize );
+
+/*
+ * Compress srcSize bytes of elemSize byte elements into at most destSize
+ * bytes.  Returns the compressed size, or zero if it would not fit.
+ */
+LIBCA_API unsigned caCompress (
+    const void *pSrc, unsigned srcSize, void *pDest, unsigned destSize,
+    unsigned elemSize, void *pWork );
+
+/*
+ * Expand the output of caCompress() into exactly destSize bytes, using
+ * destSize bytes of work space when elemSize is more than one.
+ * Returns zero, or -1 if the compressed data are not valid.
+ */
+LIBCA_API int caExpand (
+    const void *pSrc, unsigned srcSize, void *pDest, unsigned destSize,
+    unsigned elemSize, void *pWork );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef INC_caCompress_H */
@@ -56,16 +56,22 @@ extern "C" void caConnTestConnHandler ( struct connection_handler_args args )
     }
 }
 
-void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn )
+void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn,
+                  int bulkIn )
 {
     unsigned iteration = 0u;
     int status;
     unsigned i;
     chid *pChans;
+    const char **pNames;
 
     channelCount = channelCountIn;
 
     pChans = new chid [channelCount];
+    pNames = new const char * [channelCount];
+    for ( i = 0u; i < channelCount; i++ ) {
+        pNames[i] = pNameIn;
+    }
 
     while ( 1 ) {
         connCount = 0u;
@@ -79,13 +85,23 @@ void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn )
 
         printf ( "creating channels\n" );
 
-        for ( i = 0u; i < channelCount; i++ ) {
-            status = ca_search_and_connect ( pNameIn,
-                &pChans[i], caConnTestConnHandler, 0 );
+        epicsTime createBegin = epicsTime::getCurrent ();
+        if ( bulkIn ) {
+            status = ca_create_channels ( channelCount, pNames,
+                caConnTestConnHandler, 0, CA_PRIORITY_DEFAULT, pChans );
             SEVCHK ( status, "CA search problems" );
         }
+        else {
+            for ( i = 0u; i < channelCount; i++ ) {
+                status = ca_search_and_connect ( pNameIn,
+                    &pChans[i], caConnTestConnHandler, 0 );
+                SEVCHK ( status, "CA search problems" );
+            }
+        }
+        double createDelay = epicsTime::getCurrent () - createBegin;
 
-        printf ( "all channels were created\n" );
+        printf ( "all channels were created after %f sec ( %f sec per channel)\n",
+            createDelay, createDelay / channelCount );
 
         ca_pend_event ( delayIn );
 
@@ -106,4 +122,5 @@ void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn )
     }
 
     //delete [] pChans;
+    //delete [] pNames;
 }
@@ -9,6 +9,7 @@
 \*************************************************************************/
 
 #include <stdio.h>
+#include <string.h>
 #include <epicsStdlib.h>
 
 #include "caDiagnostics.h"
@@ -17,9 +18,10 @@ int main ( int argc, char **argv )
 {
     double delay = 60.0 * 5.0;
     unsigned count = 2000;
+    int bulk = 0;
 
-    if ( argc < 2 || argc > 4 ) {
-        printf ( "usage: %s < channel name > [ < count > ] [ < delay sec > ]\n", argv[0] );
+    if ( argc < 2 || argc > 5 ) {
+        printf ( "usage: %s < channel name > [ < count > ] [ < delay sec > ] [ bulk ]\n", argv[0] );
         return -1;
     }
 
@@ -39,7 +41,17 @@ int main ( int argc, char **argv )
         }
     }
 
-    caConnTest ( argv[1], count, delay );
+    if ( argc >= 5 ) {
+        if ( strcmp ( argv[4], "bulk" ) == 0 ) {
+            bulk = 1;
+        }
+        else {
+            printf ( "unknown creation mode \"%s\", creating channels one at a time\n",
+                argv[4] );
+        }
+    }
+
+    caConnTest ( argv[1], count, delay, bulk );
 
     return 0;
 }
@@ -31,7 +31,8 @@ int acctst ( const char *pname, unsigned logggingInterestLevel,
 }
 #endif
 
-void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn );
+void caConnTest ( const char *pNameIn, unsigned channelCountIn, double delayIn,
+                  int bulkIn );
 
 #endif /* ifndef INC_caDiagnostics_H */
 
@@ -17,13 +17,19 @@
 #include "epicsTime.h"
 #include "errlog.h"
 
+struct eventRateCounts {
+    unsigned events;
+    double bytes;
+};
+
 /*
  * event_handler()
  */
 extern "C" void eventCallBack ( struct event_handler_args args )
 {
-    unsigned *pCount = static_cast < unsigned * > ( args.usr );
-    (*pCount)++;
+    eventRateCounts *pCounts = static_cast < eventRateCounts * > ( args.usr );
+    pCounts->events++;
+    pCounts->bytes += dbr_size_n ( args.type, args.count );
 }
 
 /*
@@ -33,7 +39,7 @@ void caEventRate ( const char *pName, unsigned count )
 {
     static const double initialSamplePeriod = 1.0;
     static const double maxSamplePeriod = 60.0 * 5.0;
-    unsigned eventCount = 0u;
+    eventRateCounts counts = { 0u, 0.0 };
 
     chid * pChidTable = new chid [ count ];
 
@@ -64,8 +70,9 @@ void caEventRate ( const char *pName, unsigned count )
 
         epicsTime begin = epicsTime::getCurrent ();
         for ( unsigned i = 0u; i < count; i++ ) {
-            int addEventStatus = ca_add_event ( DBR_FLOAT,
-                pChidTable[i], eventCallBack, &eventCount, NULL);
+            // the whole array so that large array throughput is measured
+            int addEventStatus = ca_add_array_event ( DBR_FLOAT, 0,
+                pChidTable[i], eventCallBack, &counts, 0.0, 0.0, 0.0, NULL);
             SEVCHK ( addEventStatus, __FILE__ );
         }
 
@@ -83,7 +90,7 @@ void caEventRate ( const char *pName, unsigned count )
 
         // let the first one go by
         epicsTime begin = epicsTime::getCurrent ();
-        while ( eventCount < count ) {
+        while ( counts.events < count ) {
             int status = ca_pend_event ( 0.01 );
             if ( status != ECA_TIMEOUT ) {
                 SEVCHK ( status, NULL );
@@ -102,9 +109,11 @@ void caEventRate ( const char *pName, unsigned count )
         unsigned nEvents, lastEventCount, curEventCount;
 
         epicsTime beginPend = epicsTime::getCurrent ();
-        lastEventCount = eventCount;
+        lastEventCount = counts.events;
+        double lastBytes = counts.bytes;
         int status = ca_pend_event ( samplePeriod );
-        curEventCount = eventCount;
+        curEventCount = counts.events;
+        double curBytes = counts.bytes;
         epicsTime endPend = epicsTime::getCurrent ();
         if ( status != ECA_TIMEOUT ) {
             SEVCHK ( status, NULL );
@@ -128,8 +137,9 @@ void caEventRate ( const char *pName, unsigned count )
         double mean = X / N;
         double stdDev = sqrt ( XX / N - mean * mean );
 
-        printf ( "CA Event Rate (Hz): current %g mean %g std dev %g\n",
-            Hz, mean, stdDev );
+        printf ( "CA Event Rate (Hz): current %g mean %g std dev %g"
+            " data rate (MB/s): %g\n",
+            Hz, mean, stdDev, ( curBytes - lastBytes ) / period / 1e6 );
 
         if ( samplePeriod < maxSamplePeriod ) {
             samplePeriod += samplePeriod;
@@ -49,8 +49,10 @@
 #include "udpiiu.h"
 #include "bhe.h"
 #include "net_convert.h"
+#include "caCompress.h"
 #include "autoPtrFreeList.h"
 #include "noopiiu.h"
+#include "searchCache.h"
 
 static const char pVersionCAC[] =
     "@(#) " EPICS_VERSION_STRING
@@ -87,7 +89,8 @@ const cac::pProtoStubTCP cac::tcpJumpTableCAC [] =
     &cac::badTCPRespAction,
     &cac::badTCPRespAction,
     &cac::verifyAndDisconnectChan,
-    &cac::verifyAndDisconnectChan
+    &cac::verifyAndDisconnectChan,
+    &cac::compressedRespAction
 };
 
 // TCP exception dispatch table
@@ -120,7 +123,8 @@ const cac::pExcepProtoStubTCP cac::tcpExcepJumpTableCAC [] =
     &cac::defaultExcep,     // REPEATER_REGISTER
     &cac::defaultExcep,     // CA_PROTO_SIGNAL
     &cac::defaultExcep,     // CA_PROTO_CREATE_CH_FAIL
-    &cac::defaultExcep      // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep,     // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep      // CA_PROTO_COMPRESSED
 };
 
 //
@@ -140,12 +144,15 @@ cac::cac (
         lowestPriorityLevelAbove(epicsThreadGetPrioritySelf()) ) ),
     pUserName ( 0 ),
     pudpiiu ( 0 ),
+    pReactor ( 0 ),
+    pSearchCache ( 0 ),
     tcpSmallRecvBufFreeList ( 0 ),
     tcpLargeRecvBufFreeList ( 0 ),
     notify ( notifyIn ),
     initializingThreadsId ( epicsThreadGetIdSelf() ),
     initializingThreadsPriority ( epicsThreadGetPrioritySelf() ),
     maxRecvBytesTCP ( MAX_TCP ),
+    compressThreshold ( 0u ),
     maxContigFrames ( contiguousMsgCountWhichTriggersFlowControl ),
     beaconAnomalyCount ( 0u ),
     iiuExistenceCount ( 0u ),
@@ -247,6 +254,51 @@ cac::cac (
         throw;
     }
 
+    if ( envGetConfigParamPtr ( &EPICS_CA_IO_THREADS ) ) {
+        long nIOThreads;
+        long status = envGetLongConfigParam ( &EPICS_CA_IO_THREADS, &nIOThreads );
+        if ( status || nIOThreads < 0 ) {
+            errlogPrintf ( "cac: EPICS_CA_IO_THREADS was not a non-negative integer\n" );
+        }
+        else if ( nIOThreads > 0 ) {
+            try {
+                this->pReactor = tcpReactor::create ( *this, this->mutex,
+                    this->cbMutex, this->notify,
+                    static_cast < unsigned > ( nIOThreads ),
+                    this->initializingThreadsPriority );
+            }
+            catch ( std::exception & except ) {
+                errlogPrintf ( "cac: unable to create TCP I/O threads "
+                    "because \"%s\", using a thread pair per circuit\n",
+                    except.what () );
+            }
+        }
+    }
+
+    if ( envGetConfigParamPtr ( &EPICS_CA_COMPRESSION_THRESHOLD ) ) {
+        long threshold;
+        long status = envGetLongConfigParam (
+            &EPICS_CA_COMPRESSION_THRESHOLD, &threshold );
+        if ( status || threshold < 0 ) {
+            errlogPrintf ( "cac: EPICS_CA_COMPRESSION_THRESHOLD was not a non-negative integer\n" );
+        }
+        else {
+            this->compressThreshold = static_cast < unsigned > ( threshold );
+        }
+    }
+
+    if ( const char * pCacheFile =
+            envGetConfigParamPtr ( &EPICS_CA_SEARCH_CACHE ) ) {
+        try {
+            this->pSearchCache =
+                new searchCache ( pCacheFile );
+        }
+        catch ( std::exception & except ) {
+            errlogPrintf ( "cac: unable to load search cache \"%s\" "
+                "because \"%s\"\n", pCacheFile, except.what () );
+        }
+    }
+
     /*
      * load user configured tcp name server address list,
      * create virtual circuits, and add them to server table
@@ -328,6 +380,12 @@ cac::~cac ()
         delete this->pudpiiu;
     }
 
+    // all circuits are gone, so the I/O threads are idle
+    delete this->pReactor;
+
+    // saves the cache if it changed
+    delete this->pSearchCache;
+
     freeListCleanup ( this->tcpSmallRecvBufFreeList );
     if ( this->tcpLargeRecvBufFreeList ) {
         freeListCleanup ( this->tcpLargeRecvBufFreeList );
@@ -425,6 +483,12 @@ void cac::show (
         if ( this->pudpiiu ) {
             this->pudpiiu->show ( level - 2u );
         }
+        if ( this->pReactor ) {
+            this->pReactor->show ( level - 2u );
+        }
+        if ( this->pSearchCache ) {
+            this->pSearchCache->show ( level - 2u );
+        }
     }
 
     if ( level > 2u ) {
@@ -1149,6 +1213,11 @@ bool cac::createChannelRespAction (
         }
         bool wasExpected = iiu.connectNotify ( guard, *pChan );
         if ( wasExpected ) {
+            // only servers which create channels by name are cached
+            if ( this->pSearchCache && iiu.ca_v44_ok ( guard ) ) {
+                this->pSearchCache->update ( pChan->pName ( guard ),
+                    iiu.getNetworkAddress ( guard ) );
+            }
             pChan->connect ( hdr.m_dataType, hdr.m_count, sidTmp,
                 mgr.cbGuard, guard );
         }
@@ -1168,7 +1237,7 @@ bool cac::createChannelRespAction (
 }
 
 bool cac::verifyAndDisconnectChan (
-    callbackManager & mgr, tcpiiu &,
+    callbackManager & mgr, tcpiiu & iiu,
     const epicsTime &, const caHdrLargeArray & hdr, void * /* pMsgBody */ )
 {
     epicsGuard < epicsMutex > guard ( this->mutex );
@@ -1176,6 +1245,16 @@ bool cac::verifyAndDisconnectChan (
     if ( ! pChan ) {
         return true;
     }
+    // if the channel was sent to this server because of a stale
+    // search cache entry then quietly search for it instead
+    if ( hdr.m_cmmd == CA_PROTO_CREATE_CH_FAIL &&
+            ! pChan->connected ( guard ) &&
+            this->uncacheChannel ( guard, *pChan,
+                iiu.getNetworkAddress ( guard ) ) ) {
+        pChan->getPIIU(guard)->uninstallChan ( guard, *pChan );
+        this->pudpiiu->installUnresolvedChannel ( guard, *pChan );
+        return true;
+    }
     this->disconnectChannel ( mgr.cbGuard, guard, *pChan );
     return true;
 }
@@ -1203,6 +1282,76 @@ bool cac::badTCPRespAction ( callbackManager &, tcpiiu & iiu,
     return false;
 }
 
+static bool compressedRespCorrupt ( callbackManager & mgr, tcpiiu & iiu )
+{
+    iiu.printFormated ( mgr.cbGuard,
+        "CAC: server sent corrupt compressed response\n" );
+    return false;
+}
+
+//
+// The payload of a compressed response is a complete response
+// message in the wire format, which is expanded and then executed
+// as if it had been received instead.
+//
+bool cac::compressedRespAction ( callbackManager & mgr, tcpiiu & iiu,
+    const epicsTime & currentTime, const caHdrLargeArray & hdr, void * pMsgBdy )
+{
+    static const unsigned annexSize = 2 * sizeof ( ca_uint32_t );
+    const arrayElementCount msgSize = hdr.m_count;
+    if ( hdr.m_available != CA_COMPRESS_SHUFFLE_LZ4 ||
+            hdr.m_cid > hdr.m_postsize || msgSize < sizeof ( caHdr ) ||
+            ( msgSize & 0x7 ) ) {
+        return compressedRespCorrupt ( mgr, iiu );
+    }
+    if ( this->tcpLargeRecvBufFreeList && msgSize > this->maxRecvBytesTCP ) {
+        static bool once = false;
+        if ( ! once ) {
+            iiu.printFormated ( mgr.cbGuard,
+    "CAC: compressed response with size=%lu > EPICS_CA_MAX_ARRAY_BYTES ignored\n",
+                msgSize );
+            once = true;
+        }
+        return true;
+    }
+    char * pMsg = iiu.expansionBuffer ( msgSize );
+    if ( ! pMsg ) {
+        iiu.printFormated ( mgr.cbGuard,
+            "CAC: not enough memory to expand compressed response (ignored)\n" );
+        return true;
+    }
+    if ( caExpand ( pMsgBdy, hdr.m_cid, pMsg,
+            static_cast < unsigned > ( msgSize ), hdr.m_dataType,
+            pMsg + msgSize ) ) {
+        return compressedRespCorrupt ( mgr, iiu );
+    }
+
+    const caHdr * pRsp = reinterpret_cast < const caHdr * > ( pMsg );
+    caHdrLargeArray rsp;
+    rsp.m_cmmd = AlignedWireRef < const epicsUInt16 > ( pRsp->m_cmmd );
+    rsp.m_postsize = AlignedWireRef < const epicsUInt16 > ( pRsp->m_postsize );
+    rsp.m_dataType = AlignedWireRef < const epicsUInt16 > ( pRsp->m_dataType );
+    rsp.m_count = AlignedWireRef < const epicsUInt16 > ( pRsp->m_count );
+    rsp.m_cid = AlignedWireRef < const epicsUInt32 > ( pRsp->m_cid );
+    rsp.m_available = AlignedWireRef < const epicsUInt32 > ( pRsp->m_available );
+    arrayElementCount hdrSize = sizeof ( *pRsp );
+    if ( rsp.m_postsize == 0xffff && rsp.m_count == 0u ) {
+        if ( msgSize < hdrSize + annexSize ) {
+            return compressedRespCorrupt ( mgr, iiu );
+        }
+        const ca_uint32_t * pLW = reinterpret_cast < const ca_uint32_t * > ( pRsp + 1 );
+        rsp.m_postsize = AlignedWireRef < const epicsUInt32 > ( pLW[0] );
+        rsp.m_count = AlignedWireRef < const epicsUInt32 > ( pLW[1] );
+        hdrSize += annexSize;
+    }
+    // compressed responses are never nested
+    if ( rsp.m_cmmd == CA_PROTO_COMPRESSED ||
+            hdrSize + rsp.m_postsize != msgSize ) {
+        return compressedRespCorrupt ( mgr, iiu );
+    }
+    return this->executeResponse ( mgr, iiu, currentTime, rsp, pMsg + hdrSize );
+}
+
 bool cac::executeResponse ( callbackManager & mgr, tcpiiu & iiu,
     const epicsTime & currentTime, caHdrLargeArray & hdr, char * pMshBody )
 {
@@ -1217,6 +1366,46 @@ bool cac::executeResponse ( callbackManager & mgr, tcpiiu & iiu,
     return ( this->*pStub ) ( mgr, iiu, currentTime, hdr, pMshBody );
 }
 
+//
+// Returns the requester's storage that the payload of a read response
+// may be received directly into, and the number of payload bytes
+// preceding any padding, or NULL if the payload must be received
+// into the message body cache.
+//
+char * cac::responseBuffer ( epicsGuard < epicsMutex > & guard,
+    tcpiiu & iiu, const caHdrLargeArray & hdr, arrayElementCount & dataBytes )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    // the channel id field is abused for read notify
+    // status starting with CA V4.1, a failed read is
+    // never received in place
+    if ( hdr.m_cmmd != CA_PROTO_READ_NOTIFY ||
+            ! iiu.ca_v41_ok ( guard ) || hdr.m_cid != ECA_NORMAL ) {
+        return 0;
+    }
+    // responses larger than EPICS_CA_MAX_ARRAY_BYTES are
+    // still ignored when the size is not automatic
+    if ( this->tcpLargeRecvBufFreeList &&
+            hdr.m_postsize > this->maxRecvBytesTCP ) {
+        return 0;
+    }
+    baseNMIU * pmiu = this->ioTable.lookup ( hdr.m_available );
+    if ( ! pmiu ) {
+        return 0;
+    }
+    // the type and count are checked against the request here
+    void * pBuf = pmiu->responseBuffer ( guard, hdr.m_dataType, hdr.m_count );
+    if ( ! pBuf ) {
+        return 0;
+    }
+    dataBytes = dbr_size_n ( hdr.m_dataType, hdr.m_count );
+    if ( dataBytes > hdr.m_postsize ) {
+        return 0;
+    }
+    return static_cast < char * > ( pBuf );
+}
+
 void cac::selfTest (
     epicsGuard < epicsMutex > & guard ) const
 {
@@ -1296,9 +1485,44 @@ void cac::initiateConnect (
 {
     guard.assertIdenticalMutex ( this->mutex );
     assert ( this->pudpiiu );
+
+    // try the server which created the channel last time
+    // before searching for it
+    osiSockAddr addr;
+    if ( this->pSearchCache && ! this->cacShutdownInProgress &&
+            this->pSearchCache->lookup ( chan.pName ( guard ), addr ) ) {
+        caServerID servID ( addr.ia, chan.getPriority ( guard ) );
+        tcpiiu * pTCPIIU = this->serverTable.lookup ( servID );
+        // as for EPICS_CA_NAME_SERVERS, assume minor version 11
+        // until the server's version message arrives
+        bool newIIU = this->findOrCreateVirtCircuit (
+            guard, addr, chan.getPriority ( guard ), pTCPIIU, 11 );
+        if ( pTCPIIU && pTCPIIU->alive ( guard ) ) {
+            pTCPIIU->installChannel ( guard, chan, UINT_MAX, USHRT_MAX, 0u );
+            if ( newIIU ) {
+                pTCPIIU->start ( guard );
+            }
+            // searched for once all the same, so that any other
+            // server which has the channel is reported
+            this->pudpiiu->searchOnce ( guard, chan );
+            return;
+        }
+    }
+
     this->pudpiiu->installNewChannel ( guard, chan, piiu );
 }
 
+// returns true if the channel was cached at this server
+bool cac::uncacheChannel ( epicsGuard < epicsMutex > & guard,
+    nciu & chan, const osiSockAddr & addr )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( ! this->pSearchCache ) {
+        return false;
+    }
+    return this->pSearchCache->remove ( chan.pName ( guard ), addr );
+}
+
 void *cacComBufMemoryManager::allocate ( size_t size )
 {
     return this->freeList.allocate ( size );
@@ -117,6 +117,8 @@ public:
     void flush ( epicsGuard < epicsMutex > & guard );
     bool executeResponse ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, caHdrLargeArray &, char *pMsgBody );
+    char * responseBuffer ( epicsGuard < epicsMutex > &, tcpiiu &,
+        const caHdrLargeArray &, arrayElementCount & dataBytes );
 
     // channel routines
     void transferChanToVirtCircuit (
@@ -131,6 +133,8 @@ public:
         epicsGuard < epicsMutex > &, nciu & );
     void initiateConnect (
         epicsGuard < epicsMutex > &, nciu &, netiiu * & );
+    bool uncacheChannel (
+        epicsGuard < epicsMutex > &, nciu &, const osiSockAddr & );
     nciu * lookupChannel (
         epicsGuard < epicsMutex > &, const cacChannel::ioid & );
 
@@ -257,12 +261,15 @@ private:
     epicsTimerQueueActive & timerQueue;
     char * pUserName;
     class udpiiu * pudpiiu;
+    class tcpReactor * pReactor;
+    class searchCache * pSearchCache;
     void * tcpSmallRecvBufFreeList;
     void * tcpLargeRecvBufFreeList;
     cacContextNotify & notify;
     epicsThreadId initializingThreadsId;
     unsigned initializingThreadsPriority;
     unsigned maxRecvBytesTCP;
+    unsigned compressThreshold; // zero unless compression is requested
     unsigned maxContigFrames;
     unsigned beaconAnomalyCount;
     unsigned short _serverPort;
@@ -313,6 +320,8 @@ private:
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool verifyAndDisconnectChan ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
+    bool compressedRespAction ( callbackManager &, tcpiiu &,
+        const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool badTCPRespAction ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
 
@@ -85,6 +85,11 @@ public:
         epicsGuard < epicsMutex > &, int status,
         const char * pContext, unsigned type,
         arrayElementCount count ) = 0;
+    // storage which the response may be received directly into, or NULL
+    // if it must be passed to completion() from a library buffer
+    virtual void * responseBuffer (
+        epicsGuard < epicsMutex > &, unsigned type,
+        arrayElementCount count );
 };
 
 // 1) this should not be passing caerr.h status to the exception callback
@@ -26,3 +26,9 @@
 cacReadNotify::~cacReadNotify ()
 {
 }
+
+void * cacReadNotify::responseBuffer (
+    epicsGuard < epicsMutex > &, unsigned, arrayElementCount )
+{
+    return 0;
+}
@@ -217,6 +217,37 @@ LIBCA_API int epicsStdCall ca_create_channel
      chid           *pChanID
 );
 
+/*
+ * ca_create_channels ()
+ *
+ * Creates many channels at once. The context is locked once for each
+ * chunk of a few hundred channels rather than for every channel, so the
+ * search requests are packed into as few datagrams as possible and the
+ * channels sent to a server with an open circuit are requested in bursts.
+ *
+ * count                R   number of channels to create
+ * pChanNames           R   array of count channel name strings
+ * pConnStateCallback   R   address of connection state change
+ *                          callback function used for all of the channels
+ * pUserPrivates        R   array of count values for the user private
+ *                          fields, or NULL to set them all to NULL
+ * priority             R   priority level in the server 0 - 100
+ * pChanIDs             RW  array of count channel ids written here, the
+ *                          id is NULL if that channel could not be created
+ *
+ * returns ECA_NORMAL, the status of the first channel that failed,
+ * ECA_BADSTR if pChanNames is NULL, or ECA_BADCHID if pChanIDs is NULL
+ */
+LIBCA_API int epicsStdCall ca_create_channels
+(
+     unsigned           count,
+     const char * const *pChanNames,
+     caCh               *pConnStateCallback,
+     void * const       *pUserPrivates,
+     capri              priority,
+     chid               *pChanIDs
+);
+
 /*
  * ca_change_connection_event()
  *
@@ -97,6 +97,101 @@ inline epicsUInt32 dbr_htonl ( const epicsUInt32 & host )
     return tmp;
 }
 
+/*
+ * Array byte swapping.
+ *
+ * When the host is little endian with IEEE floats in the same word
+ * order, converting any numeric element between host and network
+ * format is a plain reversal of its bytes.  The loops below are
+ * written so that the compiler can vectorize them, and with gcc on
+ * x86 an AVX2 variant is also built and selected at run time when
+ * the CPU supports it.  The source and destination may be the same.
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+#   define CA_SWAP_ARRAYS
+#endif
+
+#ifdef CA_SWAP_ARRAYS
+
+#if defined ( __GNUC__ )
+#   define CA_SWAP_INLINE inline __attribute__ (( always_inline ))
+#else
+#   define CA_SWAP_INLINE inline
+#endif
+
+static CA_SWAP_INLINE epicsUInt16 caByteSwap ( epicsUInt16 v )
+{
+    return static_cast < epicsUInt16 > ( ( v << 8u ) | ( v >> 8u ) );
+}
+
+static CA_SWAP_INLINE epicsUInt32 caByteSwap ( epicsUInt32 v )
+{
+    return ( v << 24u ) | ( ( v & 0xff00u ) << 8u ) |
+        ( ( v >> 8u ) & 0xff00u ) | ( v >> 24u );
+}
+
+static CA_SWAP_INLINE epicsUInt64 caByteSwap ( epicsUInt64 v )
+{
+    return ( static_cast < epicsUInt64 > ( caByteSwap (
+            static_cast < epicsUInt32 > ( v ) ) ) << 32u ) |
+        caByteSwap ( static_cast < epicsUInt32 > ( v >> 32u ) );
+}
+
+/*
+ * memcpy() keeps the float and double buffers free of aliasing
+ * problems, and is compiled to plain (vector) loads and stores.
+ */
+template < class T >
+static CA_SWAP_INLINE void caSwapLoop (
+    const void * s, void * d, arrayElementCount num )
+{
+    const char * pSrc = static_cast < const char * > ( s );
+    char * pDest = static_cast < char * > ( d );
+
+    for ( arrayElementCount i = 0; i < num; i++ ) {
+        T v;
+        memcpy ( & v, pSrc + i * sizeof ( T ), sizeof ( T ) );
+        v = caByteSwap ( v );
+        memcpy ( pDest + i * sizeof ( T ), & v, sizeof ( T ) );
+    }
+}
+
+#if defined ( __GNUC__ ) && ! defined ( __clang__ ) && __GNUC__ >= 5 && \
+    ( defined ( __x86_64__ ) || defined ( __i386__ ) )
+#   define CA_SWAP_AVX2
+
+template < class T >
+__attribute__ (( target ( "avx2" ) ))
+static void caSwapLoopAVX2 (
+    const void * s, void * d, arrayElementCount num )
+{
+    caSwapLoop < T > ( s, d, num );
+}
+
+static bool caHaveAVX2 ()
+{
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ( "avx2" );
+}
+#endif
+
+template < class T >
+static void caSwapArray (
+    const void * s, void * d, arrayElementCount num )
+{
+#ifdef CA_SWAP_AVX2
+    static const bool avx2 = caHaveAVX2 ();
+    if ( avx2 ) {
+        caSwapLoopAVX2 < T > ( s, d, num );
+        return;
+    }
+#endif
+    caSwapLoop < T > ( s, d, num );
+}
+
+#endif /* CA_SWAP_ARRAYS */
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -134,6 +229,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    caSwapArray < epicsUInt16 > ( s, d, num );
+#else
     dbr_short_t         *pSrc = (dbr_short_t *) s;
     dbr_short_t         *pDest = (dbr_short_t *) d;
 
@@ -147,6 +245,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -184,6 +283,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    caSwapArray < epicsUInt32 > ( s, d, num );
+#else
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
@@ -197,6 +299,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohl( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -213,6 +316,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    caSwapArray < epicsUInt16 > ( s, d, num );
+#else
     dbr_enum_t          *pSrc = (dbr_enum_t *) s;
     dbr_enum_t          *pDest = (dbr_enum_t *) d;
 
@@ -226,6 +332,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs ( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -244,6 +351,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    caSwapArray < epicsUInt32 > ( s, d, num );
+#else
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
@@ -257,6 +367,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohf ( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /*
@@ -269,6 +380,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    caSwapArray < epicsUInt64 > ( s, d, num );
+#else
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
@@ -282,6 +396,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohd( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /****************************************************************************
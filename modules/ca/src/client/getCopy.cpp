@@ -60,8 +60,11 @@ void getCopy::completion (
     arrayElementCount countIn, const void *pDataIn )
 {
     if ( this->type == typeIn ) {
-        unsigned size = dbr_size_n ( typeIn, countIn );
-        memcpy ( this->pValue, pDataIn, size );
+        // unless the response was received in place
+        if ( pDataIn != this->pValue ) {
+            unsigned size = dbr_size_n ( typeIn, countIn );
+            memcpy ( this->pValue, pDataIn, size );
+        }
         this->cacCtx.decrementOutstandingIO ( guard, this->ioSeqNo );
         this->cacCtx.destroyGetCopy ( guard, *this );
         // this object destroyed by preceding function call
@@ -93,6 +96,16 @@ void getCopy::exception (
     }
 }
 
+void * getCopy::responseBuffer (
+    epicsGuard < epicsMutex > &, unsigned typeIn,
+    arrayElementCount countIn )
+{
+    if ( typeIn != this->type || countIn > this->count ) {
+        return 0;
+    }
+    return this->pValue;
+}
+
 void getCopy::show ( unsigned level ) const
 {
     int tmpType = static_cast <int> ( this->type );
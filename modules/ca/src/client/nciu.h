@@ -33,7 +33,7 @@
 
 #include "libCaAPI.h"
 
-#define CA_MINOR_PROTOCOL_REVISION 13
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 
 #include "cacIO.h"
@@ -114,6 +114,13 @@ class netSubscription * netReadNotifyIO::isSubscription ()
     return 0;
 }
 
+void * netReadNotifyIO::responseBuffer (
+    epicsGuard < epicsMutex > & guard, unsigned type,
+    arrayElementCount count )
+{
+    return this->notify.responseBuffer ( guard, type, count );
+}
+
 void netReadNotifyIO::forceSubscriptionUpdate (
     epicsGuard < epicsMutex > &, nciu & )
 {
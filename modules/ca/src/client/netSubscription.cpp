@@ -63,6 +63,13 @@ class netSubscription * netSubscription::isSubscription ()
     return this;
 }
 
+// subscription updates are passed to the callback from a library buffer
+void * netSubscription::responseBuffer (
+    epicsGuard < epicsMutex > &, unsigned, arrayElementCount )
+{
+    return 0;
+}
+
 void netSubscription::show ( unsigned /* level */ ) const
 {
     ::printf ( "event subscription IO at %p, type %s, element count %lu, mask %u\n",
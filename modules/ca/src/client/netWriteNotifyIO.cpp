@@ -112,6 +112,12 @@ class netSubscription * netWriteNotifyIO::isSubscription ()
     return 0;
 }
 
+void * netWriteNotifyIO::responseBuffer (
+    epicsGuard < epicsMutex > &, unsigned, arrayElementCount )
+{
+    return 0;
+}
+
 void netWriteNotifyIO::forceSubscriptionUpdate (
     epicsGuard < epicsMutex > &, nciu & )
 {
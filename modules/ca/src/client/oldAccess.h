@@ -197,6 +197,9 @@ private:
     void exception (
         epicsGuard < epicsMutex > &, int status,
         const char *pContext, unsigned type, arrayElementCount count );
+    void * responseBuffer (
+        epicsGuard < epicsMutex > &, unsigned type,
+        arrayElementCount count );
     getCopy ( const getCopy & );
     getCopy & operator = ( const getCopy & );
     void operator delete ( void * );
@@ -355,6 +358,9 @@ public:
     friend int epicsStdCall ca_create_channel (
         const char * name_str, caCh * conn_func, void * puser,
         capri priority, chid * chanptr );
+    friend int epicsStdCall ca_create_channels (
+        unsigned count, const char * const * pNames, caCh * conn_func,
+        void * const * pUserPrivates, capri priority, chid * pChanIDs );
     friend int epicsStdCall ca_clear_channel ( chid pChan );
     friend int epicsStdCall ca_array_get ( chtype type,
         arrayElementCount count, chid pChan, void * pValue );
@@ -0,0 +1,251 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Persistent channel name to server address cache, see searchCache.h
+ *
+ *  The file has one line per channel holding the name and the
+ *  address, as host:port, of the server which created it. It is
+ *  rewritten by a thread of its own, so that the file I/O never
+ *  delays the context's timers, at most once a minute while the
+ *  cache changes, and when the client context is destroyed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#ifdef _WIN32
+#   include <process.h>
+#   define getpid _getpid
+#endif
+
+#include "errlog.h"
+#include "epicsAtomic.h"
+#include "epicsStdio.h"
+#include "epicsString.h"
+#include "osiUnistd.h"
+
+#include "iocinf.h"
+#include "searchCache.h"
+
+// the shortest time between writes of the file
+static const double searchCacheSavePeriod = 60.0; // sec
+
+searchCacheEntry::searchCacheEntry ( const char * pName,
+        const osiSockAddr & addrIn ) :
+    stringId ( pName ), addr ( addrIn )
+{
+}
+
+searchCache::searchCache ( const char * pFileNameIn ) :
+    pFileName ( epicsStrDup ( pFileNameIn ) ),
+    thread ( *this, "CAC-search-cache",
+        epicsThreadGetStackSize ( epicsThreadStackSmall ),
+        epicsThreadPriorityLow ),
+    modified ( false ), exitCmd ( false )
+{
+    this->load ();
+    this->thread.start ();
+}
+
+searchCache::~searchCache ()
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        this->exitCmd = true;
+    }
+    this->saveEvent.signal ();
+    this->exitEvent.signal ();
+    this->thread.exitWait ();
+    this->save ();
+    tsSLList < searchCacheEntry > tmpList;
+    this->table.removeAll ( tmpList );
+    while ( searchCacheEntry * pEntry = tmpList.get () ) {
+        delete pEntry;
+    }
+    free ( this->pFileName );
+}
+
+void searchCache::load ()
+{
+    FILE * fp = fopen ( this->pFileName, "r" );
+    if ( ! fp ) {
+        // the file is created when the first channel is found
+        return;
+    }
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    char line[1024];
+    char name[1024];
+    char host[64];
+    while ( fgets ( line, sizeof ( line ), fp ) ) {
+        if ( line[0] == '#' ||
+                sscanf ( line, "%1023s %63s", name, host ) != 2 ) {
+            continue;
+        }
+        osiSockAddr addr;
+        memset ( & addr, 0, sizeof ( addr ) );
+        if ( aToIPAddr ( host, 0, & addr.ia ) < 0 ||
+                addr.ia.sin_port == 0 ) {
+            continue;
+        }
+        searchCacheEntry * pEntry =
+            new searchCacheEntry ( name, addr );
+        if ( this->table.add ( *pEntry ) < 0 ) {
+            delete pEntry;
+        }
+    }
+    fclose ( fp );
+}
+
+// writes the file if the cache changed since it was last written
+void searchCache::save ()
+{
+    // the entries are formatted under the lock, and written without it
+    std::string contents;
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( ! this->modified ) {
+            return;
+        }
+        this->modified = false;
+        contents = "# EPICS CA search cache, channel server\n";
+        resTableIter < searchCacheEntry, stringId > iter =
+            this->table.firstIter ();
+        while ( iter.valid () ) {
+            char host[64];
+            ipAddrToDottedIP ( & iter->addr.ia, host, sizeof ( host ) );
+            contents += iter->resourceName ();
+            contents += ' ';
+            contents += host;
+            contents += '\n';
+            iter++;
+        }
+    }
+
+    // written to a temporary file first so that a reader, or a crash,
+    // never sees a partial cache.  Its name is unique to this process
+    // and save, since other clients may be saving the same cache.
+    static int saveCount;
+    size_t tmpSize = strlen ( this->pFileName ) + 32u;
+    char * pTmpName = new char [ tmpSize ];
+    epicsSnprintf ( pTmpName, tmpSize, "%s.%ld.%d.tmp", this->pFileName,
+        static_cast < long > ( getpid () ),
+        epicsAtomicIncrIntT ( & saveCount ) );
+
+    FILE * fp = fopen ( pTmpName, "w" );
+    if ( ! fp ) {
+        errlogPrintf ( "CAC: unable to write search cache \"%s\"\n",
+            pTmpName );
+        delete [] pTmpName;
+        return;
+    }
+    bool ok = fwrite ( contents.data (), 1u, contents.size (), fp ) ==
+        contents.size ();
+    if ( fclose ( fp ) ) {
+        ok = false;
+    }
+    if ( ok ) {
+        if ( rename ( pTmpName, this->pFileName ) ) {
+            // rename will not replace an existing file on some targets
+            ::remove ( this->pFileName );
+            ok = rename ( pTmpName, this->pFileName ) == 0;
+        }
+    }
+    if ( ! ok ) {
+        errlogPrintf ( "CAC: unable to write search cache \"%s\"\n",
+            this->pFileName );
+        ::remove ( pTmpName );
+    }
+    delete [] pTmpName;
+}
+
+bool searchCache::lookup ( const char * pName, osiSockAddr & addr )
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    searchCacheEntry * pEntry = this->table.lookup (
+        stringId ( pName, stringId::refString ) );
+    if ( ! pEntry ) {
+        return false;
+    }
+    addr = pEntry->addr;
+    return true;
+}
+
+void searchCache::update ( const char * pName, const osiSockAddr & addr )
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    searchCacheEntry * pEntry = this->table.lookup (
+        stringId ( pName, stringId::refString ) );
+    if ( pEntry ) {
+        if ( sockAddrAreIdentical ( & pEntry->addr, & addr ) ) {
+            return;
+        }
+        pEntry->addr = addr;
+    }
+    else {
+        pEntry = new searchCacheEntry ( pName, addr );
+        if ( this->table.add ( *pEntry ) < 0 ) {
+            delete pEntry;
+            return;
+        }
+    }
+    this->changed ( guard );
+}
+
+bool searchCache::remove ( const char * pName, const osiSockAddr & addr )
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    stringId id ( pName, stringId::refString );
+    searchCacheEntry * pEntry = this->table.lookup ( id );
+    // it may have already been updated by a search
+    if ( ! pEntry || ! sockAddrAreIdentical ( & pEntry->addr, & addr ) ) {
+        return false;
+    }
+    this->table.remove ( id );
+    delete pEntry;
+    this->changed ( guard );
+    return true;
+}
+
+// wakes up the writer on the first change after the file was written
+void searchCache::changed ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( ! this->modified ) {
+        this->modified = true;
+        this->saveEvent.signal ();
+    }
+}
+
+void searchCache::run ()
+{
+    while ( true ) {
+        this->saveEvent.wait ();
+        {
+            epicsGuard < epicsMutex > guard ( this->mutex );
+            if ( this->exitCmd ) {
+                break;
+            }
+        }
+        this->save ();
+        // the changes made meanwhile are written together
+        this->exitEvent.wait ( searchCacheSavePeriod );
+    }
+}
+
+void searchCache::show ( unsigned level ) const
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    ::printf ( "search cache \"%s\" with %u channels%s\n", this->pFileName,
+        this->table.numEntriesInstalled (),
+        this->modified ? ", not yet saved" : "" );
+    if ( level > 1u ) {
+        this->table.show ( level - 2u );
+    }
+}
@@ -0,0 +1,64 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Persistent channel name to server address cache.
+ *
+ *  When EPICS_CA_SEARCH_CACHE names a file, the address of the server
+ *  which created each channel is remembered there. A new channel whose
+ *  name is in the cache asks the cached server for it directly over
+ *  TCP without waiting for a search reply, and is only searched for
+ *  in the usual way if that server does not have it.
+ */
+
+#ifndef INC_searchCache_H
+#define INC_searchCache_H
+
+#include "resourceLib.h"
+#include "tsSLList.h"
+#include "epicsMutex.h"
+#include "epicsGuard.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "osiSock.h"
+
+class searchCacheEntry : public tsSLNode < searchCacheEntry >, public stringId {
+public:
+    searchCacheEntry ( const char * pName, const osiSockAddr & );
+    osiSockAddr addr;
+private:
+    searchCacheEntry ( const searchCacheEntry & );
+    searchCacheEntry & operator = ( const searchCacheEntry & );
+};
+
+class searchCache : private epicsThreadRunable {
+public:
+    searchCache ( const char * pFileName );
+    ~searchCache ();
+    // returns false if the name is not in the cache
+    bool lookup ( const char * pName, osiSockAddr & addr );
+    void update ( const char * pName, const osiSockAddr & addr );
+    // returns false if the name is not cached at this address
+    bool remove ( const char * pName, const osiSockAddr & addr );
+    void show ( unsigned level ) const;
+private:
+    resTable < searchCacheEntry, stringId > table;
+    mutable epicsMutex mutex;
+    epicsEvent saveEvent;
+    epicsEvent exitEvent;
+    char * pFileName;
+    epicsThread thread;
+    bool modified;
+    bool exitCmd;
+    void load ();
+    void save ();
+    void changed ( epicsGuard < epicsMutex > & );
+    void run ();
+    searchCache ( const searchCache & );
+    searchCache & operator = ( const searchCache & );
+};
+
+#endif // ifndef INC_searchCache_H
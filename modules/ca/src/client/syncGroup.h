@@ -85,7 +85,9 @@ private:
     PRecycleFunc pRecycleFunc;
     CASG & sg;
     void * pValue;
+    arrayElementCount count;
     const unsigned magic;
+    unsigned type;
     cacChannel::ioid id;
     bool idIsValid;
     bool ioComplete;
@@ -100,6 +102,9 @@ private:
     void exception (
         epicsGuard < epicsMutex > &, int status,
         const char * pContext, unsigned type, arrayElementCount count );
+    void * responseBuffer (
+        epicsGuard < epicsMutex > &, unsigned type,
+        arrayElementCount count );
     syncGroupReadNotify ( const syncGroupReadNotify & );
     syncGroupReadNotify & operator = ( const syncGroupReadNotify & );
 };
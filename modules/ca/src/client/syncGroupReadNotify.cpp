@@ -29,8 +29,8 @@ syncGroupReadNotify::syncGroupReadNotify (
     CASG & sgIn, PRecycleFunc pRecycleFuncIn,
     chid pChan, void * pValueIn ) :
     chan ( pChan ), pRecycleFunc ( pRecycleFuncIn ),
-    sg ( sgIn ), pValue ( pValueIn ),
-    magic ( CASG_MAGIC ), id ( 0u ),
+    sg ( sgIn ), pValue ( pValueIn ), count ( 0u ),
+    magic ( CASG_MAGIC ), type ( 0u ), id ( 0u ),
     idIsValid ( false ), ioComplete ( false )
 {
 }
@@ -41,6 +41,8 @@ void syncGroupReadNotify::begin (
 {
     this->chan->eliminateExcessiveSendBacklog ( guard );
     this->ioComplete = false;
+    this->type = type;
+    this->count = count;
     boolFlagManager mgr ( this->idIsValid );
     this->chan->read ( guard, type, count, *this, &this->id );
     mgr.release ();
@@ -88,7 +90,8 @@ void syncGroupReadNotify::completion (
         return;
     }
 
-    if ( this->pValue ) {
+    // unless the response was received in place
+    if ( this->pValue && pData != this->pValue ) {
         size_t size = dbr_size_n ( type, count );
         memcpy ( this->pValue, pData, size );
     }
@@ -116,6 +119,17 @@ void syncGroupReadNotify::exception (
     //
 }
 
+void * syncGroupReadNotify::responseBuffer (
+    epicsGuard < epicsMutex > &, unsigned typeIn,
+    arrayElementCount countIn )
+{
+    if ( this->magic != CASG_MAGIC ||
+            typeIn != this->type || countIn > this->count ) {
+        return 0;
+    }
+    return this->pValue;
+}
+
 void syncGroupReadNotify::show (
     epicsGuard < epicsMutex > &, unsigned level ) const
 {
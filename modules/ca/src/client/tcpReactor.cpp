@@ -0,0 +1,831 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Multiplexed CA client TCP circuit service, see tcpReactor.h
+ *
+ *  All of the state below is protected by the cac mutex. The I/O
+ *  threads are the only ones which read from, write to, or change
+ *  the epoll registration of a circuit's socket, and the only ones
+ *  which detach a circuit. Each I/O thread has its own dispatch thread
+ *  which takes the callback lock to process the received buffers, and
+ *  destroy the detached circuits, of the circuits attached to it.
+ *  An I/O thread never takes the callback lock, so a user thread
+ *  holding it while waiting for a flush can not block the sends.
+ */
+
+#ifdef _MSC_VER
+#   pragma warning(disable:4355)
+#endif
+
+#include <stdexcept>
+#include <string>
+
+#include <string.h>
+#include <errno.h>
+
+#if defined(__linux__)
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  define CAC_HAVE_EPOLL
+#endif
+
+#include "errlog.h"
+
+#include "iocinf.h"
+#include "cac.h"
+#include "virtualCircuit.h"
+#include "tcpReactor.h"
+
+tcpReactorCircuit::tcpReactorCircuit ( tcpiiu & iiuIn ) :
+    ioNode ( *this ), dispatchNode ( *this ), iiu ( iiuIn ),
+    pIO ( 0 ), pSendBuf ( 0 ), events ( 0u ), interest ( 0u ),
+    phase ( rcIdle ), laborQueued ( false ), sendLabor ( false ),
+    recvBusy ( false ), recvDone ( false ), sendBlocked ( false ),
+    shutdownSent ( false )
+{
+}
+
+#ifdef CAC_HAVE_EPOLL
+
+// the longest time a clean shutdown may wait for the server to hang up
+static const double drainTimeout = 30.0;
+// how often draining circuits are checked (mS)
+static const int drainPollPeriod = 100;
+
+// runs the protocol stubs and user callbacks for one I/O thread
+class tcpReactorDispatch : private epicsThreadRunable {
+public:
+    tcpReactorDispatch ( tcpReactor &, unsigned priority );
+    void start ();
+    void stop ();
+    void dispatch ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+private:
+    tsDLList < tcpReactorNode > que;
+    epicsEvent event;
+    epicsThread thread;
+    tcpReactor & reactor;
+    bool exitRequested;
+
+    void run ();
+
+    tcpReactorDispatch ( const tcpReactorDispatch & );
+    tcpReactorDispatch & operator = ( const tcpReactorDispatch & );
+};
+
+class tcpReactorIO : private epicsThreadRunable {
+public:
+    tcpReactorIO ( tcpReactor &, unsigned ioPriority,
+        unsigned dispatchPriority );
+    ~tcpReactorIO ();
+    void start ();
+    void stop ();
+    void attach ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void labor ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    unsigned circuitCount ( epicsGuard < epicsMutex > & ) const;
+    void show ( unsigned level ) const;
+private:
+    tsDLList < tcpReactorNode > circuits;
+    tsDLList < tcpReactorCircuit > laborList;
+    tcpReactorDispatch dispatcher;
+    epicsThread thread;
+    tcpReactor & reactor;
+    int epfd;
+    int evfd;
+    unsigned nDraining;
+    bool wakeupPending;
+    bool exitRequested;
+
+    enum { maxEvents = 64 };
+
+    void run ();
+    void service ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void connect ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void receive ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void send ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    bool flush ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void drain ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void detach ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void rearm ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+
+    tcpReactorIO ( const tcpReactorIO & );
+    tcpReactorIO & operator = ( const tcpReactorIO & );
+};
+
+static void throwSocketError ( const char * pContext )
+{
+    char sockErrBuf[64];
+    epicsSocketConvertErrnoToString (
+        sockErrBuf, sizeof ( sockErrBuf ) );
+    std :: string reason = "CAC: ";
+    reason += pContext;
+    reason += " failed because \"";
+    reason += sockErrBuf;
+    reason += "\"";
+    throw std :: runtime_error ( reason );
+}
+
+tcpReactorIO::tcpReactorIO ( tcpReactor & reactorIn, unsigned ioPriority,
+        unsigned dispatchPriority ) :
+    dispatcher ( reactorIn, dispatchPriority ),
+    thread ( *this, "CAC-TCP-io",
+        epicsThreadGetStackSize ( epicsThreadStackMedium ), ioPriority ),
+    reactor ( reactorIn ), epfd ( -1 ), evfd ( -1 ), nDraining ( 0u ),
+    wakeupPending ( false ), exitRequested ( false )
+{
+    this->epfd = epoll_create1 ( EPOLL_CLOEXEC );
+    if ( this->epfd < 0 ) {
+        throwSocketError ( "epoll_create1()" );
+    }
+    this->evfd = eventfd ( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    if ( this->evfd < 0 ) {
+        close ( this->epfd );
+        throwSocketError ( "eventfd()" );
+    }
+    struct epoll_event ev;
+    memset ( & ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN;
+    ev.data.ptr = 0;
+    if ( epoll_ctl ( this->epfd, EPOLL_CTL_ADD, this->evfd, & ev ) ) {
+        close ( this->evfd );
+        close ( this->epfd );
+        throwSocketError ( "epoll_ctl()" );
+    }
+}
+
+tcpReactorIO::~tcpReactorIO ()
+{
+    this->stop ();
+    this->dispatcher.stop ();
+    close ( this->evfd );
+    close ( this->epfd );
+}
+
+void tcpReactorIO::start ()
+{
+    this->dispatcher.start ();
+    this->thread.start ();
+}
+
+void tcpReactorIO::stop ()
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+        this->exitRequested = true;
+        epicsUInt64 one = 1u;
+        if ( write ( this->evfd, & one, sizeof ( one ) ) < 0 ) {
+            // counter already saturated, the thread is awake
+        }
+    }
+    this->thread.exitWait ();
+}
+
+unsigned tcpReactorIO::circuitCount (
+    epicsGuard < epicsMutex > & guard ) const
+{
+    guard.assertIdenticalMutex ( this->reactor.mutex );
+    return this->circuits.count ();
+}
+
+void tcpReactorIO::attach (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    guard.assertIdenticalMutex ( this->reactor.mutex );
+    circ.pIO = this;
+    this->circuits.add ( circ.ioNode );
+    this->labor ( guard, circ );
+}
+
+void tcpReactorIO::labor (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    guard.assertIdenticalMutex ( this->reactor.mutex );
+    if ( circ.laborQueued || circ.phase == tcpReactorCircuit::rcDetached ) {
+        return;
+    }
+    circ.laborQueued = true;
+    this->laborList.add ( circ );
+    if ( ! this->wakeupPending ) {
+        this->wakeupPending = true;
+        epicsUInt64 one = 1u;
+        if ( write ( this->evfd, & one, sizeof ( one ) ) < 0 ) {
+            // counter already saturated, the thread is awake
+        }
+    }
+}
+
+void tcpReactorIO::run ()
+{
+    struct epoll_event events [ maxEvents ];
+
+    epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+    while ( ! this->exitRequested ) {
+        int timeout = this->nDraining ? drainPollPeriod : -1;
+        int nEvents;
+        {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            nEvents = epoll_wait ( this->epfd, events, maxEvents, timeout );
+        }
+        if ( nEvents < 0 ) {
+            if ( SOCKERRNO != SOCK_EINTR ) {
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ( "CAC: epoll_wait() failed because \"%s\"\n",
+                    sockErrBuf );
+                epicsGuardRelease < epicsMutex > unguard ( guard );
+                epicsThreadSleep ( 1.0 );
+            }
+            continue;
+        }
+
+        for ( int i = 0; i < nEvents; i++ ) {
+            tcpReactorCircuit * pCirc = static_cast < tcpReactorCircuit * >
+                ( events[i].data.ptr );
+            if ( pCirc ) {
+                pCirc->events |= events[i].events;
+                if ( ! pCirc->laborQueued ) {
+                    pCirc->laborQueued = true;
+                    this->laborList.add ( *pCirc );
+                }
+            }
+            else {
+                epicsUInt64 count;
+                if ( read ( this->evfd, & count, sizeof ( count ) ) < 0 ) {
+                    // spurious wakeup
+                }
+                this->wakeupPending = false;
+            }
+        }
+
+        // revisit the circuits waiting for a shutdown to complete
+        if ( this->nDraining ) {
+            tsDLIter < tcpReactorNode > iter = this->circuits.firstIter ();
+            while ( iter.valid () ) {
+                tcpReactorCircuit & circ = iter->circuit;
+                if ( circ.phase == tcpReactorCircuit::rcDraining &&
+                        ! circ.laborQueued ) {
+                    circ.laborQueued = true;
+                    this->laborList.add ( circ );
+                }
+                iter++;
+            }
+        }
+
+        // circuits queued while these are serviced wait for the next pass
+        tsDLList < tcpReactorCircuit > work;
+        this->laborList.removeAll ( work );
+        while ( tcpReactorCircuit * pCirc = work.get () ) {
+            pCirc->laborQueued = false;
+            try {
+                this->service ( guard, *pCirc );
+            }
+            catch ( std::exception & except ) {
+                errlogPrintf (
+                    "CAC: TCP I/O thread caught C++ exception \"%s\"\n",
+                    except.what () );
+                pCirc->iiu.initiateAbortShutdown ( guard );
+                this->labor ( guard, *pCirc );
+            }
+        }
+    }
+}
+
+void tcpReactorIO::service (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    if ( circ.phase == tcpReactorCircuit::rcIdle ||
+            circ.phase == tcpReactorCircuit::rcConnecting ) {
+        this->connect ( guard, circ );
+        if ( circ.phase != tcpReactorCircuit::rcRunning ) {
+            return;
+        }
+    }
+
+    unsigned events = circ.events;
+    circ.events = 0u;
+
+    if ( events & ( EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP ) ) {
+        if ( ! circ.recvBusy && ! circ.recvDone ) {
+            this->receive ( guard, circ );
+        }
+    }
+    if ( events & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) {
+        circ.sendBlocked = false;
+    }
+
+    if ( iiu.state == tcpiiu::iiucs_connected ) {
+        if ( circ.sendLabor && ! circ.sendBlocked ) {
+            circ.sendLabor = false;
+            this->send ( guard, circ );
+            if ( circ.sendBlocked ) {
+                // resume when the socket is writable
+                circ.sendLabor = true;
+            }
+        }
+    }
+
+    if ( iiu.state != tcpiiu::iiucs_connected ) {
+        this->drain ( guard, circ );
+    }
+
+    if ( circ.phase != tcpReactorCircuit::rcDetached ) {
+        this->rearm ( guard, circ );
+    }
+}
+
+void tcpReactorIO::connect (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    if ( iiu.state != tcpiiu::iiucs_connecting ) {
+        // aborted before the connect completed
+        this->detach ( guard, circ );
+        return;
+    }
+
+    int status = 0;
+    if ( circ.phase == tcpReactorCircuit::rcIdle ) {
+        int flags = fcntl ( iiu.sock, F_GETFL, 0 );
+        if ( flags < 0 ||
+                fcntl ( iiu.sock, F_SETFL, flags | O_NONBLOCK ) < 0 ) {
+            throwSocketError ( "fcntl(O_NONBLOCK)" );
+        }
+        struct epoll_event ev;
+        memset ( & ev, 0, sizeof ( ev ) );
+        ev.events = EPOLLOUT;
+        ev.data.ptr = & circ;
+        if ( epoll_ctl ( this->epfd, EPOLL_CTL_ADD, iiu.sock, & ev ) ) {
+            throwSocketError ( "epoll_ctl()" );
+        }
+        circ.interest = EPOLLOUT;
+        circ.phase = tcpReactorCircuit::rcConnecting;
+        osiSockAddr tmp = iiu.address ();
+        status = ::connect ( iiu.sock, & tmp.sa, sizeof ( tmp.sa ) );
+        if ( status < 0 ) {
+            status = SOCKERRNO;
+            if ( status == SOCK_EINPROGRESS || status == SOCK_EINTR ) {
+                return;
+            }
+        }
+    }
+    else {
+        if ( ! ( circ.events & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) ) {
+            return;
+        }
+        osiSocklen_t len = sizeof ( status );
+        if ( getsockopt ( iiu.sock, SOL_SOCKET, SO_ERROR,
+                ( char * ) & status, & len ) < 0 ) {
+            status = SOCKERRNO;
+        }
+    }
+
+    if ( status ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrorToString (
+            sockErrBuf, sizeof ( sockErrBuf ), status );
+        errlogPrintf ( "CAC: Unable to connect because \"%s\"\n",
+            sockErrBuf );
+        iiu.disconnectNotify ( guard );
+        this->detach ( guard, circ );
+        return;
+    }
+
+    // put the iiu into the connected state
+    iiu.state = tcpiiu::iiucs_connected;
+    iiu.recvDog.connectNotify ( guard );
+    circ.phase = tcpReactorCircuit::rcRunning;
+    circ.events = 0u;
+    // send the requests queued while connecting
+    circ.sendLabor = true;
+}
+
+void tcpReactorIO::receive (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    comBuf * pComBuf = new ( iiu.comBufMemMgr ) comBuf;
+    statusWireIO stat;
+    {
+        epicsGuardRelease < epicsMutex > unguard ( guard );
+        pComBuf->fillFromWire ( iiu, stat );
+    }
+
+    if ( ! iiu.validFillStatus ( guard, stat ) ) {
+        circ.recvDone = true;
+    }
+    else if ( stat.bytesCopied > 0u ) {
+        iiu.recvQue.pushLastComBufReceived ( *pComBuf );
+        iiu._receiveThreadIsBusy = true;
+        circ.recvBusy = true;
+        circ.recvTime = epicsTime::getCurrent ();
+        this->dispatcher.dispatch ( guard, circ );
+        return;
+    }
+    pComBuf->~comBuf ();
+    iiu.comBufMemMgr.release ( pComBuf );
+}
+
+void tcpReactorIO::send (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+    bool laborPending;
+    do {
+        laborPending = iiu.sendLabor ( guard );
+        if ( ! this->flush ( guard, circ ) ) {
+            break;
+        }
+    } while ( laborPending && iiu.state == tcpiiu::iiucs_connected );
+}
+
+// send as much as the socket will take, returns true when all was sent
+bool tcpReactorIO::flush (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    while ( true ) {
+        comBuf * pBuf = circ.pSendBuf;
+        if ( pBuf ) {
+            circ.pSendBuf = 0;
+        }
+        else {
+            pBuf = iiu.sendQue.popNextComBufToSend ();
+            if ( ! pBuf ) {
+                break;
+            }
+        }
+
+        unsigned bytesToBeSent = pBuf->occupiedBytes ();
+        bool success;
+        {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            success = pBuf->flushToWire ( iiu, epicsTime::getCurrent () );
+        }
+
+        if ( ! success ) {
+            if ( circ.sendBlocked ) {
+                // resume with this buffer when the socket is writable
+                circ.pSendBuf = pBuf;
+                return false;
+            }
+            pBuf->~comBuf ();
+            iiu.comBufMemMgr.release ( pBuf );
+            while ( ( pBuf = iiu.sendQue.popNextComBufToSend () ) ) {
+                pBuf->~comBuf ();
+                iiu.comBufMemMgr.release ( pBuf );
+            }
+            return false;
+        }
+        pBuf->~comBuf ();
+        iiu.comBufMemMgr.release ( pBuf );
+
+        iiu.unacknowledgedSendBytes += bytesToBeSent;
+        if ( iiu.unacknowledgedSendBytes >
+            iiu.socketLibrarySendBufferSize ) {
+            iiu.recvDog.sendBacklogProgressNotify ( guard );
+        }
+    }
+
+    iiu.earlyFlush = false;
+    if ( iiu.blockingForFlush ) {
+        iiu.flushBlockEvent.signal ();
+    }
+    return true;
+}
+
+/*
+ * The equivalent of the end of tcpSendThread::run(), without blocking
+ */
+void tcpReactorIO::drain (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    if ( circ.phase == tcpReactorCircuit::rcRunning ) {
+        circ.phase = tcpReactorCircuit::rcDraining;
+        circ.drainBegin = epicsTime::getCurrent ();
+        this->nDraining++;
+    }
+
+    if ( iiu.state == tcpiiu::iiucs_clean_shutdown &&
+            ! circ.shutdownSent && ! circ.sendBlocked ) {
+        if ( ! this->flush ( guard, circ ) && circ.sendBlocked ) {
+            return;
+        }
+        circ.shutdownSent = true;
+        // this should cause the server to disconnect from
+        // the client
+        int status = ::shutdown ( iiu.sock, SHUT_WR );
+        if ( status ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ("CAC TCP clean socket shutdown " ERL_ERROR " was %s\n",
+                sockErrBuf );
+        }
+    }
+
+    if ( ! circ.recvDone || circ.recvBusy ) {
+        if ( epicsTime::getCurrent () - circ.drainBegin > drainTimeout ) {
+            iiu.initiateAbortShutdown ( guard );
+        }
+        return;
+    }
+
+    // user threads blocking for send backlog to be reduced
+    // will abort their attempt to get space if the state
+    // of the tcpiiu changes from connected to a disconnecting
+    // state, we check again on the next pass until they are gone
+    if ( iiu.blockingForFlush ) {
+        return;
+    }
+
+    this->detach ( guard, circ );
+}
+
+void tcpReactorIO::detach (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    tcpiiu & iiu = circ.iiu;
+
+    if ( circ.interest ) {
+        struct epoll_event ev;
+        memset ( & ev, 0, sizeof ( ev ) );
+        epoll_ctl ( this->epfd, EPOLL_CTL_DEL, iiu.sock, & ev );
+    }
+    if ( circ.phase == tcpReactorCircuit::rcDraining ) {
+        this->nDraining--;
+    }
+    if ( circ.laborQueued ) {
+        this->laborList.remove ( circ );
+        circ.laborQueued = false;
+    }
+    if ( circ.pSendBuf ) {
+        circ.pSendBuf->~comBuf ();
+        iiu.comBufMemMgr.release ( circ.pSendBuf );
+        circ.pSendBuf = 0;
+    }
+    this->circuits.remove ( circ.ioNode );
+    circ.phase = tcpReactorCircuit::rcDetached;
+    circ.interest = 0u;
+    this->dispatcher.dispatch ( guard, circ );
+}
+
+void tcpReactorIO::rearm (
+    epicsGuard < epicsMutex > &, tcpReactorCircuit & circ )
+{
+    unsigned interest = 0u;
+    if ( circ.phase == tcpReactorCircuit::rcConnecting || circ.sendBlocked ) {
+        interest |= EPOLLOUT;
+    }
+    if ( ( circ.phase == tcpReactorCircuit::rcRunning ||
+            circ.phase == tcpReactorCircuit::rcDraining ) &&
+            ! circ.recvBusy && ! circ.recvDone ) {
+        interest |= EPOLLIN | EPOLLRDHUP;
+    }
+    if ( interest != circ.interest ) {
+        // EPOLLHUP and EPOLLERR are reported even when they were not
+        // requested, so a socket is only registered while it is of
+        // interest
+        int op = EPOLL_CTL_MOD;
+        if ( ! interest ) {
+            op = EPOLL_CTL_DEL;
+        }
+        else if ( ! circ.interest ) {
+            op = EPOLL_CTL_ADD;
+        }
+        struct epoll_event ev;
+        memset ( & ev, 0, sizeof ( ev ) );
+        ev.events = interest;
+        ev.data.ptr = & circ;
+        if ( epoll_ctl ( this->epfd, op, circ.iiu.sock, & ev ) ) {
+            throwSocketError ( "epoll_ctl()" );
+        }
+        circ.interest = interest;
+    }
+}
+
+void tcpReactorIO::show ( unsigned level ) const
+{
+    epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+    ::printf ( "\tI/O thread with %u circuits, %u draining\n",
+        this->circuits.count (), this->nDraining );
+    if ( level > 1u ) {
+        tsDLIterConst < tcpReactorNode > iter = this->circuits.firstIter ();
+        while ( iter.valid () ) {
+            const tcpReactorCircuit & circ = iter->circuit;
+            ::printf ( "\t\tcircuit %p phase %u interest 0x%x%s%s%s\n",
+                static_cast < const void * > ( & circ.iiu ),
+                circ.phase, circ.interest,
+                circ.recvBusy ? " dispatching" : "",
+                circ.sendLabor ? " send pending" : "",
+                circ.sendBlocked ? " send blocked" : "" );
+            iter++;
+        }
+    }
+}
+
+tcpReactor * tcpReactor::create ( cac & cacIn, epicsMutex & mutexIn,
+    epicsMutex & cbMutexIn, cacContextNotify & ctxNotifyIn,
+    unsigned nThreads, unsigned priority )
+{
+    return new tcpReactor ( cacIn, mutexIn, cbMutexIn, ctxNotifyIn,
+        nThreads, priority );
+}
+
+tcpReactor::tcpReactor ( cac & cacIn, epicsMutex & mutexIn,
+        epicsMutex & cbMutexIn, cacContextNotify & ctxNotifyIn,
+        unsigned nThreads, unsigned priority ) :
+    cacRef ( cacIn ), mutex ( mutexIn ), cbMutex ( cbMutexIn ),
+    ctxNotify ( ctxNotifyIn ), pIO ( 0 ), nIO ( 0u )
+{
+    this->pIO = new tcpReactorIO * [ nThreads ];
+    try {
+        while ( this->nIO < nThreads ) {
+            // the send threads run at a higher priority than the
+            // receive threads, the I/O threads do both
+            this->pIO[this->nIO] = new tcpReactorIO ( *this,
+                cac::lowestPriorityLevelAbove ( priority ),
+                cac::highestPriorityLevelBelow ( priority ) );
+            this->nIO++;
+        }
+    }
+    catch ( ... ) {
+        while ( this->nIO > 0u ) {
+            delete this->pIO[--this->nIO];
+        }
+        delete [] this->pIO;
+        throw;
+    }
+    for ( unsigned i = 0u; i < this->nIO; i++ ) {
+        this->pIO[i]->start ();
+    }
+}
+
+tcpReactor::~tcpReactor ()
+{
+    // all circuits have been destroyed by now
+    for ( unsigned i = 0u; i < this->nIO; i++ ) {
+        delete this->pIO[i];
+    }
+    delete [] this->pIO;
+}
+
+void tcpReactor::attach (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    tcpReactorIO * pLeast = this->pIO[0];
+    for ( unsigned i = 1u; i < this->nIO; i++ ) {
+        if ( this->pIO[i]->circuitCount ( guard ) <
+                pLeast->circuitCount ( guard ) ) {
+            pLeast = this->pIO[i];
+        }
+    }
+    pLeast->attach ( guard, circ );
+}
+
+void tcpReactor::labor (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    circ.sendLabor = true;
+    if ( circ.pIO ) {
+        circ.pIO->labor ( guard, circ );
+    }
+}
+
+tcpReactorDispatch::tcpReactorDispatch (
+        tcpReactor & reactorIn, unsigned priority ) :
+    thread ( *this, "CAC-TCP-dispatch",
+        epicsThreadGetStackSize ( epicsThreadStackBig ), priority ),
+    reactor ( reactorIn ), exitRequested ( false )
+{
+}
+
+void tcpReactorDispatch::start ()
+{
+    this->thread.start ();
+}
+
+void tcpReactorDispatch::stop ()
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+        this->exitRequested = true;
+    }
+    this->event.signal ();
+    this->thread.exitWait ();
+}
+
+void tcpReactorDispatch::dispatch (
+    epicsGuard < epicsMutex > & guard, tcpReactorCircuit & circ )
+{
+    guard.assertIdenticalMutex ( this->reactor.mutex );
+    this->que.add ( circ.dispatchNode );
+    this->event.signal ();
+}
+
+void tcpReactorDispatch::run ()
+{
+    epicsThreadPrivateSet ( caClientCallbackThreadId, this );
+    this->reactor.cacRef.attachToClientCtx ();
+
+    while ( true ) {
+        tcpReactorNode * pNode;
+        {
+            epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+            while ( ! ( pNode = this->que.get () ) ) {
+                if ( this->exitRequested ) {
+                    return;
+                }
+                epicsGuardRelease < epicsMutex > unguard ( guard );
+                this->event.wait ();
+            }
+        }
+        tcpReactorCircuit & circ = pNode->circuit;
+        tcpiiu & iiu = circ.iiu;
+
+        if ( circ.phase == tcpReactorCircuit::rcDetached ) {
+            iiu.sendDog.cancel ();
+            iiu.recvDog.shutdown ();
+            this->reactor.cacRef.destroyIIU ( iiu );
+            continue;
+        }
+
+        bool protocolOK = false;
+        bool sendWakeupNeeded = false;
+        try {
+            protocolOK = iiu.processReceived ( this->reactor.ctxNotify,
+                circ.recvTime, sendWakeupNeeded );
+            if ( protocolOK && iiu.recvFlowControl () ) {
+                sendWakeupNeeded = true;
+            }
+        }
+        catch ( std::bad_alloc & ) {
+            errlogPrintf (
+                "CA client library tcp dispatch thread "
+                "disconnecting due to no space in pool "
+                "C++ exception\n" );
+            epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+            iiu.initiateCleanShutdown ( guard );
+        }
+        catch ( std::exception & except ) {
+            errlogPrintf (
+                "CA client library tcp dispatch thread "
+                "disconnecting due to C++ exception \"%s\"\n",
+                except.what () );
+            epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+            iiu.initiateCleanShutdown ( guard );
+        }
+
+        epicsGuard < epicsMutex > guard ( this->reactor.mutex );
+        circ.recvBusy = false;
+        if ( ! protocolOK ) {
+            circ.recvDone = true;
+        }
+        if ( sendWakeupNeeded ) {
+            // an echo reply, or flow control request, is queued
+            circ.sendLabor = true;
+        }
+        // the I/O thread re-enables input and does any send labor
+        circ.pIO->labor ( guard, circ );
+    }
+}
+
+void tcpReactor::show ( unsigned level ) const
+{
+    ::printf ( "Multiplexed TCP circuit service with %u I/O threads\n",
+        this->nIO );
+    for ( unsigned i = 0u; i < this->nIO; i++ ) {
+        this->pIO[i]->show ( level );
+    }
+}
+
+#else /* CAC_HAVE_EPOLL */
+
+tcpReactor * tcpReactor::create ( cac &, epicsMutex &,
+    epicsMutex &, cacContextNotify &, unsigned, unsigned )
+{
+    errlogPrintf ( "CAC: EPICS_CA_IO_THREADS is not supported "
+        "on this target, using a thread pair per circuit\n" );
+    return 0;
+}
+
+tcpReactor::~tcpReactor () {}
+void tcpReactor::attach ( epicsGuard < epicsMutex > &, tcpReactorCircuit & ) {}
+void tcpReactor::labor ( epicsGuard < epicsMutex > &, tcpReactorCircuit & ) {}
+void tcpReactor::show ( unsigned ) const {}
+
+#endif /* CAC_HAVE_EPOLL */
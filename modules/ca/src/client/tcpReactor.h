@@ -0,0 +1,111 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Multiplexed CA client TCP circuit service.
+ *
+ *  When EPICS_CA_IO_THREADS is set to a positive number, the virtual
+ *  circuits of a client context are not given their own receive and
+ *  send threads. Instead each circuit is attached to the least loaded
+ *  of a pool of "CAC-TCP-io" threads, which connect, send, and receive
+ *  with non-blocking sockets waiting on epoll(7). Each I/O thread passes
+ *  the buffers it receives to its own "CAC-TCP-dispatch" thread which
+ *  runs the protocol stubs and user callbacks, exactly as a receive
+ *  thread would.
+ */
+
+#ifndef INC_tcpReactor_H
+#define INC_tcpReactor_H
+
+#include "tsDLList.h"
+#include "epicsEvent.h"
+#include "epicsGuard.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+class cac;
+class comBuf;
+class tcpiiu;
+class tcpReactor;
+class tcpReactorIO;
+class tcpReactorDispatch;
+class tcpReactorCircuit;
+class cacContextNotify;
+
+class tcpReactorNode : public tsDLNode < tcpReactorNode > {
+public:
+    tcpReactorNode ( tcpReactorCircuit & circuitIn ) :
+        circuit ( circuitIn ) {}
+    tcpReactorCircuit & circuit;
+};
+
+// per circuit state, protected by the cac mutex
+class tcpReactorCircuit : public tsDLNode < tcpReactorCircuit > {
+public:
+    tcpReactorCircuit ( tcpiiu & );
+private:
+    tcpReactorNode ioNode;          // tcpReactorIO::circuits
+    tcpReactorNode dispatchNode;    // tcpReactorDispatch::que
+    epicsTime recvTime;
+    epicsTime drainBegin;
+    tcpiiu & iiu;
+    tcpReactorIO * pIO;
+    comBuf * pSendBuf;      // partially sent buffer
+    unsigned events;        // epoll events not yet serviced
+    unsigned interest;      // epoll events currently requested
+    enum phase_t {
+        rcIdle,             // not yet attached
+        rcConnecting,       // connect() in progress
+        rcRunning,          // connected
+        rcDraining,         // waiting for the circuit to wind down
+        rcDetached          // queued for destruction
+    } phase;
+    bool laborQueued;       // on the I/O thread's labor list
+    bool sendLabor;         // requests may be waiting to be sent
+    bool recvBusy;          // a received buffer is being dispatched
+    bool recvDone;          // no more input will be read
+    bool sendBlocked;       // waiting for the socket to be writable
+    bool shutdownSent;      // clean shutdown flushed and SHUT_WR sent
+
+    tcpReactorCircuit ( const tcpReactorCircuit & );
+    tcpReactorCircuit & operator = ( const tcpReactorCircuit & );
+
+    friend class tcpReactor;
+    friend class tcpReactorIO;
+    friend class tcpReactorDispatch;
+    friend class tcpiiu;
+};
+
+class tcpReactor {
+public:
+    // returns NULL if the target does not support multiplexed circuits
+    static tcpReactor * create ( cac &, epicsMutex & mutex,
+        epicsMutex & cbMutex, cacContextNotify &,
+        unsigned nThreads, unsigned priority );
+    ~tcpReactor ();
+    void attach ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void labor ( epicsGuard < epicsMutex > &, tcpReactorCircuit & );
+    void show ( unsigned level ) const;
+private:
+    cac & cacRef;
+    epicsMutex & mutex;
+    epicsMutex & cbMutex;
+    cacContextNotify & ctxNotify;
+    tcpReactorIO ** pIO;
+    unsigned nIO;
+
+    tcpReactor ( cac &, epicsMutex & mutex, epicsMutex & cbMutex,
+        cacContextNotify &, unsigned nThreads, unsigned priority );
+
+    tcpReactor ( const tcpReactor & );
+    tcpReactor & operator = ( const tcpReactor & );
+
+    friend class tcpReactorIO;
+    friend class tcpReactorDispatch;
+};
+
+#endif // ifndef INC_tcpReactor_H
@@ -91,79 +91,7 @@ void tcpSendThread::run ()
                 break;
             }
 
-            laborPending = false;
-            bool flowControlLaborNeeded =
-                this->iiu.busyStateDetected != this->iiu.flowControlActive;
-            bool echoLaborNeeded = this->iiu.echoRequestPending;
-            this->iiu.echoRequestPending = false;
-
-            if ( flowControlLaborNeeded ) {
-                if ( this->iiu.flowControlActive ) {
-                    this->iiu.disableFlowControlRequest ( guard );
-                    this->iiu.flowControlActive = false;
-                    debugPrintf ( ( "fc off\n" ) );
-                }
-                else {
-                    this->iiu.enableFlowControlRequest ( guard );
-                    this->iiu.flowControlActive = true;
-                    debugPrintf ( ( "fc on\n" ) );
-                }
-            }
-
-            if ( echoLaborNeeded ) {
-                this->iiu.echoRequest ( guard );
-            }
-
-            while ( nciu * pChan = this->iiu.createReqPend.get () ) {
-                this->iiu.createChannelRequest ( *pChan, guard );
-
-                if ( CA_V42 ( this->iiu.minorProtocolVersion ) ) {
-                    this->iiu.createRespPend.add ( *pChan );
-                    pChan->channelNode::listMember =
-                        channelNode::cs_createRespPend;
-                }
-                else {
-                    // This wakes up the resp thread so that it can call
-                    // the connect callback. This isn't maximally efficient
-                    // but it has the excellent side effect of not requiring
-                    // that the UDP thread take the callback lock. There are
-                    // almost no V42 servers left at this point.
-                    this->iiu.v42ConnCallbackPend.add ( *pChan );
-                    pChan->channelNode::listMember =
-                        channelNode::cs_v42ConnCallbackPend;
-                    this->iiu.echoRequestPending = true;
-                    laborPending = true;
-                }
-
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
-
-            while ( nciu * pChan = this->iiu.subscripReqPend.get () ) {
-                // this installs any subscriptions as needed
-                pChan->resubscribe ( guard );
-                this->iiu.connectedList.add ( *pChan );
-                pChan->channelNode::listMember =
-                    channelNode::cs_connected;
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
-
-            while ( nciu * pChan = this->iiu.subscripUpdateReqPend.get () ) {
-                // this updates any subscriptions as needed
-                pChan->sendSubscriptionUpdateRequests ( guard );
-                this->iiu.connectedList.add ( *pChan );
-                pChan->channelNode::listMember =
-                    channelNode::cs_connected;
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
+            laborPending = this->iiu.sendLabor ( guard );
 
             if ( ! this->iiu.sendThreadFlush ( guard ) ) {
                 break;
@@ -202,7 +130,7 @@ void tcpSendThread::run ()
     this->iiu.sendDog.cancel ();
     this->iiu.recvDog.shutdown ();
 
-    while ( ! this->iiu.recvThread.exitWait ( 30.0 ) ) {
+    while ( ! this->iiu.pRecvThread->exitWait ( 30.0 ) ) {
         // it is possible to get stuck here if the user calls
         // ca_context_destroy() when a circuit isn't known to
         // be unresponsive, but is. That situation is probably
@@ -229,6 +157,89 @@ void tcpSendThread::run ()
     this->iiu.cacRef.destroyIIU ( this->iiu );
 }
 
+// queue the requests waiting for this circuit, returns true if
+// there is more to do after the send queue has been flushed
+bool tcpiiu::sendLabor ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    bool laborPending = false;
+    bool flowControlLaborNeeded =
+        this->busyStateDetected != this->flowControlActive;
+    bool echoLaborNeeded = this->echoRequestPending;
+    this->echoRequestPending = false;
+
+    if ( flowControlLaborNeeded ) {
+        if ( this->flowControlActive ) {
+            this->disableFlowControlRequest ( guard );
+            this->flowControlActive = false;
+            debugPrintf ( ( "fc off\n" ) );
+        }
+        else {
+            this->enableFlowControlRequest ( guard );
+            this->flowControlActive = true;
+            debugPrintf ( ( "fc on\n" ) );
+        }
+    }
+
+    if ( echoLaborNeeded ) {
+        this->echoRequest ( guard );
+    }
+
+    while ( nciu * pChan = this->createReqPend.get () ) {
+        this->createChannelRequest ( *pChan, guard );
+
+        if ( CA_V42 ( this->minorProtocolVersion ) ) {
+            this->createRespPend.add ( *pChan );
+            pChan->channelNode::listMember =
+                channelNode::cs_createRespPend;
+        }
+        else {
+            // This wakes up the resp thread so that it can call
+            // the connect callback. This isn't maximally efficient
+            // but it has the excellent side effect of not requiring
+            // that the UDP thread take the callback lock. There are
+            // almost no V42 servers left at this point.
+            this->v42ConnCallbackPend.add ( *pChan );
+            pChan->channelNode::listMember =
+                channelNode::cs_v42ConnCallbackPend;
+            this->echoRequestPending = true;
+            laborPending = true;
+        }
+
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    while ( nciu * pChan = this->subscripReqPend.get () ) {
+        // this installs any subscriptions as needed
+        pChan->resubscribe ( guard );
+        this->connectedList.add ( *pChan );
+        pChan->channelNode::listMember =
+            channelNode::cs_connected;
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    while ( nciu * pChan = this->subscripUpdateReqPend.get () ) {
+        // this updates any subscriptions as needed
+        pChan->sendSubscriptionUpdateRequests ( guard );
+        this->connectedList.add ( *pChan );
+        pChan->channelNode::listMember =
+            channelNode::cs_connected;
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    return laborPending;
+}
+
 unsigned tcpiiu::sendBytes ( const void *pBuf,
     unsigned nBytesInBuf, const epicsTime & currentTime )
 {
@@ -263,6 +274,13 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
                 continue;
             }
 
+            // only a multiplexed circuit's socket is non-blocking,
+            // the send watchdog keeps running until it is writable
+            if ( localError == SOCK_EWOULDBLOCK ) {
+                this->reactorCircuit.sendBlocked = true;
+                return 0u;
+            }
+
             if ( localError == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAC: system low on network buffers "
@@ -343,6 +361,13 @@ void tcpiiu::recvBytes (
                 continue;
             }
 
+            // only a multiplexed circuit's socket is non-blocking
+            if ( localErrno == SOCK_EWOULDBLOCK ) {
+                stat.bytesCopied = 0u;
+                stat.circuitState = swioConnected;
+                return;
+            }
+
             if ( localErrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAC: system low on network buffers "
@@ -407,11 +432,11 @@ void tcpRecvThread::exitWait ()
     this->thread.exitWait ();
 }
 
-bool tcpRecvThread::validFillStatus (
+bool tcpiiu::validFillStatus (
     epicsGuard < epicsMutex > & guard, const statusWireIO & stat )
 {
-    if ( this->iiu.state != tcpiiu::iiucs_connected &&
-        this->iiu.state != tcpiiu::iiucs_clean_shutdown ) {
+    if ( this->state != iiucs_connected &&
+        this->state != iiucs_clean_shutdown ) {
         return false;
     }
     if ( stat.circuitState == swioConnected ) {
@@ -419,21 +444,107 @@ bool tcpRecvThread::validFillStatus (
     }
     if ( stat.circuitState == swioPeerHangup ||
         stat.circuitState == swioPeerAbort ) {
-        this->iiu.disconnectNotify ( guard );
+        this->disconnectNotify ( guard );
     }
     else if ( stat.circuitState == swioLinkFailure ) {
-        this->iiu.initiateAbortShutdown ( guard );
+        this->initiateAbortShutdown ( guard );
     }
     else if ( stat.circuitState == swioLocalAbort ) {
         // state change already occurred
     }
     else {
         errlogMessage ( "cac: invalid fill status - disconnecting" );
-        this->iiu.disconnectNotify ( guard );
+        this->disconnectNotify ( guard );
     }
     return false;
 }
 
+//
+// process the buffers queued by the receive side, returns false
+// if the circuit must be aborted because of a protocol error
+//
+bool tcpiiu::processReceived ( cacContextNotify & ctxNotify,
+    const epicsTime & currentTime, bool & sendWakeupNeeded )
+{
+    // only one recv thread at a time may call callbacks
+    // - pendEvent() blocks until threads waiting for
+    // this lock get a chance to run
+    callbackManager mgr ( ctxNotify, this->cbMutex );
+
+    epicsGuard < epicsMutex > guard ( this->mutex );
+
+    // route legacy V42 channel connect through the recv thread -
+    // the only thread that should be taking the callback lock
+    while ( nciu * pChan = this->v42ConnCallbackPend.first () ) {
+        this->connectNotify ( guard, *pChan );
+        pChan->connect ( mgr.cbGuard, guard );
+    }
+
+    this->unacknowledgedSendBytes = 0u;
+
+    bool protocolOK = false;
+    {
+        epicsGuardRelease < epicsMutex > unguard ( guard );
+        // execute receive labor
+        protocolOK = this->processIncoming ( currentTime, mgr );
+    }
+
+    if ( ! protocolOK ) {
+        this->initiateAbortShutdown ( guard );
+        return false;
+    }
+    this->_receiveThreadIsBusy = false;
+    // reschedule connection activity watchdog
+    this->recvDog.messageArrivalNotify ( guard );
+    //
+    // if this thread has connected channels with subscriptions
+    // that need to be sent then wakeup the send thread
+    if ( this->subscripReqPend.count() ) {
+        sendWakeupNeeded = true;
+    }
+    return true;
+}
+
+//
+// returns true if the send side must be woken up to
+// switch flow control on or off
+//
+bool tcpiiu::recvFlowControl ()
+{
+    //
+    // we don't feel comfortable calling this with a lock applied
+    // (it might block for longer than we like)
+    //
+    // we would prefer to improve efficiency by trying, first, a
+    // recv with the new MSG_DONTWAIT flag set, but there isn't
+    // universal support
+    //
+    bool bytesArePending = this->bytesArePendingInOS ();
+    bool sendWakeupNeeded = false;
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    if ( bytesArePending ) {
+        if ( ! this->busyStateDetected ) {
+            this->contigRecvMsgCount++;
+            if ( this->contigRecvMsgCount >=
+                this->cacRef.maxContiguousFrames ( guard ) ) {
+                this->busyStateDetected = true;
+                sendWakeupNeeded = true;
+            }
+        }
+    }
+    else {
+        // if no bytes are pending then we must immediately
+        // switch off flow control w/o waiting for more
+        // data to arrive
+        this->contigRecvMsgCount = 0u;
+        if ( this->busyStateDetected ) {
+            sendWakeupNeeded = true;
+            this->busyStateDetected = false;
+        }
+    }
+    return sendWakeupNeeded;
+}
+
 void tcpRecvThread::run ()
 {
     try {
@@ -455,7 +566,7 @@ void tcpRecvThread::run ()
             }
         }
 
-        this->iiu.sendThread.start ();
+        this->iiu.pSendThread->start ();
         epicsThreadPrivateSet ( caClientCallbackThreadId, &this->iiu );
         this->iiu.cacRef.attachToClientCtx ();
 
@@ -481,7 +592,7 @@ void tcpRecvThread::run ()
             {
                 epicsGuard < epicsMutex > guard ( this->iiu.mutex );
 
-                if ( ! this->validFillStatus ( guard, stat ) ) {
+                if ( ! this->iiu.validFillStatus ( guard, stat ) ) {
                     break;
                 }
                 if ( stat.bytesCopied == 0u ) {
@@ -495,76 +606,12 @@ void tcpRecvThread::run ()
             }
 
             bool sendWakeupNeeded = false;
-            {
-                // only one recv thread at a time may call callbacks
-                // - pendEvent() blocks until threads waiting for
-                // this lock get a chance to run
-                callbackManager mgr ( this->ctxNotify, this->cbMutex );
-
-                epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-
-                // route legacy V42 channel connect through the recv thread -
-                // the only thread that should be taking the callback lock
-                while ( nciu * pChan = this->iiu.v42ConnCallbackPend.first () ) {
-                    this->iiu.connectNotify ( guard, *pChan );
-                    pChan->connect ( mgr.cbGuard, guard );
-                }
-
-                this->iiu.unacknowledgedSendBytes = 0u;
-
-                bool protocolOK = false;
-                {
-                    epicsGuardRelease < epicsMutex > unguard ( guard );
-                    // execute receive labor
-                    protocolOK = this->iiu.processIncoming ( currentTime, mgr );
-                }
-
-                if ( ! protocolOK ) {
-                    this->iiu.initiateAbortShutdown ( guard );
-                    break;
-                }
-                this->iiu._receiveThreadIsBusy = false;
-                // reschedule connection activity watchdog
-                this->iiu.recvDog.messageArrivalNotify ( guard );
-                //
-                // if this thread has connected channels with subscriptions
-                // that need to be sent then wakeup the send thread
-                if ( this->iiu.subscripReqPend.count() ) {
-                    sendWakeupNeeded = true;
-                }
+            if ( ! this->iiu.processReceived ( this->ctxNotify,
+                    currentTime, sendWakeupNeeded ) ) {
+                break;
             }
-
-            //
-            // we don't feel comfortable calling this with a lock applied
-            // (it might block for longer than we like)
-            //
-            // we would prefer to improve efficiency by trying, first, a
-            // recv with the new MSG_DONTWAIT flag set, but there isn't
-            // universal support
-            //
-            bool bytesArePending = this->iiu.bytesArePendingInOS ();
-            {
-                epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-                if ( bytesArePending ) {
-                    if ( ! this->iiu.busyStateDetected ) {
-                        this->iiu.contigRecvMsgCount++;
-                        if ( this->iiu.contigRecvMsgCount >=
-                            this->iiu.cacRef.maxContiguousFrames ( guard ) ) {
-                            this->iiu.busyStateDetected = true;
-                            sendWakeupNeeded = true;
-                        }
-                    }
-                }
-                else {
-                    // if no bytes are pending then we must immediately
-                    // switch off flow control w/o waiting for more
-                    // data to arrive
-                    this->iiu.contigRecvMsgCount = 0u;
-                    if ( this->iiu.busyStateDetected ) {
-                        sendWakeupNeeded = true;
-                        this->iiu.busyStateDetected = false;
-                    }
-                }
+            if ( this->iiu.recvFlowControl () ) {
+                sendWakeupNeeded = true;
             }
 
             if ( sendWakeupNeeded ) {
@@ -673,13 +720,11 @@ tcpiiu::tcpiiu (
         SearchDestTCP * pSearchDestIn ) :
     caServerID ( addrIn.ia, priorityIn ),
     hostNameCacheInstance ( addrIn, engineIn ),
-    recvThread ( *this, cbMutexIn, ctxNotifyIn, "CAC-TCP-recv",
-        epicsThreadGetStackSize ( epicsThreadStackBig ),
-        cac::highestPriorityLevelBelow ( cac.getInitializingThreadsPriority() ) ),
-    sendThread ( *this, "CAC-TCP-send",
-        epicsThreadGetStackSize ( epicsThreadStackMedium ),
-        cac::lowestPriorityLevelAbove (
-            cac.getInitializingThreadsPriority() ) ),
+    pRecvThread ( 0 ),
+    pSendThread ( 0 ),
+    // circuits to name servers keep their own threads
+    pReactor ( pSearchDestIn ? 0 : cac.pReactor ),
+    reactorCircuit ( *this ),
     recvDog ( cbMutexIn, ctxNotifyIn, mutexIn,
         *this, connectionTimeout, timerQueue ),
     sendDog ( cbMutexIn, ctxNotifyIn, mutexIn,
@@ -691,6 +736,8 @@ tcpiiu::tcpiiu (
     comBufMemMgr ( comBufMemMgrIn ),
     cacRef ( cac ),
     pCurData ( (char*) freeListMalloc(this->cacRef.tcpSmallRecvBufFreeList) ),
+    pExpandBuf ( 0 ),
+    expandBufMax ( 0u ),
     pSearchDest ( pSearchDestIn ),
     mutex ( mutexIn ),
     cbMutex ( cbMutexIn ),
@@ -711,6 +758,7 @@ tcpiiu::tcpiiu (
     earlyFlush ( false ),
     recvProcessPostponedFlush ( false ),
     discardingPendingData ( false ),
+    directRecv ( false ),
     socketHasBeenClosed ( false ),
     unresponsiveCircuit ( false )
 {
@@ -808,6 +856,26 @@ tcpiiu::tcpiiu (
         }
     }
 
+    if ( ! this->pReactor ) {
+        try {
+            this->pRecvThread = new tcpRecvThread ( *this, cbMutexIn,
+                ctxNotifyIn, "CAC-TCP-recv",
+                epicsThreadGetStackSize ( epicsThreadStackBig ),
+                cac::highestPriorityLevelBelow (
+                    cac.getInitializingThreadsPriority() ) );
+            this->pSendThread = new tcpSendThread ( *this, "CAC-TCP-send",
+                epicsThreadGetStackSize ( epicsThreadStackMedium ),
+                cac::lowestPriorityLevelAbove (
+                    cac.getInitializingThreadsPriority() ) );
+        }
+        catch ( ... ) {
+            delete this->pRecvThread;
+            epicsSocketDestroy ( this->sock );
+            freeListFree(this->cacRef.tcpSmallRecvBufFreeList, this->pCurData);
+            throw;
+        }
+    }
+
     if ( isNameService() ) {
         pSearchDest->setCircuit ( this );
     }
@@ -821,7 +889,12 @@ void tcpiiu::start (
     epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
-    this->recvThread.start ();
+    if ( this->pReactor ) {
+        this->pReactor->attach ( guard, this->reactorCircuit );
+    }
+    else {
+        this->pRecvThread->start ();
+    }
 }
 
 void tcpiiu::initiateCleanShutdown (
@@ -835,7 +908,7 @@ void tcpiiu::initiateCleanShutdown (
         }
         else {
             this->state = iiucs_clean_shutdown;
-            this->sendThreadFlushEvent.signal ();
+            this->sendWakeup ( guard );
             this->flushBlockEvent.signal ();
         }
     }
@@ -854,7 +927,7 @@ void tcpiiu::disconnectNotify (
 {
     guard.assertIdenticalMutex ( this->mutex );
     this->state = iiucs_disconnected;
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
     this->flushBlockEvent.signal ();
 }
 
@@ -872,7 +945,7 @@ void tcpiiu::responsiveCircuitNotify (
                 channelNode::cs_subscripUpdateReqPend;
             pChan->connect ( cbGuard, guard );
         }
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
     }
 }
 
@@ -906,7 +979,7 @@ void tcpiiu::unresponsiveCircuitNotify (
     if ( ! this->unresponsiveCircuit ) {
         this->unresponsiveCircuit = true;
         this->echoRequestPending = true;
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
         this->flushBlockEvent.signal ();
 
         // must not hold lock when canceling timer
@@ -994,8 +1067,10 @@ void tcpiiu::initiateAbortShutdown (
             }
             break;
         case esscimqi_socketSigAlarmRequired:
-            this->recvThread.interruptSocketRecv ();
-            this->sendThread.interruptSocketSend ();
+            if ( this->pRecvThread ) {
+                this->pRecvThread->interruptSocketRecv ();
+                this->pSendThread->interruptSocketSend ();
+            }
             break;
         default:
             break;
@@ -1004,7 +1079,7 @@ void tcpiiu::initiateAbortShutdown (
         //
         // wake up the send thread if it isn't blocking in send()
         //
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
         this->flushBlockEvent.signal ();
     }
 }
@@ -1018,8 +1093,12 @@ tcpiiu :: ~tcpiiu ()
         this->pSearchDest->disable ();
     }
 
-    this->sendThread.exitWait ();
-    this->recvThread.exitWait ();
+    if ( this->pRecvThread ) {
+        this->pSendThread->exitWait ();
+        this->pRecvThread->exitWait ();
+        delete this->pSendThread;
+        delete this->pRecvThread;
+    }
     this->sendDog.cancel ();
     this->recvDog.shutdown ();
 
@@ -1039,6 +1118,22 @@ tcpiiu :: ~tcpiiu ()
             free ( this->pCurData );
         }
     }
+    free ( this->pExpandBuf );
+}
+
+char * tcpiiu::expansionBuffer ( arrayElementCount size )
+{
+    if ( size > this->expandBufMax ) {
+        // round size up to multiple of 4K
+        arrayElementCount newsize = ( ( size - 1 ) | 0xfff ) + 1;
+        char * newbuf = ( char * ) realloc ( this->pExpandBuf, 2 * newsize );
+        if ( ! newbuf ) {
+            return 0;
+        }
+        this->pExpandBuf = newbuf;
+        this->expandBufMax = newsize;
+    }
+    return this->pExpandBuf;
 }
 
 void tcpiiu::show ( unsigned level ) const
@@ -1062,9 +1157,13 @@ void tcpiiu::show ( unsigned level ) const
         ::printf ( "\tsend thread flush signal:\n" );
         this->sendThreadFlushEvent.show ( level-2u );
         ::printf ( "\tsend thread:\n" );
-        this->sendThread.show ( level-2u );
+        if ( this->pSendThread ) {
+            this->pSendThread->show ( level-2u );
+        }
         ::printf ( "\trecv thread:\n" );
-        this->recvThread.show ( level-2u );
+        if ( this->pRecvThread ) {
+            this->pRecvThread->show ( level-2u );
+        }
         ::printf ("\techo pending bool = %u\n", this->echoRequestPending );
         ::printf ( "IO identifier hash table:\n" );
 
@@ -1124,7 +1223,7 @@ bool tcpiiu::setEchoRequestPending ( epicsGuard < epicsMutex > & guard )
     guard.assertIdenticalMutex ( this->mutex );
 
     this->echoRequestPending = true;
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
     if ( CA_V43 ( this->minorProtocolVersion ) ) {
         // we send an echo
         return true;
@@ -1202,6 +1301,58 @@ bool tcpiiu::processIncoming (
             return false;
         }
 
+        //
+        // the payload of a large read response is received directly
+        // into the requester's buffer when it has one. The request is
+        // looked up again whenever more of the payload arrives because
+        // it may have been canceled in between.
+        //
+        if ( this->curMsg.m_postsize > MAX_TCP &&
+                ( this->directRecv || this->curDataBytes == 0u ) ) {
+            arrayElementCount dataBytes = 0u;
+            char * pDest;
+            {
+                epicsGuard < epicsMutex > guard ( this->mutex );
+                pDest = this->cacRef.responseBuffer (
+                    guard, *this, this->curMsg, dataBytes );
+            }
+            if ( pDest || this->directRecv ) {
+                this->directRecv = true;
+                // the padding, and the remainder of the response
+                // to a canceled request, are discarded
+                while ( this->curDataBytes < this->curMsg.m_postsize ) {
+                    unsigned nBytes;
+                    if ( pDest && this->curDataBytes < dataBytes ) {
+                        nBytes = this->recvQue.copyOutBytes (
+                            & pDest[this->curDataBytes], static_cast < unsigned >
+                                ( dataBytes - this->curDataBytes ) );
+                    }
+                    else {
+                        nBytes = this->recvQue.removeBytes ( static_cast < unsigned >
+                            ( this->curMsg.m_postsize - this->curDataBytes ) );
+                    }
+                    if ( nBytes == 0u ) {
+                        epicsGuard < epicsMutex > guard ( this->mutex );
+                        this->flushIfRecvProcessRequested ( guard );
+                        return true;
+                    }
+                    this->curDataBytes += nBytes;
+                }
+                this->directRecv = false;
+                if ( pDest ) {
+                    bool msgOK = this->cacRef.executeResponse ( mgr, *this,
+                                        currentTime, this->curMsg, pDest );
+                    if ( ! msgOK ) {
+                        return false;
+                    }
+                }
+                this->oldMsgHeaderAvailable = false;
+                this->msgHeaderAvailable = false;
+                this->curDataBytes = 0u;
+                continue;
+            }
+        }
+
         //
         // make sure we have a large enough message body cache
         //
@@ -1389,11 +1540,13 @@ void tcpiiu::versionMessage ( epicsGuard < epicsMutex > & guard,
         this->flushRequest ( guard );
     }
 
+    // the available field is abused to carry the size above which
+    // responses are to be compressed starting with CA V4.14
     comQueSendMsgMinder minder ( this->sendQue, guard );
     this->sendQue.insertRequestHeader (
         CA_PROTO_VERSION, 0u,
         static_cast < ca_uint16_t > ( priority ),
-        CA_MINOR_PROTOCOL_REVISION, 0u, 0u,
+        CA_MINOR_PROTOCOL_REVISION, 0u, this->cacRef.compressThreshold,
         CA_V49 ( this->minorProtocolVersion ) );
     minder.commit ();
 }
@@ -1812,8 +1965,17 @@ void tcpiiu::disconnectAllChannels (
     cbGuard.assertIdenticalMutex ( this->cbMutex );
     guard.assertIdenticalMutex ( this->mutex );
 
+    // channels sent here because of a search cache entry are
+    // searched for at once if the server could not be reached
+    osiSockAddr addr = this->getNetworkAddress ( guard );
+
     while ( nciu * pChan = this->createReqPend.get () ) {
-        discIIU.installDisconnectedChannel ( guard, *pChan );
+        if ( this->cacRef.uncacheChannel ( guard, *pChan, addr ) ) {
+            discIIU.installUnresolvedChannel ( guard, *pChan );
+        }
+        else {
+            discIIU.installDisconnectedChannel ( guard, *pChan );
+        }
     }
 
     while ( nciu * pChan = this->createRespPend.get () ) {
@@ -1821,7 +1983,12 @@ void tcpiiu::disconnectAllChannels (
         // send a channel delete request and will instead
         // trust that the server can do the proper cleanup
         // when the circuit disconnects
-        discIIU.installDisconnectedChannel ( guard, *pChan );
+        if ( this->cacRef.uncacheChannel ( guard, *pChan, addr ) ) {
+            discIIU.installUnresolvedChannel ( guard, *pChan );
+        }
+        else {
+            discIIU.installDisconnectedChannel ( guard, *pChan );
+        }
     }
 
     while ( nciu * pChan = this->v42ConnCallbackPend.get () ) {
@@ -1953,7 +2120,7 @@ void tcpiiu::installChannel (
     chan.searchReplySetUp ( *this, sidIn, typeIn, countIn, guard );
     // The tcp send thread runs at a priority below the udp thread
     // so that this will not send small packets
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
 }
 
 bool tcpiiu :: connectNotify (
@@ -2036,13 +2203,24 @@ int tcpiiu :: printFormated (
     return status;
 }
 
-void tcpiiu::flushRequest ( epicsGuard < epicsMutex > & )
+void tcpiiu::sendWakeup ( epicsGuard < epicsMutex > & guard )
 {
-    if ( this->sendQue.occupiedBytes () > 0 ) {
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pReactor ) {
+        this->pReactor->labor ( guard, this->reactorCircuit );
+    }
+    else {
         this->sendThreadFlushEvent.signal ();
     }
 }
 
+void tcpiiu::flushRequest ( epicsGuard < epicsMutex > & guard )
+{
+    if ( this->sendQue.occupiedBytes () > 0 ) {
+        this->sendWakeup ( guard );
+    }
+}
+
 bool tcpiiu::bytesArePendingInOS () const
 {
 #if 0
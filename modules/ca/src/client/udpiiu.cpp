@@ -23,6 +23,8 @@
 #   pragma warning(disable:4355)
 #endif
 
+#include <string.h>
+
 #define epicsAssertAuthor "Jeff Hill johill@lanl.gov"
 
 #include "envDefs.h"
@@ -403,42 +405,65 @@ void udpRecvThread::run ()
             this->iiu.cacRef, ECA_NOSEARCHADDR, NULL );
     }
 
+    // the first datagram of a batch goes in recvBuf, and the others in
+    // buffers of the same size, so none is truncated which would fit
+    // there.  Those are only allocated where datagrams are received in
+    // batches.
+    unsigned batchSize = epicsSocketRecvManyMax ();
+    if ( batchSize > udpiiu::recvBatchSize ) {
+        batchSize = udpiiu::recvBatchSize;
+    }
+    char ( * pBatchBuf ) [MAX_UDP_RECV] = 0;
+    if ( batchSize > 1u ) {
+        pBatchBuf = new char [batchSize - 1u][MAX_UDP_RECV];
+    }
+    epicsSocketDatagram dgs [ udpiiu::recvBatchSize ];
+    memset ( dgs, 0, sizeof ( dgs ) );
+    dgs[0].buf = this->iiu.recvBuf;
+    dgs[0].bufSize = sizeof ( this->iiu.recvBuf );
+    for ( unsigned i = 1u; i < batchSize; i++ ) {
+        dgs[i].buf = pBatchBuf[i - 1u];
+        dgs[i].bufSize = sizeof ( pBatchBuf[i - 1u] );
+    }
+
     do {
-        osiSockAddr src;
-        osiSocklen_t src_size = sizeof ( src );
-        int status = recvfrom ( this->iiu.sock,
-            this->iiu.recvBuf, sizeof ( this->iiu.recvBuf ), 0,
-            & src.sa, & src_size );
-
-        if ( status <= 0 ) {
-
-            if ( status < 0 ) {
-                int errnoCpy = SOCKERRNO;
-                if (
-                    errnoCpy != SOCK_EINTR &&
-                    errnoCpy != SOCK_SHUTDOWN &&
-                    errnoCpy != SOCK_ENOTSOCK &&
-                    errnoCpy != SOCK_EBADF &&
-                    // Avoid spurious ECONNREFUSED bug in linux
-                    errnoCpy != SOCK_ECONNREFUSED &&
-                    // Avoid ECONNRESET from disconnected socket bug
-                    // in windows
-                    errnoCpy != SOCK_ECONNRESET ) {
-
-                    char sockErrBuf[64];
-                    epicsSocketConvertErrnoToString (
-                        sockErrBuf, sizeof ( sockErrBuf ) );
-                    errlogPrintf ( "CAC: UDP recv " ERL_ERROR " was \"%s\"\n",
-                        sockErrBuf );
-                }
+        int status = epicsSocketRecvMany ( this->iiu.sock,
+            dgs, batchSize );
+
+        if ( status < 0 ) {
+            int errnoCpy = SOCKERRNO;
+            if (
+                errnoCpy != SOCK_EINTR &&
+                errnoCpy != SOCK_SHUTDOWN &&
+                errnoCpy != SOCK_ENOTSOCK &&
+                errnoCpy != SOCK_EBADF &&
+                // Avoid spurious ECONNREFUSED bug in linux
+                errnoCpy != SOCK_ECONNREFUSED &&
+                // Avoid ECONNRESET from disconnected socket bug
+                // in windows
+                errnoCpy != SOCK_ECONNRESET ) {
+
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ( "CAC: UDP recv " ERL_ERROR " was \"%s\"\n",
+                    sockErrBuf );
             }
         }
         else if ( status > 0 ) {
-            this->iiu.postMsg ( src, this->iiu.recvBuf,
-                (arrayElementCount) status, epicsTime::getCurrent() );
+            epicsTime now = epicsTime::getCurrent ();
+            for ( int i = 0; i < status; i++ ) {
+                if ( dgs[i].len > 0u && ! dgs[i].truncated ) {
+                    this->iiu.postMsg ( dgs[i].addr,
+                        static_cast < char * > ( dgs[i].buf ),
+                        (arrayElementCount) dgs[i].len, now );
+                }
+            }
         }
 
     } while ( ! this->iiu.shutdownCmd );
+
+    delete [] pBatchBuf;
 }
 
 /* for sunpro compiler */
@@ -1264,6 +1289,31 @@ void udpiiu::installDisconnectedChannel (
     this->govTmr.installChan ( guard, chan );
 }
 
+// a channel which was sent to a server that does not have it
+void udpiiu::installUnresolvedChannel (
+    epicsGuard < epicsMutex > & guard, nciu & chan )
+{
+    chan.setServerAddressUnknown ( *this, guard );
+    this->ppSearchTmr[0]->installChannel ( guard, chan );
+}
+
+// A channel which is already installed on a circuit, because of the
+// search cache, is searched for once. The request goes out with the
+// next search timer's datagram, and the replies are only checked
+// against the channel's server.
+void udpiiu::searchOnce (
+    epicsGuard < epicsMutex > & guard, nciu & chan )
+{
+    guard.assertIdenticalMutex ( this->cacMutex );
+    bool success = this->searchMsg ( guard, chan.getId (),
+        chan.pName ( guard ), chan.nameLen ( guard ) );
+    if ( ! success ) {
+        this->datagramFlush ( guard, epicsTime::getCurrent () );
+        this->searchMsg ( guard, chan.getId (),
+            chan.pName ( guard ), chan.nameLen ( guard ) );
+    }
+}
+
 void udpiiu::noSearchRespNotify (
     epicsGuard < epicsMutex > & guard, nciu & chan, unsigned index )
 {
@@ -107,6 +107,10 @@ public:
         epicsGuard < epicsMutex > &, nciu &, netiiu * & );
     void installDisconnectedChannel (
         epicsGuard < epicsMutex > &, nciu & );
+    void installUnresolvedChannel (
+        epicsGuard < epicsMutex > &, nciu & );
+    void searchOnce (
+        epicsGuard < epicsMutex > &, nciu & );
     void beaconAnomalyNotify (
         epicsGuard < epicsMutex > & guard );
     void shutdown ( epicsGuard < epicsMutex > & cbGuard,
@@ -159,6 +163,9 @@ private:
     };
     char xmitBuf [MAX_UDP_SEND];
     char recvBuf [MAX_UDP_RECV];
+    // the most datagrams received with one call, where the target
+    // receives in batches
+    enum { recvBatchSize = 16u };
     udpRecvThread recvThread;
     M_repeaterTimerNotify m_repeaterTimerNotify;
     repeaterSubscribeTimer repeaterSubscribeTmr;
@@ -37,6 +37,7 @@
 #include "tcpSendWatchdog.h"
 #include "hostNameCache.h"
 #include "SearchDest.h"
+#include "tcpReactor.h"
 #include "compilerDependencies.h"
 
 class callbackManager;
@@ -72,9 +73,6 @@ private:
     void run ();
     void connect (
         epicsGuard < epicsMutex > & guard );
-    bool validFillStatus (
-        epicsGuard < epicsMutex > & guard,
-        const statusWireIO & stat );
 };
 
 class tcpSendThread : private epicsThreadRunable {
@@ -179,6 +177,9 @@ public:
     int printFormated (
         epicsGuard < epicsMutex > & cbGuard,
         const char *pformat, ... );
+    // storage for an expanded response of size bytes
+    // followed by the same amount of work space
+    char * expansionBuffer ( arrayElementCount size );
     unsigned channelCount (
         epicsGuard < epicsMutex > & );
     void disconnectAllChannels (
@@ -206,8 +207,10 @@ public:
 
 private:
     hostNameCache hostNameCacheInstance;
-    tcpRecvThread recvThread;
-    tcpSendThread sendThread;
+    tcpRecvThread * pRecvThread;    // NULL when multiplexed
+    tcpSendThread * pSendThread;    // NULL when multiplexed
+    tcpReactor * pReactor;
+    tcpReactorCircuit reactorCircuit;
     tcpRecvWatchdog recvDog;
     tcpSendWatchdog sendDog;
     comQueSend sendQue;
@@ -227,6 +230,8 @@ private:
     comBufMemoryManager & comBufMemMgr;
     cac & cacRef;
     char * pCurData;
+    char * pExpandBuf;
+    arrayElementCount expandBufMax;
     SearchDestTCP * pSearchDest;
     epicsMutex & mutex;
     epicsMutex & cbMutex;
@@ -255,11 +260,22 @@ private:
     bool earlyFlush;
     bool recvProcessPostponedFlush;
     bool discardingPendingData;
+    bool directRecv; // payload is being received into the requester's buffer
     bool socketHasBeenClosed;
     bool unresponsiveCircuit;
 
     bool processIncoming (
         const epicsTime & currentTime, callbackManager & );
+    bool validFillStatus (
+        epicsGuard < epicsMutex > & guard,
+        const statusWireIO & stat );
+    bool processReceived ( cacContextNotify &,
+        const epicsTime & currentTime, bool & sendWakeupNeeded );
+    bool recvFlowControl ();
+    bool sendLabor (
+        epicsGuard < epicsMutex > & );
+    void sendWakeup (
+        epicsGuard < epicsMutex > & );
     unsigned sendBytes ( const void *pBuf,
         unsigned nBytesInBuf, const epicsTime & currentTime );
     void recvBytes (
@@ -331,6 +347,9 @@ private:
 
     friend class tcpRecvThread;
     friend class tcpSendThread;
+    friend class tcpReactor;
+    friend class tcpReactorIO;
+    friend class tcpReactorDispatch;
 
     tcpiiu ( const tcpiiu & );
     tcpiiu & operator = ( const tcpiiu & );
@@ -0,0 +1,10 @@
+/* Generated file, do not edit! */
+
+/* Version determined from Git */
+
+#ifndef EPICS_VCS_VERSION
+  #define EPICS_VCS_VERSION "d60c20efb8cfa560e420-dirty"
+#endif
+#ifndef EPICS_VCS_VERSION_DATE
+  #define EPICS_VCS_VERSION_DATE "Git: 2026-10-17 10:59:04 +0000"
+#endif
@@ -26,9 +26,9 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
-#include "epicsRingPointer.h"
 #include "epicsString.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "epicsTimer.h"
 #include "errlog.h"
 #include "errMdef.h"
@@ -41,6 +41,7 @@
 #include "dbCommon.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
+#include "dbProcStats.h"
 #include "dbStaticLib.h"
 #include "epicsExport.h"
 #include "link.h"
@@ -50,15 +51,67 @@
 
 static int callbackQueueSize = 2000;
 
+/* Each callback thread has its own queue, a multi-producer multi-consumer
+ * lock-free FIFO based on D. Vyukov's bounded queue.  callbackRequest()
+ * spreads requests over the queues of a priority round robin.  A thread
+ * runs the callbacks from its own queue, and when that is empty it takes
+ * ("steals") them from the queues of the other threads of its priority.
+ *
+ * A queue which fills up grows by linking a new segment of twice the size
+ * behind the full one.  The old segment is closed to producers, drained by
+ * the consumers, and only freed by callbackCleanup().  Requests made from
+ * interrupt context can't allocate, so they still fail on a full segment.
+ */
+
+/* A queue may grow to 2^CB_MAX_GROWTH times its initial size */
+#define CB_MAX_GROWTH 6
+
+typedef struct cbSlot {
+    size_t seq;         /* use atomic */
+    epicsCallback *pcallback;
+    epicsUInt64 queued; /* when pushed, if dbProcStatsActive, else 0 */
+} cbSlot;
+
+/* head and tail count in steps of 2, the low bit of tail is CB_SEG_CLOSED */
+#define CB_SEG_CLOSED 1u
+
+typedef struct cbSegment {
+    struct cbSegment *next; /* use atomic */
+    size_t head;            /* use atomic */
+    size_t tail;            /* use atomic */
+    size_t mask;
+    int growth;
+    cbSlot slots[1];
+} cbSegment;
+
+struct cbQueueSet;
+
+typedef struct cbWorker {
+    struct cbQueueSet *set;
+    int index;
+    epicsThreadId tid;
+    cbSegment *first;
+    cbSegment *popSeg;  /* use atomic */
+    cbSegment *pushSeg; /* use atomic */
+    int numUsed;        /* use atomic */
+    int maxUsed;        /* use atomic */
+    int numGrown;       /* use atomic */
+    /* updated by the owning thread only */
+    unsigned long numRun;
+    unsigned long numStolen;
+    dbProcHist waits;   /* time taken callbacks spent queued */
+    int waitsReset;     /* use atomic */
+} cbWorker;
+
 typedef struct cbQueueSet {
     epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    cbWorker *workers;
+    size_t nextWorker;  /* use atomic */
     int queueOverflow;
     int queueOverflows;
     int shutdown; // use atomic
     int threadsConfigured;
     int threadsRunning;
-    epicsThreadId *threads;
 } cbQueueSet;
 
 static cbQueueSet callbackQueue[NUM_CALLBACK_PRIORITIES];
@@ -95,7 +148,205 @@ static unsigned int threadPriority[NUM_CALLBACK_PRIORITIES] = {
     epicsThreadPriorityScanLow + 4,
     epicsThreadPriorityScanHigh + 1
 };
-static int priorityValue[NUM_CALLBACK_PRIORITIES] = {0, 1, 2};
+
+
+static cbSegment * cbSegmentCreate(size_t size, int growth)
+{
+    cbSegment *seg = malloc(sizeof(cbSegment) + (size - 1) * sizeof(cbSlot));
+    size_t i;
+
+    if (!seg) return NULL;
+    seg->next = NULL;
+    seg->head = seg->tail = 0;
+    seg->mask = size - 1;
+    seg->growth = growth;
+    for (i = 0; i < size; i++) {
+        seg->slots[i].seq = 2 * i;
+        seg->slots[i].pcallback = NULL;
+    }
+    return seg;
+}
+
+/* Returns FALSE if the segment is full or closed */
+static int cbSegmentPush(cbSegment *seg, epicsCallback *pcallback,
+    epicsUInt64 queued)
+{
+    size_t pos = epicsAtomicGetSizeT(&seg->tail);
+    cbSlot *slot;
+
+    for (;;) {
+        long diff;
+
+        if (pos & CB_SEG_CLOSED)
+            return FALSE;
+        slot = &seg->slots[(pos >> 1) & seg->mask];
+        diff = (long) (epicsAtomicGetSizeT(&slot->seq) - pos);
+        if (diff == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&seg->tail, pos, pos + 2);
+            if (prev == pos)
+                break;
+            pos = prev;
+        }
+        else if (diff < 0)
+            return FALSE;
+        else
+            pos = epicsAtomicGetSizeT(&seg->tail);
+    }
+    slot->pcallback = pcallback;
+    slot->queued = queued;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&slot->seq, pos + 2);
+    return TRUE;
+}
+
+/* Returns NULL if the segment is empty, or the next entry isn't written yet */
+static epicsCallback * cbSegmentPop(cbSegment *seg, epicsUInt64 *pqueued)
+{
+    size_t pos = epicsAtomicGetSizeT(&seg->head);
+    epicsCallback *pcallback;
+    cbSlot *slot;
+
+    for (;;) {
+        long diff;
+
+        slot = &seg->slots[(pos >> 1) & seg->mask];
+        diff = (long) (epicsAtomicGetSizeT(&slot->seq) - (pos + 2));
+        if (diff == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&seg->head, pos, pos + 2);
+            if (prev == pos)
+                break;
+            pos = prev;
+        }
+        else if (diff < 0)
+            return NULL;
+        else
+            pos = epicsAtomicGetSizeT(&seg->head);
+    }
+    pcallback = slot->pcallback;
+    *pqueued = slot->queued;
+    epicsAtomicReadMemoryBarrier();
+    epicsAtomicSetSizeT(&slot->seq, pos + 2 * (seg->mask + 1));
+    return pcallback;
+}
+
+static void cbSegmentClose(cbSegment *seg)
+{
+    size_t tail = epicsAtomicGetSizeT(&seg->tail);
+
+    while (!(tail & CB_SEG_CLOSED)) {
+        size_t prev = epicsAtomicCmpAndSwapSizeT(&seg->tail, tail,
+            tail | CB_SEG_CLOSED);
+        if (prev == tail)
+            break;
+        tail = prev;
+    }
+}
+
+/* Other producers may be pushing to the same queue */
+static void cbWorkerMaxUsed(cbWorker *worker, int used)
+{
+    int max = epicsAtomicGetIntT(&worker->maxUsed);
+
+    while (used > max) {
+        int prev = epicsAtomicCmpAndSwapIntT(&worker->maxUsed, max, used);
+        if (prev == max)
+            break;
+        max = prev;
+    }
+}
+
+static int cbWorkerPush(cbWorker *worker, epicsCallback *pcallback,
+    epicsUInt64 queued, int canGrow)
+{
+    int used = epicsAtomicIncrIntT(&worker->numUsed);
+
+    for (;;) {
+        cbSegment *seg = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &worker->pushSeg);
+        cbSegment *next;
+
+        if (cbSegmentPush(seg, pcallback, queued))
+            break;
+
+        next = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &seg->next);
+        if (!next) {
+            cbSegment *prev;
+
+            if (!canGrow || seg->growth >= CB_MAX_GROWTH ||
+                !(next = cbSegmentCreate(2 * (seg->mask + 1), seg->growth + 1))) {
+                epicsAtomicDecrIntT(&worker->numUsed);
+                return FALSE;
+            }
+            cbSegmentClose(seg);
+            prev = epicsAtomicCmpAndSwapPtrT((EpicsAtomicPtrT *) &seg->next,
+                NULL, next);
+            if (prev) {
+                free(next);
+                next = prev;
+            }
+            else
+                epicsAtomicIncrIntT(&worker->numGrown);
+        }
+        epicsAtomicCmpAndSwapPtrT((EpicsAtomicPtrT *) &worker->pushSeg, seg, next);
+    }
+
+    cbWorkerMaxUsed(worker, used);
+    return TRUE;
+}
+
+static epicsCallback * cbWorkerPop(cbWorker *worker, epicsUInt64 *pqueued)
+{
+    for (;;) {
+        cbSegment *seg = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &worker->popSeg);
+        epicsCallback *pcallback = cbSegmentPop(seg, pqueued);
+        cbSegment *next;
+        size_t tail;
+
+        if (pcallback) {
+            epicsAtomicDecrIntT(&worker->numUsed);
+            return pcallback;
+        }
+
+        /* move on once a closed segment has been drained */
+        next = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &seg->next);
+        tail = epicsAtomicGetSizeT(&seg->tail);
+        if (!next || epicsAtomicGetSizeT(&seg->head) != (tail & ~(size_t) CB_SEG_CLOSED))
+            return NULL;
+        epicsAtomicCmpAndSwapPtrT((EpicsAtomicPtrT *) &worker->popSeg, seg, next);
+    }
+}
+
+static size_t cbWorkerSize(cbWorker *worker)
+{
+    cbSegment *seg = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &worker->pushSeg);
+    return seg->mask + 1;
+}
+
+static int cbSetPending(cbQueueSet *mySet)
+{
+    int i;
+
+    for (i = 0; i < mySet->threadsConfigured; i++) {
+        if (epicsAtomicGetIntT(&mySet->workers[i].numUsed) > 0)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* Take the next callback from our own queue, or else from another's */
+static epicsCallback * cbSetTake(cbQueueSet *mySet, cbWorker *me,
+    epicsUInt64 *pqueued)
+{
+    epicsCallback *pcallback = cbWorkerPop(me, pqueued);
+    int n = mySet->threadsConfigured;
+    int i;
+
+    for (i = 1; !pcallback && i < n; i++) {
+        pcallback = cbWorkerPop(&mySet->workers[(me->index + i) % n], pqueued);
+        if (pcallback)
+            me->numStolen++;
+    }
+    return pcallback;
+}
 
 
 int callbackSetQueueSize(int size)
@@ -116,10 +367,21 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
         int prio;
         result->size = callbackQueueSize;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
-            result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            int i;
+
+            result->numUsed[prio] = 0;
+            result->maxUsed[prio] = 0;
+            for (i = 0; i < mySet->threadsConfigured; i++) {
+                cbWorker *worker = &mySet->workers[i];
+                int used = epicsAtomicGetIntT(&worker->numUsed);
+                int max = epicsAtomicGetIntT(&worker->maxUsed);
+
+                result->numUsed[prio] += used > 0 ? used : 0;
+                if (max > result->maxUsed[prio])
+                    result->maxUsed[prio] = max;
+            }
+            result->numOverflow[prio] = epicsAtomicGetIntT(&mySet->queueOverflows);
         }
         ret = 0;
     } else {
@@ -128,12 +390,72 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            int i;
+
+            for (i = 0; i < mySet->threadsConfigured; i++)
+                epicsAtomicSetIntT(&mySet->workers[i].maxUsed, 0);
         }
     }
     return ret;
 }
 
+int callbackQueueWorkerStatus(int priority, const int reset,
+    callbackWorkerStats *result, int count)
+{
+    cbQueueSet *mySet;
+    int i;
+
+    if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
+    if (priority < 0 || priority >= NUM_CALLBACK_PRIORITIES) return -2;
+    mySet = &callbackQueue[priority];
+
+    for (i = 0; i < mySet->threadsConfigured; i++) {
+        cbWorker *worker = &mySet->workers[i];
+
+        if (result && i < count) {
+            int used = epicsAtomicGetIntT(&worker->numUsed);
+
+            result[i].size = (int) cbWorkerSize(worker);
+            result[i].numUsed = used > 0 ? used : 0;
+            result[i].maxUsed = epicsAtomicGetIntT(&worker->maxUsed);
+            result[i].numGrown = epicsAtomicGetIntT(&worker->numGrown);
+            result[i].numRun = worker->numRun;
+            result[i].numStolen = worker->numStolen;
+        }
+        if (reset)
+            epicsAtomicSetIntT(&worker->maxUsed, 0);
+    }
+    return mySet->threadsConfigured;
+}
+
+/* Time spent queued, collected while dbProcStatsActive is set */
+static void callbackWaitShow(const int reset)
+{
+    int prio, header = FALSE;
+
+    for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+        cbQueueSet *mySet = &callbackQueue[prio];
+        dbProcHist waits;
+        int i;
+
+        memset(&waits, 0, sizeof(waits));
+        for (i = 0; i < mySet->threadsConfigured; i++) {
+            dbProcHistMerge(&waits, &mySet->workers[i].waits);
+            if (reset)
+                epicsAtomicSetIntT(&mySet->workers[i].waitsReset, 1);
+        }
+        if (!waits.count)
+            continue;
+        if (!header) {
+            printf("\nPRIORITY  TIME QUEUED IN MICROSECONDS\n");
+            header = TRUE;
+        }
+        printf("%8s  ", threadNamePrefix[prio]);
+        dbProcHistShow(&waits);
+    }
+}
+
 void callbackQueueShow(const int reset)
 {
     callbackQueueStats stats;
@@ -142,13 +464,45 @@ void callbackQueueShow(const int reset)
             "iocInit before using this command.\n");
     } else {
         int prio;
+        int parallel = FALSE;
+
         printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS\n");
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            double qusage = 100.0 * stats.numUsed[prio] / stats.size;
+            int nthreads = callbackQueue[prio].threadsConfigured;
+            double qusage = 100.0 * stats.numUsed[prio] / stats.size / nthreads;
             printf("%8s  %15d  %10d  %6d  %6.1f  %11d\n",
                    threadNamePrefix[prio], stats.maxUsed[prio],
                    stats.numUsed[prio], stats.size, qusage,
                    stats.numOverflow[prio]);
+            if (nthreads > 1)
+                parallel = TRUE;
+        }
+        callbackWaitShow(reset);
+        if (!parallel)
+            return;
+
+        printf("\n  THREAD  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  GROWN"
+               "         RUN      STOLEN\n");
+        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+            int nthreads = callbackQueue[prio].threadsConfigured;
+            callbackWorkerStats *wstats;
+            int i;
+
+            if (nthreads < 2)
+                continue;
+            wstats = callocMustSucceed(nthreads, sizeof(*wstats),
+                "callbackQueueShow");
+            nthreads = callbackQueueWorkerStatus(prio, 0, wstats, nthreads);
+            for (i = 0; i < nthreads; i++) {
+                char name[32];
+
+                sprintf(name, "%s-%d", threadNamePrefix[prio], i);
+                printf("%8s  %15d  %10d  %6d  %5d  %10lu  %10lu\n",
+                       name, wstats[i].maxUsed, wstats[i].numUsed,
+                       wstats[i].size, wstats[i].numGrown,
+                       wstats[i].numRun, wstats[i].numStolen);
+            }
+            free(wstats);
         }
     }
 }
@@ -205,24 +559,32 @@ found:
 
 static void callbackTask(void *arg)
 {
-    int prio = *(int*)arg;
-    cbQueueSet *mySet = &callbackQueue[prio];
+    cbWorker *me = (cbWorker *)arg;
+    cbQueueSet *mySet = me->set;
 
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
-        void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
-            epicsEventMustWait(mySet->semWakeUp);
+        /* Producers signal semWakeUp after completing a push, so
+         * sleeping whenever nothing could be taken can't miss work.
+         */
+        epicsUInt64 queued;
+        epicsCallback *pcallback = cbSetTake(mySet, me, &queued);
 
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
-            epicsCallback *pcallback = (epicsCallback *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
-                epicsEventMustTrigger(mySet->semWakeUp);
-            mySet->queueOverflow = FALSE;
-            (*pcallback->callback)(pcallback);
+        if (!pcallback) {
+            epicsEventMustWait(mySet->semWakeUp);
+            continue;
         }
+        if (cbSetPending(mySet))
+            epicsEventMustTrigger(mySet->semWakeUp);
+        mySet->queueOverflow = FALSE;
+        me->numRun++;
+        if (epicsAtomicCmpAndSwapIntT(&me->waitsReset, 1, 0))
+            memset(&me->waits, 0, sizeof(me->waits));
+        if (queued)
+            dbProcHistAdd(&me->waits, epicsMonotonicGet() - queued);
+        (*pcallback->callback)(pcallback);
     }
 
     if(!epicsAtomicDecrIntT(&mySet->threadsRunning))
@@ -250,7 +612,7 @@ void callbackStop(void)
             epicsEventWaitWithTimeout(startStopEvent, 0.1);
         }
         for(j=0; j<mySet->threadsConfigured; j++) {
-            epicsThreadMustJoin(mySet->threads[j]);
+            epicsThreadMustJoin(mySet->workers[j].tid);
         }
     }
 }
@@ -265,14 +627,22 @@ void callbackCleanup(void)
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         cbQueueSet *mySet = &callbackQueue[i];
+        int j;
 
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
         epicsEventDestroy(mySet->semWakeUp);
         mySet->semWakeUp = NULL;
-        epicsRingPointerDelete(mySet->queue);
-        mySet->queue = NULL;
-        free(mySet->threads);
-        mySet->threads = NULL;
+        for (j = 0; j < mySet->threadsConfigured; j++) {
+            cbSegment *seg = mySet->workers[j].first;
+
+            while (seg) {
+                cbSegment *next = seg->next;
+                free(seg);
+                seg = next;
+            }
+        }
+        free(mySet->workers);
+        mySet->workers = NULL;
     }
 
     epicsTimerQueueRelease(timerQueue);
@@ -283,6 +653,7 @@ void callbackInit(void)
 {
     int i;
     int j;
+    size_t qsize;
     char threadName[32];
 
     if (epicsAtomicCmpAndSwapIntT(&cbState, cbInit, cbRun)!=cbInit) {
@@ -299,19 +670,33 @@ void callbackInit(void)
         epicsThreadId tid;
 
         callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
-        if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
-                threadNamePrefix[i]);
         callbackQueue[i].queueOverflow = FALSE;
 
         if (callbackQueue[i].threadsConfigured == 0)
             callbackQueue[i].threadsConfigured = callbackThreadsDefault;
 
-        callbackQueue[i].threads = callocMustSucceed(callbackQueue[i].threadsConfigured,
-                                                     sizeof(*callbackQueue[i].threads),
+        /* The threads share the configured size, each queue is rounded
+         * up to a power of two */
+        for (qsize = 2; qsize * callbackQueue[i].threadsConfigured <
+                 callbackQueueSize; qsize *= 2)
+            ;
+
+        callbackQueue[i].workers = callocMustSucceed(callbackQueue[i].threadsConfigured,
+                                                     sizeof(*callbackQueue[i].workers),
                                                      "callbackInit");
 
+        for (j = 0; j < callbackQueue[i].threadsConfigured; j++) {
+            cbWorker *worker = &callbackQueue[i].workers[j];
+
+            worker->set = &callbackQueue[i];
+            worker->index = j;
+            worker->first = cbSegmentCreate(qsize, 0);
+            if (!worker->first)
+                cantProceed("callbackInit: queue allocation failed for %s\n",
+                    threadNamePrefix[i]);
+            worker->popSeg = worker->pushSeg = worker->first;
+        }
+
         for (j = 0; j < callbackQueue[i].threadsConfigured; j++) {
             epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
             opts.joinable = 1;
@@ -321,8 +706,8 @@ void callbackInit(void)
                 sprintf(threadName, "%s-%d", threadNamePrefix[i], j);
             else
                 strcpy(threadName, threadNamePrefix[i]);
-            callbackQueue[i].threads[j] = tid = epicsThreadCreateOpt(threadName,
-                (EPICSTHREADFUNC)callbackTask, &priorityValue[i], &opts);
+            callbackQueue[i].workers[j].tid = tid = epicsThreadCreateOpt(threadName,
+                (EPICSTHREADFUNC)callbackTask, &callbackQueue[i].workers[j], &opts);
             if (tid == 0) {
                 cantProceed("Failed to spawn callback thread %s\n", threadName);
             } else {
@@ -339,6 +724,7 @@ int callbackRequest(epicsCallback *pcallback)
     int priority;
     int pushOK;
     cbQueueSet *mySet;
+    cbWorker *worker;
 
     if (!pcallback) {
         epicsInterruptContextMessage("callbackRequest: " ERL_ERROR " pcallback was NULL\n");
@@ -354,13 +740,20 @@ int callbackRequest(epicsCallback *pcallback)
         return S_db_badChoice;
     }
     mySet = &callbackQueue[priority];
-    if (!mySet->queue) {
+    if (!mySet->workers) {
         epicsInterruptContextMessage("callbackRequest: " ERL_ERROR " Callbacks not initialized\n");
         return S_db_notInit;
     }
     if (mySet->queueOverflow) return S_db_bufFull;
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    worker = &mySet->workers[0];
+    if (mySet->threadsConfigured > 1)
+        worker += epicsAtomicIncrSizeT(&mySet->nextWorker) % mySet->threadsConfigured;
+    if (epicsInterruptIsInterruptContext())
+        pushOK = cbWorkerPush(worker, pcallback, 0, FALSE);
+    else
+        pushOK = cbWorkerPush(worker, pcallback,
+            dbProcStatsActive ? epicsMonotonicGet() : 0, TRUE);
 
     if (!pushOK) {
         epicsInterruptContextMessage(fullMessage[priority]);
@@ -58,6 +58,16 @@ typedef struct callbackQueueStats {
     int numOverflow[NUM_CALLBACK_PRIORITIES];
 } callbackQueueStats;
 
+/* Statistics for the queue of one callback thread */
+typedef struct callbackWorkerStats {
+    int size;       /* current capacity, grows when the queue fills */
+    int numUsed;
+    int maxUsed;
+    int numGrown;
+    unsigned long numRun;    /* callbacks executed by this thread */
+    unsigned long numStolen; /* of those, taken from other threads' queues */
+} callbackWorkerStats;
+
 #define callbackSetCallback(PFUN, PCALLBACK) \
     ( (PCALLBACK)->callback = (PFUN) )
 #define callbackSetPriority(PRIORITY, PCALLBACK) \
@@ -84,6 +94,8 @@ DBCORE_API void callbackRequestProcessCallbackDelayed(
     epicsCallback *pCallback, int Priority, void *pRec, double seconds);
 DBCORE_API int callbackSetQueueSize(int size);
 DBCORE_API int callbackQueueStatus(const int reset, callbackQueueStats *result);
+DBCORE_API int callbackQueueWorkerStatus(int priority, const int reset,
+    callbackWorkerStats *result, int count);
 DBCORE_API void callbackQueueShow(const int reset);
 DBCORE_API int callbackParallelThreads(int count, const char *prio);
 
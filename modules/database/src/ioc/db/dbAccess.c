@@ -51,6 +51,7 @@
 #include "dbLink.h"
 #include "dbLockPvt.h"
 #include "dbNotify.h"
+#include "dbProcStats.h"
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbStaticLib.h"
@@ -580,12 +581,16 @@ long dbProcess(dbCommon *precord)
         precord->stat = DISABLE_ALARM;
         precord->nsev = 0;
         precord->nsta = 0;
-        db_post_events(precord, &precord->stat, DBE_VALUE);
-        db_post_events(precord, &precord->sevr, DBE_VALUE);
         pdbFldDes = pdbRecordType->papFldDes[pdbRecordType->indvalFlddes];
-        db_post_events(precord,
-                (void *)(((char *)precord) + pdbFldDes->offset),
-                DBE_VALUE|DBE_ALARM);
+        {
+            void *fields[3];
+            unsigned masks[3] = {DBE_VALUE, DBE_VALUE, DBE_VALUE|DBE_ALARM};
+
+            fields[0] = &precord->stat;
+            fields[1] = &precord->sevr;
+            fields[2] = ((char *)precord) + pdbFldDes->offset;
+            db_post_events_many(precord, fields, masks, 3);
+        }
         goto all_done;
     }
 
@@ -605,7 +610,14 @@ long dbProcess(dbCommon *precord)
         printf("%s: dbProcess of '%s'\n", context, precord->name);
 
     /* process record */
-    status = prset->process(precord);
+    if (dbProcStatsActive) {
+        epicsUInt64 start = epicsMonotonicGet();
+
+        status = prset->process(precord);
+        dbProcStatsAdd(precord, epicsMonotonicGet() - start);
+    }
+    else
+        status = prset->process(precord);
 
     /* Print record's fields if PRINT_MASK set in breakpoint field */
     if (lset_stack_count != 0) {
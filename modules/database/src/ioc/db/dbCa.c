@@ -27,6 +27,7 @@
 #include "epicsExit.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
+#include "epicsStdio.h"
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsAtomic.h"
@@ -34,6 +35,7 @@
 #include "errlog.h"
 #include "errMdef.h"
 #include "taskwd.h"
+#include "epicsExport.h"
 
 #include "cadef.h"
 
@@ -61,18 +63,21 @@
 extern void dbServiceIOInit();
 extern int dbServiceIsolate;
 
-static ELLLIST workList = ELLLIST_INIT;    /* Work list for dbCaTask */
-static epicsMutexId workListLock; /*Mutual exclusions semaphores for workList*/
-static epicsEventId workListEvent; /*wakeup event for dbCaTask*/
-static int removesOutstanding = 0;
+/* Number of dbCaTask threads started by the next iocInit */
+int dbCaLinkThreads = 1;
+epicsExportAddress(int, dbCaLinkThreads);
+
+dbCaWorker *dbCaWorkers;    /* Each has a work list and a dbCaTask */
+int dbCaNWorkers;
+/* caLinks not yet freed, each pointing to its worker.  Use atomic */
+static int dbCaNLinks;
 #define removesOutstandingWarning 10000
 
 static volatile enum dbCaCtl_t {
     ctlInit, ctlRun, ctlPause, ctlExit
 } dbCaCtl;
-static epicsEventId startStopEvent;
-static epicsThreadId dbCaWorker;
 
+/* Context of the first worker */
 struct ca_client_context * dbCaClientContext;
 
 /* Forward declarations */
@@ -84,15 +89,19 @@ static lset dbCa_lset;
     errlogPrintf("%s has DB CA link to %s\n",\
         pcaLink->plink->precord->name, pcaLink->pvname)
 
-static int dbca_chan_count;
-
 /* caLink locking
  *
  * Lock ordering:
  *  dbScanLock -> caLink.lock -> workListLock
  *
  * workListLock:
- *   Guards access to workList.
+ *   Guards access to the workList of one dbCaWorker, and link_action of the
+ *   caLinks serviced by that worker.
+ *
+ * Each link is serviced by one worker for its lifetime, chosen by the
+ * record name of its target, and each worker has its own CA client context.
+ * So all CA calls for a channel are made from the same thread, and the libca
+ * callbacks for links serviced by different workers may run concurrently.
  *
  * dbScanLock:
  *   All dbCa* functions operating on a single link may only be called when
@@ -110,12 +119,12 @@ static int dbca_chan_count;
  * caLink.lock:
  *   Guards the caLink structure (but not the struct DBLINK)
  *
- * The dbCaTask only locks caLink, and must not lock the record (a violation of lock order).
+ * A dbCaTask only locks caLink, and must not lock the record (a violation of lock order).
  *
  * During link modification or IOC shutdown the pca->plink pointer (guarded by caLink.lock)
  * is used as a flag to indicate that a link is no longer active.
  *
- * References to the struct caLink are owned by the dbCaTask, and any scanOnceCallback()
+ * References to the struct caLink are owned by its dbCaTask, and any scanOnceCallback()
  * which is in progress.
  *
  * The libca and scanOnceCallback callbacks take no action if pca->plink==NULL.
@@ -130,9 +139,10 @@ static int dbca_chan_count;
 
 static void addAction(caLink *pca, short link_action)
 {
+    dbCaWorker *pw = pca->worker;
     int callAdd;
 
-    epicsMutexMustLock(workListLock);
+    epicsMutexMustLock(pw->workListLock);
     callAdd = (pca->link_action == 0);
     if (pca->link_action & CA_CLEAR_CHANNEL) {
         errlogPrintf("dbCa::addAction %d with CA_CLEAR_CHANNEL set\n",
@@ -141,22 +151,32 @@ static void addAction(caLink *pca, short link_action)
         link_action = 0;
     }
     if (link_action & CA_CLEAR_CHANNEL) {
-        if (++removesOutstanding >= removesOutstandingWarning) {
+        if (++pw->removesOutstanding >= removesOutstandingWarning) {
             errlogPrintf("dbCa::addAction pausing, %d channels to clear\n",
-                removesOutstanding);
+                pw->removesOutstanding);
         }
-        while (removesOutstanding >= removesOutstandingWarning) {
-            epicsMutexUnlock(workListLock);
+        while (pw->removesOutstanding >= removesOutstandingWarning) {
+            epicsMutexUnlock(pw->workListLock);
             epicsThreadSleep(1.0);
-            epicsMutexMustLock(workListLock);
+            epicsMutexMustLock(pw->workListLock);
         }
     }
     pca->link_action |= link_action;
     if (callAdd)
-        ellAdd(&workList, &pca->node);
-    epicsMutexUnlock(workListLock);
+        ellAdd(&pw->workList, &pca->node);
+    epicsMutexUnlock(pw->workListLock);
     if (callAdd)
-        epicsEventSignal(workListEvent);
+        epicsEventSignal(pw->workListEvent);
+}
+
+/* Links to fields of the same record share a worker, and so a circuit */
+static dbCaWorker * pickWorker(const char *pvname)
+{
+    size_t len = strcspn(pvname, ". ");
+
+    if (dbCaNWorkers <= 1)
+        return dbCaWorkers;
+    return &dbCaWorkers[epicsMemHash(pvname, len, 0) % dbCaNWorkers];
 }
 
 static void caLinkInc(caLink *pca)
@@ -178,7 +198,7 @@ static void caLinkDec(caLink *pca)
 
     if (pca->chid) {
         ca_clear_channel(pca->chid);
-        --dbca_chan_count;
+        --pca->worker->chanCount;
     }
     callback = pca->putCallback;
     if (callback) {
@@ -193,6 +213,7 @@ static void caLinkDec(caLink *pca)
     free(pca->pvname);
     epicsMutexDestroy(pca->lock);
     free(pca);
+    epicsAtomicDecrIntT(&dbCaNLinks);
     if (callback) callback(userPvt);
 }
 
@@ -263,10 +284,10 @@ void testdbCaWaitForUpdateCount(DBLINK *plink, unsigned long cnt)
     testdbCaWaitForEvent(plink, cnt, testEventCount);
 }
 
-/* Block until worker thread has processed all previously queued actions.
+/* Block until worker threads have processed all previously queued actions.
  * Does not prevent additional actions from being queued.
  */
-void dbCaSync(void)
+static void dbCaSyncWorker(dbCaWorker *pw)
 {
     epicsEventId wake;
     caLink templink;
@@ -277,6 +298,7 @@ void dbCaSync(void)
      */
     memset(&templink, 0, sizeof(templink));
     templink.refcount = 1;
+    templink.worker = pw;
 
     wake = epicsEventMustCreate(epicsEventEmpty);
     templink.lock = epicsMutexMustCreate();
@@ -290,8 +312,8 @@ void dbCaSync(void)
      * we cycle through workListLock to ensure worker call to
      * epicsEventMustTrigger() returns before we destroy the event.
      */
-    epicsMutexMustLock(workListLock);
-    epicsMutexUnlock(workListLock);
+    epicsMutexMustLock(pw->workListLock);
+    epicsMutexUnlock(pw->workListLock);
 
     assert(templink.refcount==1);
 
@@ -299,6 +321,14 @@ void dbCaSync(void)
     epicsEventDestroy(wake);
 }
 
+void dbCaSync(void)
+{
+    int i;
+
+    for (i = 0; i < dbCaNWorkers; i++)
+        dbCaSyncWorker(&dbCaWorkers[i]);
+}
+
 void dbCaCallbackProcess(void *userPvt)
 {
     struct link *plink = (struct link *)userPvt;
@@ -306,20 +336,55 @@ void dbCaCallbackProcess(void *userPvt)
     dbLinkAsyncComplete(plink);
 }
 
+static void signalWorkers(void)
+{
+    int i;
+
+    for (i = 0; i < dbCaNWorkers; i++)
+        epicsEventSignal(dbCaWorkers[i].workListEvent);
+}
+
 void dbCaShutdown(void)
 {
     enum dbCaCtl_t cur = dbCaCtl;
+    int i;
+
     assert(cur == ctlRun || cur == ctlPause);
     dbCaCtl = ctlExit;
-    epicsEventSignal(workListEvent);
-    epicsEventMustWait(startStopEvent);
-    if(dbCaWorker)
-        epicsThreadMustJoin(dbCaWorker);
+    signalWorkers();
+    for (i = 0; i < dbCaNWorkers; i++) {
+        dbCaWorker *pw = &dbCaWorkers[i];
+
+        epicsEventMustWait(pw->startStopEvent);
+        if (pw->thread)
+            epicsThreadMustJoin(pw->thread);
+        pw->thread = NULL;
+    }
+    dbCaClientContext = NULL;
+}
+
+static void freeWorkers(void)
+{
+    int i;
+
+    for (i = 0; i < dbCaNWorkers; i++) {
+        dbCaWorker *pw = &dbCaWorkers[i];
+
+        assert(ellCount(&pw->workList) == 0 && !pw->thread);
+        epicsMutexDestroy(pw->workListLock);
+        epicsEventDestroy(pw->workListEvent);
+        epicsEventDestroy(pw->startStopEvent);
+    }
+    free(dbCaWorkers);
+    dbCaWorkers = NULL;
+    dbCaNWorkers = 0;
 }
 
 static void dbCaLinkInitImpl(int isolate)
 {
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    int nWorkers = dbCaLinkThreads;
+    int i;
 
     opts.stackSize = epicsThreadGetStackSize(epicsThreadStackBig);
     opts.priority = epicsThreadPriorityMedium;
@@ -328,18 +393,51 @@ static void dbCaLinkInitImpl(int isolate)
     dbServiceIsolate = isolate;
     dbServiceIOInit();
 
-    if (!workListLock)
-        workListLock = epicsMutexMustCreate();
-    if (!workListEvent)
-        workListEvent = epicsEventMustCreate(epicsEventEmpty);
+    if (nWorkers <= 0)
+        nWorkers = epicsThreadGetCPUs();
 
-    if(!startStopEvent)
-        startStopEvent = epicsEventMustCreate(epicsEventEmpty);
+    /* Workers are kept after dbCaShutdown() in case links get removed late,
+     * and can only be replaced once no caLink points to them.
+     */
+    if (dbCaWorkers && dbCaNWorkers != nWorkers) {
+        int nLinks = epicsAtomicGetIntT(&dbCaNLinks);
+
+        if (nLinks == 0) {
+            freeWorkers();
+        }
+        else {
+            errlogPrintf("dbCaLinkInit: %d CA links remain, "
+                "keeping %d link threads\n", nLinks, dbCaNWorkers);
+            nWorkers = dbCaNWorkers;
+        }
+    }
+    if (!dbCaWorkers) {
+        dbCaWorkers = dbCalloc(nWorkers, sizeof(dbCaWorker));
+        dbCaNWorkers = nWorkers;
+        for (i = 0; i < nWorkers; i++) {
+            dbCaWorker *pw = &dbCaWorkers[i];
+
+            ellInit(&pw->workList);
+            pw->workListLock = epicsMutexMustCreate();
+            pw->workListEvent = epicsEventMustCreate(epicsEventEmpty);
+            pw->startStopEvent = epicsEventMustCreate(epicsEventEmpty);
+        }
+    }
     dbCaCtl = ctlPause;
 
-    dbCaWorker = epicsThreadCreateOpt("dbCaLink", dbCaTask, NULL, &opts);
-    /* wait for worker to startup and initialize dbCaClientContext */
-    epicsEventMustWait(startStopEvent);
+    for (i = 0; i < nWorkers; i++) {
+        dbCaWorker *pw = &dbCaWorkers[i];
+        char name[20];
+
+        if (nWorkers == 1)
+            strcpy(name, "dbCaLink");
+        else
+            epicsSnprintf(name, sizeof(name), "dbCaLink-%d", i);
+        pw->thread = epicsThreadCreateOpt(name, dbCaTask, pw, &opts);
+        /* wait for worker to startup and initialize its context */
+        epicsEventMustWait(pw->startStopEvent);
+    }
+    dbCaClientContext = dbCaWorkers[0].context;
 }
 
 void dbCaLinkInitIsolated(void)
@@ -356,7 +454,7 @@ void dbCaRun(void)
 {
     if (dbCaCtl == ctlPause) {
         dbCaCtl = ctlRun;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -364,7 +462,7 @@ void dbCaPause(void)
 {
     if (dbCaCtl == ctlRun) {
         dbCaCtl = ctlPause;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -380,6 +478,8 @@ void dbCaAddLinkCallback(struct link *plink,
     pca->lock = epicsMutexMustCreate();
     pca->plink = plink;
     pca->pvname = epicsStrDup(plink->value.pv_link.pvname);
+    pca->worker = pickWorker(pca->pvname);
+    epicsAtomicIncrIntT(&dbCaNLinks);
     pca->connect = connect;
     pca->monitor = monitor;
     pca->userPvt = userPvt;
@@ -1116,33 +1216,34 @@ static void getAttribEventCallback(struct event_handler_args arg)
 
 static void dbCaTask(void *arg)
 {
+    dbCaWorker *pw = arg;
     epicsEventId requestSync = NULL;
     taskwdInsert(0, NULL, NULL);
     SEVCHK(ca_context_create(ca_enable_preemptive_callback),
         "dbCaTask calling ca_context_create");
-    dbCaClientContext = ca_current_context ();
+    pw->context = ca_current_context ();
     SEVCHK(ca_add_exception_event(exceptionCallback,NULL),
         "ca_add_exception_event");
-    epicsEventSignal(startStopEvent);
+    epicsEventSignal(pw->startStopEvent);
 
     /* channel access event loop */
     while (TRUE){
         do {
-            epicsEventMustWait(workListEvent);
+            epicsEventMustWait(pw->workListEvent);
         } while (dbCaCtl == ctlPause);
         while (TRUE) { /* process all requests in workList*/
             caLink *pca;
             short  link_action;
             int    status;
 
-            epicsMutexMustLock(workListLock);
-            if (!(pca = (caLink *)ellGet(&workList))){  /* Take off list head */
+            epicsMutexMustLock(pw->workListLock);
+            if (!(pca = (caLink *)ellGet(&pw->workList))){  /* Take off list head */
                 if(requestSync) {
                     /* dbCaSync() requires workListLock to be held here */
                     epicsEventMustTrigger(requestSync);
                     requestSync = NULL;
                 }
-                epicsMutexUnlock(workListLock);
+                epicsMutexUnlock(pw->workListLock);
                 if (dbCaCtl == ctlExit) goto shutdown;
                 break; /* workList is empty */
             }
@@ -1152,8 +1253,8 @@ static void dbCaTask(void *arg)
                 requestSync = pca->userPvt;
             }
             pca->link_action = 0;
-            if (link_action & CA_CLEAR_CHANNEL) --removesOutstanding;
-            epicsMutexUnlock(workListLock);         /* Give back immediately */
+            if (link_action & CA_CLEAR_CHANNEL) --pw->removesOutstanding;
+            epicsMutexUnlock(pw->workListLock);     /* Give back immediately */
             if (link_action&CA_SYNC)
                 continue;
             if (link_action & CA_CLEAR_CHANNEL) {   /* This must be first */
@@ -1171,7 +1272,7 @@ static void dbCaTask(void *arg)
                     printLinks(pca);
                     continue;
                 }
-                dbca_chan_count++;
+                pw->chanCount++;
                 status = ca_replace_access_rights_event(pca->chid,
                     accessRightsCallback);
                 if (status != ECA_NORMAL) {
@@ -1275,9 +1376,10 @@ static void dbCaTask(void *arg)
     }
 shutdown:
     taskwdRemove(0);
-    if (dbca_chan_count == 0)
+    if (pw->chanCount == 0)
         ca_context_destroy();
     else
-        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n", dbca_chan_count);
-    epicsEventSignal(startStopEvent);
+        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n", pw->chanCount);
+    pw->context = NULL;
+    epicsEventSignal(pw->startStopEvent);
 }
@@ -27,6 +27,13 @@ DBCORE_API void dbCaRun(void);
 DBCORE_API void dbCaPause(void);
 DBCORE_API void dbCaShutdown(void);
 
+/* Number of CA link worker threads, each with its own CA client context,
+ * started by dbCaLinkInit().  Zero or less means one per CPU core.
+ * A change after the first iocInit() is ignored while any CA link of the
+ * previous IOC has not yet been freed.
+ */
+DBCORE_API extern int dbCaLinkThreads;
+
 struct dbLocker;
 DBCORE_API void dbCaAddLinkCallback(struct link *plink,
     dbCaCallback connect, dbCaCallback monitor, void *userPvt);
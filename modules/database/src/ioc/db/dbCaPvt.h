@@ -18,7 +18,9 @@
 
 #include "dbCa.h"
 #include "ellLib.h"
+#include "epicsEvent.h"
 #include "epicsMutex.h"
+#include "epicsThread.h"
 #include "epicsTypes.h"
 #include "link.h"
 
@@ -35,11 +37,28 @@
 #define CA_PUT          0x1
 #define CA_PUT_CALLBACK 0x2
 
+/* One link worker thread, with its own CA client context */
+typedef struct dbCaWorker
+{
+    ELLLIST         workList;       /* caLinks with pending link_action */
+    epicsMutexId    workListLock;   /* guards workList and link_action */
+    epicsEventId    workListEvent;  /* wakes the worker */
+    epicsEventId    startStopEvent;
+    epicsThreadId   thread;
+    struct ca_client_context *context;
+    int             removesOutstanding;
+    int             chanCount;
+} dbCaWorker;
+
+extern dbCaWorker *dbCaWorkers;
+extern int dbCaNWorkers;
+
 typedef struct caLink
 {
     ELLNODE         node;
     int             refcount;
     epicsMutexId    lock;
+    dbCaWorker      *worker;    /* services this link, chosen by pvname */
     struct link     *plink;
     char            *pvname;
     chid            chid;
@@ -154,8 +154,16 @@ done:
            nDisconnect, nNoWrite);
     dbFinishEntry(pdbentry);
 
-    if ( level > 2  && dbCaClientContext != 0 ) {
-        ca_context_status ( dbCaClientContext, level - 2 );
+    if ( level > 2 ) {
+        int i;
+
+        for ( i = 0; i < dbCaNWorkers; i++ ) {
+            if ( dbCaWorkers[i].context ) {
+                if ( dbCaNWorkers > 1 )
+                    printf ( "dbCaLink-%d:\n", i );
+                ca_context_status ( dbCaWorkers[i].context, level - 2 );
+            }
+        }
     }
 
     return(0);
@@ -54,10 +54,14 @@ struct evSubscrip {
     void              * user_arg;
     /* associated queue, may be shared with other evSubscrip */
     struct event_que  * ev_que;
-    /* NULL if !npend.  if npend!=0, pointer to last event added to event_que::valque */
-    db_field_log     ** pLastLog;
-    /* n times this event is on the queue */
-    unsigned long       npend;
+    /* if npend!=0, index of the last event added to event_que::valque */
+    unsigned short      lastix;
+    /* if npend!=0, whether that event holds a copy of the value */
+    char                lastHasCopy;
+    /* if npend!=0, whether that event holds a shared array snapshot */
+    char                lastIsShared;
+    /* n times this event is on the queue (atomic) */
+    int                 npend;
     /* n times replacing event on the queue */
     unsigned long       nreplace;
     /* DBE mask */
@@ -6,6 +6,7 @@
 #include "dbCommon.h"
 
 struct epicsThreadOSD;
+struct dbRecProcStats;
 
 /** Base internal additional information for every record
  */
@@ -15,6 +16,10 @@ typedef struct dbCommonPvt {
     /* Thread which is currently processing this record */
     struct epicsThreadOSD* procThread;
 
+    /* Processing times, only allocated while they are being collected,
+     * see dbProcStats.c */
+    struct dbRecProcStats *procStats;
+
     struct dbCommon common;
 } dbCommonPvt;
 
@@ -60,6 +60,14 @@ static void copyNoConvert(const void *pfrom,
 #define COPYNOCONVERT(N, FROM, TO, NREQ, NO_ELEM, OFFSET) \
     copyNoConvert(FROM, TO, (N)*(NREQ), (N)*(NO_ELEM), (N)*(OFFSET))
 
+/* Number of elements which can be converted before wrapping around
+ * the end of a circular buffer.  Converting such runs in a simple loop
+ * lets the compiler vectorize it.
+ */
+#define CONVERTRUN(NREQ, NO_ELEM, OFFSET) \
+    ((OFFSET) < (NO_ELEM) && (NO_ELEM) - (OFFSET) < (NREQ) ? \
+        (NO_ELEM) - (OFFSET) : (NREQ))
+
 #define GET(typea, typeb) (const dbAddr *paddr, \
     void *pto, long nRequest, long no_elements, long offset) \
 { \
@@ -71,10 +79,14 @@ static void copyNoConvert(const void *pfrom,
         return 0; \
     } \
     psrc += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            psrc = (typea *) paddr->pfield; \
+    while (nRequest > 0) { \
+        long i, n = CONVERTRUN(nRequest, no_elements, offset); \
+        for (i = 0; i < n; i++) \
+            pdst[i] = (typeb) psrc[i]; \
+        pdst += n; \
+        nRequest -= n; \
+        psrc = (typea *) paddr->pfield; \
+        offset = 0; \
     } \
     return 0; \
 }
@@ -104,10 +116,14 @@ static void copyNoConvert(const void *pfrom,
         return 0; \
     } \
     pdst += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            pdst = (typeb *) paddr->pfield; \
+    while (nRequest > 0) { \
+        long i, n = CONVERTRUN(nRequest, no_elements, offset); \
+        for (i = 0; i < n; i++) \
+            pdst[i] = (typeb) psrc[i]; \
+        psrc += n; \
+        nRequest -= n; \
+        pdst = (typeb *) paddr->pfield; \
+        offset = 0; \
     } \
     return 0; \
 }
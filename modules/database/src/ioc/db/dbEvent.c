@@ -29,6 +29,7 @@
 #include "cantProceed.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsThread.h"
@@ -44,6 +45,7 @@
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
+#include "dbExtractArray.h"
 #include "db_field_log.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
@@ -60,22 +62,32 @@
 #define EVENTENTRIES    4      /* the number of que entries for each event */
 #define EVENTQUESIZE    (EVENTENTRIES  * EVENTSPERQUE)
 #define EVENTQEMPTY     ((struct evSubscrip *)NULL)
+#define EVENTQBUSY      ((struct evSubscrip *)&eventQueBusy)
 
 /*
- * really a ring buffer
+ * A multi-producer, single consumer ring buffer.
+ *
+ * Posting threads never take a lock.  An entry is reserved by
+ * incrementing nQueued, a slot is claimed by advancing putix, and
+ * the entry is published by storing the subscription into evque[].
+ * Only the event task consumes, from getix.  While an entry is being
+ * replaced (by its poster) or removed (by the event task) its evque[]
+ * slot holds EVENTQBUSY, which makes the two mutually exclusive.
+ *
+ * writelock now only serializes the event task with the control
+ * operations (db_add_event() quota, db_cancel_event(), dbel()).
  */
 struct event_que {
-    /* lock writers to the ring buffer only */
-    /* readers must never slow up writers */
     epicsMutexId            writelock;
     db_field_log            *valque[EVENTQUESIZE];
-    struct evSubscrip       *evque[EVENTQUESIZE];
+    struct evSubscrip       *evque[EVENTQUESIZE];   /* atomic */
     struct event_que        *nextque;       /* in case que quota exceeded */
     struct event_user       *evUser;        /* event user parent struct */
-    unsigned short          putix;
-    unsigned short          getix;
+    int                     putix;          /* atomic, next slot to claim */
+    unsigned short          getix;          /* event task only */
     unsigned short          quota;          /* the number of assigned entries*/
-    unsigned short          nDuplicates;    /* N events duplicated on this q */
+    int                     nQueued;        /* atomic, reserved entries */
+    int                     nDuplicates;    /* atomic, N events duplicated on this q */
     unsigned                possibleStall;
 };
 
@@ -87,6 +99,7 @@ struct event_user {
     epicsMutexId        lock;
     epicsEventId        ppendsem;       /* Wait while empty */
     epicsEventId        pexitsem;       /* wait for event task to join */
+    epicsEventId        pbatchsem;      /* wait for batchRefs to drop */
 
     EXTRALABORFUNC      *extralabor_sub;/* off load to event task */
     void                *extralabor_arg;/* parameter to above */
@@ -98,6 +111,9 @@ struct event_user {
     unsigned char       extra_labor;    /* if set call extra labor func */
     unsigned char       flowCtrlMode;   /* replace existing monitor */
     unsigned char       extraLaborBusy;
+    int                 idle;           /* atomic, event task may be waiting */
+    int                 batchRefs;      /* batches holding a wake, atomic
+                                           but dropped under lock */
     void                (*init_func)();
     epicsThreadId       init_func_arg;
 };
@@ -116,6 +132,15 @@ typedef struct {
 #define RNGINC(OLD)\
 ( (unsigned short) ( (OLD) >= (EVENTQUESIZE-1) ? 0 : (OLD)+1 ) )
 
+#define EVQGET(EV_QUE, IX) \
+    ((struct evSubscrip *) epicsAtomicGetPtrT ( \
+        (EpicsAtomicPtrT *) &(EV_QUE)->evque[IX] ))
+#define EVQSET(EV_QUE, IX, PEV) \
+    epicsAtomicSetPtrT ( (EpicsAtomicPtrT *) &(EV_QUE)->evque[IX], (PEV) )
+#define EVQCAS(EV_QUE, IX, OLD, NEW) \
+    ((struct evSubscrip *) epicsAtomicCmpAndSwapPtrT ( \
+        (EpicsAtomicPtrT *) &(EV_QUE)->evque[IX], (OLD), (NEW) ))
+
 #define LOCKEVQUE(EV_QUE)   epicsMutexMustLock((EV_QUE)->writelock)
 #define UNLOCKEVQUE(EV_QUE) epicsMutexUnlock((EV_QUE)->writelock)
 #define LOCKREC(RECPTR)     epicsMutexMustLock((RECPTR)->mlok)
@@ -126,22 +151,50 @@ static void *dbevEventQueueFreeList;
 static void *dbevEventSubscriptionFreeList;
 static void *dbevFieldLogFreeList;
 
+/*
+ * Reference counted snapshot of array data, shared by the field logs
+ * of every subscription which one db_post_array_events() call posts to.
+ * The data follows the header and is never modified once taken.
+ */
+typedef union sharedArray {
+    struct {
+        int refs;           /* atomic */
+        size_t size;        /* bytes of data allocated */
+    } h;
+    epicsFloat64 align;     /* of the data which follows */
+} sharedArray;
+
+#define sharedArrayData(pArr) ((void *) ((pArr) + 1))
+
+/*
+ * Released snapshots are kept for reuse, since an array is usually
+ * posted again with the same size, and large allocations are costly.
+ * The cache holds at most SHARED_ARRAY_CACHE_BYTES of data, larger
+ * snapshots are always freed.
+ */
+#define SHARED_ARRAY_CACHE 8
+#define SHARED_ARRAY_CACHE_BYTES (16u * 1024u * 1024u)
+
+static epicsMutexId sharedArrayLock;
+static sharedArray *sharedArrayCache[SHARED_ARRAY_CACHE];
+static size_t sharedArrayCached;    /* bytes held by sharedArrayCache */
+static unsigned sharedArrayEvict;
+
 static char *EVENT_PEND_NAME = "eventTask";
 
 static epicsMutexId stopSync;
 
+static epicsThreadOnceId batchOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId batchId; /* current dbEventBatch */
+
+/* only its address is used, as EVENTQBUSY */
+static char eventQueBusy;
+
 /* unused space in queue (EVENTQUESIZE when empty) */
 static unsigned short ringSpace ( const struct event_que *pevq )
 {
-    if ( pevq->evque[pevq->putix] == EVENTQEMPTY ) {
-        if ( pevq->getix > pevq->putix ) {
-            return ( unsigned short ) ( pevq->getix - pevq->putix );
-        }
-        else {
-            return ( unsigned short ) ( ( EVENTQUESIZE + pevq->getix ) - pevq->putix );
-        }
-    }
-    return 0;
+    return ( unsigned short ) ( EVENTQUESIZE -
+        epicsAtomicGetIntT ( &pevq->nQueued ) );
 }
 
 int db_event_list ( const char *pname, unsigned level )
@@ -190,7 +243,8 @@ int dbel ( const char *pname, unsigned level )
             printf ( "}" );
 
             if ( pevent->npend ) {
-                printf ( " undelivered=%ld", pevent->npend );
+                printf ( " undelivered=%d",
+                    epicsAtomicGetIntT ( &pevent->npend ) );
             }
 
             if ( level > 1 ) {
@@ -223,7 +277,7 @@ int dbel ( const char *pname, unsigned level )
                     printf (", queueing disabled" );
                 }
                 LOCKEVQUE(pevent->ev_que);
-                nDuplicates = pevent->ev_que->nDuplicates;
+                nDuplicates = epicsAtomicGetIntT ( &pevent->ev_que->nDuplicates );
                 UNLOCKEVQUE(pevent->ev_que);
                 if  ( nDuplicates ) {
                     printf (", duplicate count =%u\n", nDuplicates );
@@ -261,6 +315,9 @@ void db_init_event_freelists (void)
     if (!stopSync) {
         stopSync = epicsMutexMustCreate();
     }
+    if (!sharedArrayLock) {
+        sharedArrayLock = epicsMutexMustCreate();
+    }
 
     if (!dbevEventUserFreeList) {
         freeListInitPvt(&dbevEventUserFreeList,
@@ -318,9 +375,13 @@ dbEventCtx db_init_events (void)
     evUser->pexitsem = epicsEventCreate(epicsEventEmpty);
     if (!evUser->pexitsem)
         goto fail;
+    evUser->pbatchsem = epicsEventCreate(epicsEventEmpty);
+    if (!evUser->pbatchsem)
+        goto fail;
 
     evUser->flowCtrlMode = FALSE;
     evUser->extraLaborBusy = FALSE;
+    evUser->idle = TRUE;
     return (dbEventCtx) evUser;
 fail:
     if(evUser->lock)
@@ -331,6 +392,8 @@ fail:
         epicsEventDestroy (evUser->ppendsem);
     if(evUser->pexitsem)
         epicsEventDestroy (evUser->pexitsem);
+    if(evUser->pbatchsem)
+        epicsEventDestroy (evUser->pbatchsem);
     freeListFree(dbevEventUserFreeList,evUser);
     return NULL;
 }
@@ -349,6 +412,18 @@ DBCORE_API void db_cleanup_events(void)
 
     if(dbevFieldLogFreeList) freeListCleanup(dbevFieldLogFreeList);
     dbevFieldLogFreeList = NULL;
+
+    if(sharedArrayLock) {
+        unsigned i;
+
+        epicsMutexMustLock(sharedArrayLock);
+        for(i = 0; i < SHARED_ARRAY_CACHE; i++) {
+            free(sharedArrayCache[i]);
+            sharedArrayCache[i] = NULL;
+        }
+        sharedArrayCached = 0;
+        epicsMutexUnlock(sharedArrayLock);
+    }
 }
 
     /* intentionally leak stopSync to avoid possible shutdown races */
@@ -386,10 +461,18 @@ void db_close_events (dbEventCtx ctx)
         epicsMutexMustLock ( evUser->lock );
     }
 
+    /* a batch may still hold a deferred wake for this user */
+    while ( epicsAtomicGetIntT ( &evUser->batchRefs ) ) {
+        epicsMutexUnlock ( evUser->lock );
+        epicsEventMustWait ( evUser->pbatchsem );
+        epicsMutexMustLock ( evUser->lock );
+    }
+
     epicsMutexUnlock ( evUser->lock );
 
     epicsMutexMustLock (stopSync);
 
+    epicsEventDestroy(evUser->pbatchsem);
     epicsEventDestroy(evUser->pexitsem);
     epicsEventDestroy(evUser->ppendsem);
     epicsMutexDestroy(evUser->lock);
@@ -472,13 +555,14 @@ dbEventSubscription db_add_event (
         return NULL;
     }
 
-    pevent->npend =     0ul;
+    pevent->npend =     0;
     pevent->nreplace =  0ul;
     pevent->user_sub =  user_sub;
     pevent->user_arg =  user_arg;
     pevent->chan =      chan;
     pevent->select =    (unsigned char) select;
-    pevent->pLastLog =  NULL; /* not yet in the queue */
+    pevent->lastix =    0u; /* not yet in the queue */
+    pevent->lastHasCopy = FALSE;
     pevent->callBackInProgress = FALSE;
     pevent->enabled =   FALSE;
     pevent->ev_que =    ev_que;
@@ -534,25 +618,108 @@ void db_event_disable (dbEventSubscription event)
 
 /*
  * event_remove()
- * event queue lock _must_ be applied
- * this nulls the entry in the queue, but doesn't delete the db_field_log chunk
+ * caller must own the entry, ie. have replaced evque[index] with EVENTQBUSY.
+ * this empties the entry, but doesn't delete the db_field_log chunk
  */
 static void event_remove ( struct event_que *ev_que,
-    unsigned short index, struct evSubscrip *placeHolder )
+    unsigned short index, struct evSubscrip *pevent )
 {
-    struct evSubscrip * const pevent = ev_que->evque[index];
-
-    ev_que->evque[index] = placeHolder;
     ev_que->valque[index] = NULL;
-    if ( pevent->npend == 1u ) {
-        pevent->pLastLog = NULL;
+    /* posters now queue a new entry rather than updating this one */
+    if ( epicsAtomicDecrIntT ( &pevent->npend ) > 0 ) {
+        assert ( epicsAtomicGetIntT ( &ev_que->nDuplicates ) >= 1 );
+        epicsAtomicDecrIntT ( &ev_que->nDuplicates );
     }
-    else {
-        assert ( pevent->npend > 1u );
-        assert ( ev_que->nDuplicates >= 1u );
-        ev_que->nDuplicates--;
+    EVQSET ( ev_que, index, EVENTQEMPTY );
+    epicsAtomicDecrIntT ( &ev_que->nQueued );
+}
+
+/*
+ * event_wake_now()
+ * notify the event task if it is waiting, even during a batch
+ */
+static void event_wake_now ( struct event_user *evUser )
+{
+    if ( epicsAtomicCmpAndSwapIntT ( &evUser->idle, TRUE, FALSE ) ) {
+        epicsEventSignal ( evUser->ppendsem );
     }
-    pevent->npend--;
+}
+
+/*
+ * event_wake()
+ * notify the event task if it might be waiting
+ */
+static void event_wake ( struct event_user *evUser )
+{
+    if ( ! epicsAtomicGetIntT ( &evUser->idle ) )
+        return;
+
+    if ( batchId ) {
+        dbEventBatch *pbatch = (dbEventBatch *) epicsThreadPrivateGet ( batchId );
+
+        if ( pbatch ) {
+            unsigned i;
+
+            for ( i = 0; i < pbatch->count; i++ ) {
+                if ( pbatch->evUsers[i] == evUser )
+                    return;
+            }
+            if ( pbatch->count < DB_EVENT_BATCH_SIZE ) {
+                epicsAtomicIncrIntT ( &evUser->batchRefs );
+                pbatch->evUsers[pbatch->count++] = evUser;
+                return;
+            }
+            /* batch full, wake now */
+        }
+    }
+
+    event_wake_now ( evUser );
+}
+
+static void batchInit ( void *unused )
+{
+    batchId = epicsThreadPrivateCreate ();
+}
+
+/*
+ * DB_EVENT_BATCH_BEGIN()
+ */
+void db_event_batch_begin ( dbEventBatch *pbatch )
+{
+    epicsThreadOnce ( &batchOnce, batchInit, NULL );
+
+    pbatch->prev = (dbEventBatch *) epicsThreadPrivateGet ( batchId );
+    pbatch->count = 0u;
+    epicsThreadPrivateSet ( batchId, pbatch );
+}
+
+/*
+ * DB_EVENT_BATCH_END()
+ *
+ * wake the event tasks which were deferred by this batch
+ */
+void db_event_batch_end ( dbEventBatch *pbatch )
+{
+    unsigned i;
+
+    epicsThreadPrivateSet ( batchId, pbatch->prev );
+
+    for ( i = 0; i < pbatch->count; i++ ) {
+        struct event_user * const evUser =
+            (struct event_user *) pbatch->evUsers[i];
+
+        if ( epicsAtomicCmpAndSwapIntT ( &evUser->idle, TRUE, FALSE ) ) {
+            epicsEventSignal ( evUser->ppendsem );
+        }
+
+        /* db_close_events() may be waiting to free evUser */
+        epicsMutexMustLock ( evUser->lock );
+        if ( epicsAtomicDecrIntT ( &evUser->batchRefs ) == 0 ) {
+            epicsEventSignal ( evUser->pbatchsem );
+        }
+        epicsMutexUnlock ( evUser->lock );
+    }
+    pbatch->count = 0u;
 }
 
 /*
@@ -579,7 +746,7 @@ void db_cancel_event (dbEventSubscription event)
         if(pevent->ev_que->evUser->taskid != epicsThreadGetIdSelf())
             sync = 1; /* concurrent to event_task, so wait */
 
-    } else if(pevent->npend) {
+    } else if(epicsAtomicGetIntT(&pevent->npend)) {
         /* some (now defunct) events in the queue, defer free() to event_task */
 
     } else {
@@ -758,143 +925,455 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
     return pLog;
 }
 
+static sharedArray* sharedArrayAlloc (size_t size)
+{
+    sharedArray *pArr = NULL;
+    unsigned i;
+
+    epicsMutexMustLock ( sharedArrayLock );
+    for ( i = 0; i < SHARED_ARRAY_CACHE; i++ ) {
+        sharedArray *pFree = sharedArrayCache[i];
+
+        /* big enough, but not tying up a much larger buffer */
+        if ( pFree && pFree->h.size >= size && pFree->h.size / 2 <= size ) {
+            sharedArrayCache[i] = NULL;
+            sharedArrayCached -= pFree->h.size;
+            pArr = pFree;
+            break;
+        }
+    }
+    epicsMutexUnlock ( sharedArrayLock );
+
+    if ( ! pArr ) {
+        pArr = (sharedArray *) malloc ( sizeof ( *pArr ) + size );
+        if ( ! pArr )
+            return NULL;
+        pArr->h.size = size;
+    }
+    pArr->h.refs = 1;
+    return pArr;
+}
+
+static void sharedArrayFree (sharedArray *pArr)
+{
+    sharedArray *pOld[SHARED_ARRAY_CACHE];
+    unsigned nOld = 0;
+    unsigned i;
+
+    if ( pArr->h.size > SHARED_ARRAY_CACHE_BYTES ) {
+        free ( pArr );
+        return;
+    }
+
+    epicsMutexMustLock ( sharedArrayLock );
+    while ( TRUE ) {
+        for ( i = 0; i < SHARED_ARRAY_CACHE; i++ ) {
+            if ( ! sharedArrayCache[i] )
+                break;
+        }
+        if ( i < SHARED_ARRAY_CACHE &&
+                sharedArrayCached + pArr->h.size <= SHARED_ARRAY_CACHE_BYTES )
+            break;
+        /* make room by evicting the entries in turn */
+        i = sharedArrayEvict++ % SHARED_ARRAY_CACHE;
+        if ( sharedArrayCache[i] ) {
+            pOld[nOld++] = sharedArrayCache[i];
+            sharedArrayCached -= sharedArrayCache[i]->h.size;
+            sharedArrayCache[i] = NULL;
+        }
+    }
+    sharedArrayCache[i] = pArr;
+    sharedArrayCached += pArr->h.size;
+    epicsMutexUnlock ( sharedArrayLock );
+
+    while ( nOld > 0 )
+        free ( pOld[--nOld] );
+}
+
+/* dtor of field logs which reference a sharedArray through u.r.pvt */
+static void sharedArrayRelease (db_field_log *pfl)
+{
+    sharedArray *pArr = (sharedArray *) pfl->u.r.pvt;
+
+    if ( epicsAtomicDecrIntT ( &pArr->h.refs ) == 0 ) {
+        sharedArrayFree ( pArr );
+    }
+}
+
+#define dbfl_is_shared(p) \
+ ((p)->type==dbfl_type_ref && (p)->dtor==sharedArrayRelease)
+
 /*
- *  DB_QUEUE_EVENT_LOG()
+ * Bytes currently held by an array field.  Caller holds the record lock.
+ */
+static size_t sharedArrayBytes (struct dbChannel *chan)
+{
+    const long capacity = dbChannelElements(chan);
+    void *pSource = dbChannelField(chan);
+    long nSource = capacity;
+    long offset = 0;
+
+    if (dbChannelSpecial(chan) != SPC_DBADDR)
+        return 0;
+    dbChannelGetArrayInfo(chan, &pSource, &nSource, &offset);
+    if (nSource > capacity)
+        nSource = capacity;
+    if (nSource <= 0)
+        return 0;
+    return (size_t) nSource * dbChannelFieldSize(chan);
+}
+
+/*
+ * Copy the current contents of an array field, unwrapping any circular
+ * buffer offset.  Caller holds the record lock.  Returns NULL when there
+ * are no elements or memory is exhausted, with *pnelem set to the count.
+ */
+static sharedArray* sharedArrayCreate (struct dbChannel *chan, long *pnelem)
+{
+    const long capacity = dbChannelElements(chan);
+    const short size = dbChannelFieldSize(chan);
+    void *pSource = dbChannelField(chan);
+    long nSource = capacity;
+    long offset = 0;
+    sharedArray *pArr;
+
+    dbChannelGetArrayInfo(chan, &pSource, &nSource, &offset);
+    if (nSource > capacity)
+        nSource = capacity;
+    *pnelem = nSource;
+    if (nSource <= 0)
+        return NULL;
+
+    pArr = sharedArrayAlloc((size_t) nSource * size);
+    if (!pArr)
+        return NULL;
+    dbExtractArray(pSource, sharedArrayData(pArr), size,
+        nSource, capacity, offset, 1);
+    return pArr;
+}
+
+/*
+ *  event_replace_last()
  *
+ *  Swap the most recent queued entry of pevent for pLog.  Returns
+ *  FALSE if the event task has already taken that entry.
  */
-static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+static int event_replace_last ( struct event_que *ev_que,
+    evSubscrip *pevent, db_field_log *pLog )
 {
-    struct event_que    *ev_que;
-    int firstEventFlag;
-    unsigned rngSpace;
+    const unsigned short ix = pevent->lastix;
+    db_field_log *pOld;
 
-    ev_que = pevent->ev_que;
     /*
-     * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
+     * Only this poster can place pevent in evque[], so finding
+     * it at lastix means our last entry is still queued.
      */
+    if ( EVQCAS ( ev_que, ix, pevent, EVENTQBUSY ) != pevent ) {
+        return FALSE;
+    }
+    pOld = ev_que->valque[ix];
+    ev_que->valque[ix] = pLog;
+    pevent->lastHasCopy = dbfl_has_copy ( pLog );
+    pevent->lastIsShared = dbfl_is_shared ( pLog );
+    pevent->nreplace++;
+    EVQSET ( ev_que, ix, pevent );
+
+    /* the event task may have found the entry busy */
+    event_wake ( ev_que->evUser );
+
+    db_delete_field_log ( pOld );
+    return TRUE;
+}
 
-    LOCKEVQUE (ev_que);
+/*
+ *  DB_QUEUE_EVENT_LOG()
+ *
+ *  Posters of the same subscription are serialized by the record
+ *  lock, but posters of different subscriptions sharing ev_que
+ *  are not.
+ */
+static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+{
+    struct event_que * const ev_que = pevent->ev_que;
+    const int npend = epicsAtomicGetIntT ( &pevent->npend );
+    unsigned short ix;
 
     /* if we have an event on the queue and both the last
      * event on the queue and the current event reference
      * a record field, simply ignore duplicate events.
      */
-    if (pevent->npend > 0u
-            && !dbfl_has_copy(*pevent->pLastLog)
-            && !dbfl_has_copy(pLog)) {
+    if (npend > 0 && !pevent->lastHasCopy && !dbfl_has_copy(pLog)) {
         db_delete_field_log(pLog);
-        UNLOCKEVQUE (ev_que);
         return;
     }
 
     /*
-     * add to task local event que
+     * likewise when both are snapshots of the same array only the
+     * latest is kept, so a slow client holds at most one snapshot
      */
+    if (npend > 0 && pevent->lastIsShared && dbfl_is_shared(pLog)) {
+        if ( event_replace_last ( ev_que, pevent, pLog ) ) {
+            return;
+        }
+    }
 
     /*
      * if an event is on the queue and one of
      * {flowCtrlMode, not room for one more of each monitor attached}
      * then replace the last event on the queue (for this monitor)
      */
-    rngSpace = ringSpace ( ev_que );
-    if ( pevent->npend>0u &&
-        (ev_que->evUser->flowCtrlMode || rngSpace<=EVENTSPERQUE) ) {
-        /*
-         * replace last event if no space is left
-         */
-        if (*pevent->pLastLog) {
-            db_delete_field_log(*pevent->pLastLog);
-            *pevent->pLastLog = pLog;
+    if ( npend > 0 &&
+        (ev_que->evUser->flowCtrlMode || ringSpace(ev_que)<=EVENTSPERQUE) ) {
+        if ( event_replace_last ( ev_que, pevent, pLog ) ) {
+            return;
         }
-        pevent->nreplace++;
-        /*
-         * the event task has already been notified about
-         * this so we don't need to post the semaphore
-         */
-        firstEventFlag = 0;
+        /* otherwise it was just dequeued, so add a new entry */
     }
+
     /*
-     * Otherwise, the current entry must be available.
-     * Fill it in and advance the ring buffer.
+     * Reserve an entry.  The quota handed out by db_add_event()
+     * and the replacement above leave room, unless posters of other
+     * subscriptions raced us for it.  Then replace our last entry if
+     * it is still queued, or wait for the event task to free one,
+     * rather than lose this update.
      */
-    else {
-        assert ( ev_que->evque[ev_que->putix] == EVENTQEMPTY );
-        ev_que->evque[ev_que->putix] = pevent;
-        ev_que->valque[ev_que->putix] = pLog;
-        pevent->pLastLog = &ev_que->valque[ev_que->putix];
-        if (pevent->npend>0u) {
-            ev_que->nDuplicates++;
+    while ( TRUE ) {
+        int nQueued = epicsAtomicGetIntT ( &ev_que->nQueued );
+        if ( nQueued >= EVENTQUESIZE ) {
+            if ( epicsAtomicGetIntT ( &pevent->npend ) > 0 &&
+                    event_replace_last ( ev_que, pevent, pLog ) ) {
+                return;
+            }
+            event_wake_now ( ev_que->evUser );
+            epicsThreadSleep ( epicsThreadSleepQuantum () );
+            continue;
         }
-        pevent->npend++;
-        /*
-         * if the ring buffer was empty before
-         * adding this event
-         */
-        if (rngSpace==EVENTQUESIZE) {
-            firstEventFlag = 1;
+        if ( epicsAtomicCmpAndSwapIntT ( &ev_que->nQueued,
+                nQueued, nQueued + 1 ) == nQueued ) {
+            break;
         }
-        else {
-            firstEventFlag = 0;
+    }
+
+    /* claim the next slot, which the reservation guarantees is free */
+    while ( TRUE ) {
+        int putix = epicsAtomicGetIntT ( &ev_que->putix );
+        if ( epicsAtomicCmpAndSwapIntT ( &ev_que->putix,
+                putix, RNGINC ( putix ) ) == putix ) {
+            ix = ( unsigned short ) putix;
+            break;
         }
-        ev_que->putix = RNGINC ( ev_que->putix );
     }
 
-    UNLOCKEVQUE (ev_que);
+    assert ( EVQGET ( ev_que, ix ) == EVENTQEMPTY );
+    ev_que->valque[ix] = pLog;
+    pevent->lastix = ix;
+    pevent->lastHasCopy = dbfl_has_copy ( pLog );
+    pevent->lastIsShared = dbfl_is_shared ( pLog );
+    if ( epicsAtomicIncrIntT ( &pevent->npend ) > 1 ) {
+        epicsAtomicIncrIntT ( &ev_que->nDuplicates );
+    }
+
+    /* publish */
+    EVQSET ( ev_que, ix, pevent );
 
     /*
      * its more efficient to notify the event handler
-     * only after the event is ready and the lock
-     * is off in case it runs at a higher priority
-     * than the caller here.
+     * only after the event is ready, and only if it
+     * isn't already draining the queue.
      */
-    if (firstEventFlag) {
-        /*
-         * notify the event handler
-         */
-        epicsEventSignal(ev_que->evUser->ppendsem);
+    event_wake ( ev_que->evUser );
+}
+
+/*
+ * The array snapshot taken by one db_post_array_events() call
+ */
+typedef struct sharedPost {
+    void        *pfield;    /* field the snapshot was taken of */
+    sharedArray *pArr;      /* NULL if empty or out of memory */
+    long        nelem;
+} sharedPost;
+
+static void sharedPostRelease (sharedPost *pShare)
+{
+    if ( pShare->pArr &&
+            epicsAtomicDecrIntT ( &pShare->pArr->h.refs ) == 0 ) {
+        sharedArrayFree ( pShare->pArr );
     }
+    pShare->pfield = NULL;
+    pShare->pArr = NULL;
 }
 
 /*
- *  DB_POST_EVENTS()
- *
- *  NOTE: This assumes that the db scan lock is already applied
- *
+ * Point a new event log at the snapshot of its field, taking
+ * the snapshot for the first subscription which needs it.
  */
-int db_post_events(
-void            *pRecord,
-void            *pField,
-unsigned int    caEventMask
-)
+static void db_share_array (struct evSubscrip *pevent, db_field_log *pLog,
+    sharedPost *pShare)
+{
+    void * const pfield = dbChannelField(pevent->chan);
+
+    if (pShare->pfield != pfield) {
+        sharedPostRelease(pShare);
+        pShare->pArr = sharedArrayCreate(pevent->chan, &pShare->nelem);
+        pShare->pfield = pfield;
+    }
+
+    if (pShare->pArr) {
+        epicsAtomicIncrIntT(&pShare->pArr->h.refs);
+        pLog->u.r.field = sharedArrayData(pShare->pArr);
+        pLog->u.r.pvt = pShare->pArr;
+        pLog->dtor = sharedArrayRelease;
+        pLog->no_elements = pShare->nelem;
+    }
+    else if (pShare->nelem <= 0) {
+        /* owns the (empty) data, see dbfl_has_copy() */
+        pLog->no_elements = 0;
+    }
+    /* else leave it referencing the record */
+}
+
+/*
+ *  Snapshot and queue one event for a subscription.
+ *  Caller holds the record lock (LOCKREC).
+ */
+static void db_post_event_log (struct evSubscrip *pevent, unsigned caEventMask,
+    sharedPost *pShare)
+{
+    db_field_log *pLog = db_create_event_log(pevent);
+    if(pLog) {
+        pLog->mask = caEventMask & pevent->select;
+        if (pShare && pLog->type == dbfl_type_ref &&
+                dbChannelSpecial(pevent->chan) == SPC_DBADDR)
+            db_share_array(pevent, pLog, pShare);
+    }
+    pLog = dbChannelRunPreChain(pevent->chan, pLog);
+    if (pLog) db_queue_event_log(pevent, pLog);
+}
+
+/*
+ *  Walk the record's subscriptions once for all fields.
+ *  Events for one subscription are queued in array order.
+ */
+static int db_post_fields (struct dbCommon *prec, void * const *pFields,
+    const unsigned int *caEventMasks, unsigned int nFields, int share)
 {
-    struct dbCommon   * const prec = (struct dbCommon *) pRecord;
     struct evSubscrip *pevent;
+    sharedPost        shared = {NULL, NULL, 0};
+    unsigned int      anyMask = 0;
+    unsigned int      i;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
+    for (i = 0; i < nFields; i++)
+        anyMask |= caEventMasks[i];
+    if (!anyMask) return DB_EVENT_OK;
+
     LOCKREC (prec);
 
+    /*
+     * A snapshot pays off when it is shared, or when it is large enough
+     * for the server to send it directly.  Otherwise a single
+     * subscription references the field as db_post_events() does.
+     */
+    if (share) {
+        struct evSubscrip *pfirst = NULL;
+        unsigned int nShare = 0;
+
+        for (pevent = (struct evSubscrip *) prec->mlis.node.next;
+            pevent && nShare < 2;
+            pevent = (struct evSubscrip *) pevent->node.next) {
+            if (dbChannelField(pevent->chan) == pFields[0] &&
+                (caEventMasks[0] & pevent->select)) {
+                if (!pfirst)
+                    pfirst = pevent;
+                nShare++;
+            }
+        }
+        share = nShare > 1 ||
+            (nShare == 1 && sharedArrayBytes(pfirst->chan) >=
+                DB_EVENT_ARRAY_COPY_BYTES);
+    }
+
     for (pevent = (struct evSubscrip *) prec->mlis.node.next;
         pevent; pevent = (struct evSubscrip *) pevent->node.next){
+        void *pChanField;
+
+        if (!(anyMask & pevent->select)) continue;
 
         /*
          * Only send event msg if they are waiting on the field which
          * changed or pval==NULL, and are waiting on matching event
          */
-        if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
-            (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
-            if(pLog)
-                pLog->mask = caEventMask & pevent->select;
-            pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+        pChanField = dbChannelField(pevent->chan);
+        for (i = 0; i < nFields; i++) {
+            if ( (pFields[i] == pChanField || pFields[i] == NULL) &&
+                (caEventMasks[i] & pevent->select)) {
+                db_post_event_log(pevent, caEventMasks[i],
+                    share ? &shared : NULL);
+            }
         }
     }
 
     UNLOCKREC (prec);
+
+    sharedPostRelease(&shared);
     return DB_EVENT_OK;
+}
 
+/*
+ *  DB_POST_EVENTS()
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ *
+ */
+int db_post_events(
+void            *pRecord,
+void            *pField,
+unsigned int    caEventMask
+)
+{
+    return db_post_fields((struct dbCommon *) pRecord,
+        &pField, &caEventMask, 1, FALSE);
+}
+
+/*
+ *  DB_POST_EVENTS_MANY()
+ *
+ *  Equivalent to calling db_post_events() for each of the nFields
+ *  (pFields[i], caEventMasks[i]) pairs, but the record's monitor list
+ *  is locked and walked only once.  As with separate calls there is
+ *  no ordering guarantee between subscriptions of different fields.
+ */
+int db_post_events_many(
+void                *pRecord,
+void * const        *pFields,
+const unsigned int  *caEventMasks,
+unsigned int        nFields
+)
+{
+    return db_post_fields((struct dbCommon *) pRecord,
+        pFields, caEventMasks, nFields, FALSE);
+}
+
+/*
+ *  DB_POST_ARRAY_EVENTS()
+ *
+ *  As db_post_events(), but the current contents of an array field
+ *  are copied once into a reference counted snapshot, which the event
+ *  logs of all matching subscriptions share.  Subscribers then read
+ *  the value as it was when posted without copying it again, and only
+ *  the latest snapshot is kept on the queue for each subscription.
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ */
+int db_post_array_events(
+void            *pRecord,
+void            *pField,
+unsigned int    caEventMask
+)
+{
+    return db_post_fields((struct dbCommon *) pRecord,
+        &pField, &caEventMask, 1, TRUE);
 }
 
 /*
@@ -933,25 +1412,36 @@ static int event_read ( struct event_que *ev_que )
      * suspend processing events until flow control
      * mode is over
      */
-    if ( ev_que->evUser->flowCtrlMode && ev_que->nDuplicates == 0u ) {
+    if ( ev_que->evUser->flowCtrlMode &&
+            epicsAtomicGetIntT ( &ev_que->nDuplicates ) == 0 ) {
         UNLOCKEVQUE (ev_que);
         return DB_EVENT_OK;
     }
 
-    while ( ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
-        struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
+    while ( TRUE ) {
+        const unsigned short ix = ev_que->getix;
+        struct evSubscrip *pevent = EVQGET ( ev_que, ix );
         int eventsRemaining;
-        db_field_log *pfl = ev_que->valque[ev_que->getix];
+        db_field_log *pfl;
+
+        /*
+         * Stop at an empty entry, or one which is being
+         * written.  Its poster will wake us again.
+         */
+        if ( pevent == EVENTQEMPTY || pevent == EVENTQBUSY ||
+                EVQCAS ( ev_que, ix, pevent, EVENTQBUSY ) != pevent ) {
+            break;
+        }
 
         /*
          * Simple type values queued up for reliable interprocess
          * communication. (for other types they get whatever happens
          * to be there upon wakeup)
          */
-
-        event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
-        ev_que->getix = RNGINC ( ev_que->getix );
-        eventsRemaining = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+        pfl = ev_que->valque[ix];
+        ev_que->getix = RNGINC ( ix );
+        event_remove ( ev_que, ix, pevent );
+        eventsRemaining = EVQGET ( ev_que, ev_que->getix ) != EVENTQEMPTY;
 
         /*
          * Next event pointer can be used by event tasks to determine
@@ -985,7 +1475,7 @@ static int event_read ( struct event_que *ev_que )
             pevent->callBackInProgress = FALSE;
         }
         /* callback may have called db_cancel_event(), so must check user_sub again */
-        if(!pevent->user_sub && !pevent->npend) {
+        if(!pevent->user_sub && !epicsAtomicGetIntT(&pevent->npend)) {
             pevent->ev_que->quota -= EVENTENTRIES;
             freeListFree ( dbevEventSubscriptionFreeList, pevent );
         }
@@ -1002,6 +1492,21 @@ static int event_read ( struct event_que *ev_que )
     return DB_EVENT_OK;
 }
 
+/*
+ * event_que_ready()
+ * would event_read() deliver anything now?
+ */
+static int event_que_ready ( struct event_que *ev_que )
+{
+    struct evSubscrip *pevent = EVQGET ( ev_que, ev_que->getix );
+
+    if ( pevent == EVENTQEMPTY || pevent == EVENTQBUSY ) {
+        return FALSE;
+    }
+    return ! ( ev_que->evUser->flowCtrlMode &&
+        epicsAtomicGetIntT ( &ev_que->nDuplicates ) == 0 );
+}
+
 static void event_task (void *pParm)
 {
     struct event_user * const evUser = (struct event_user *) pParm;
@@ -1019,6 +1524,7 @@ static void event_task (void *pParm)
         void (*pExtraLaborSub) (void *);
         void *pExtraLaborArg;
         epicsEventMustWait(evUser->ppendsem);
+        epicsAtomicSetIntT ( &evUser->idle, FALSE );
 
         /*
          * check to see if the caller has offloaded
@@ -1050,6 +1556,20 @@ static void event_task (void *pParm)
         }
         pendexit = evUser->pendexit;
 
+        /*
+         * Let posters know that we are about to wait, then check
+         * again for anything posted while we were busy.
+         */
+        epicsAtomicSetIntT ( &evUser->idle, TRUE );
+        for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
+            if ( event_que_ready ( ev_que ) ) {
+                if ( epicsAtomicCmpAndSwapIntT ( &evUser->idle, TRUE, FALSE ) ) {
+                    epicsEventSignal ( evUser->ppendsem );
+                }
+                break;
+            }
+        }
+
         evUser->pflush_seq++;
         if(ellCount(&evUser->waiters)) {
             /* hold lock throughout to avoid race between event trigger and destroy */
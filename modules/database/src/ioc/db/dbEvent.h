@@ -38,6 +38,18 @@ DBCORE_API int dbel (
     const char *name, unsigned level);
 DBCORE_API int db_post_events (
     void *pRecord, void *pField, unsigned caEventMask );
+DBCORE_API int db_post_events_many (
+    void *pRecord, void * const *pFields, const unsigned *caEventMasks,
+    unsigned nFields );
+DBCORE_API int db_post_array_events (
+    void *pRecord, void *pField, unsigned caEventMask );
+
+/*
+ * db_post_array_events() gives the events it queues their own copy of
+ * the array when it is shared by several subscriptions, or when it holds
+ * at least this many bytes, so servers can send it without copying again.
+ */
+#define DB_EVENT_ARRAY_COPY_BYTES 8192u
 
 typedef void * dbEventCtx;
 
@@ -55,6 +67,22 @@ DBCORE_API void db_flush_extra_labor_event (dbEventCtx);
 DBCORE_API int db_post_extra_labor (dbEventCtx ctx);
 DBCORE_API void db_event_change_priority ( dbEventCtx ctx, unsigned epicsPriority );
 
+/*
+ * While a batch is active on a thread, events posted by that thread
+ * do not wake the event tasks.  Each event task which needs a wake
+ * is woken once, by db_event_batch_end().  Batches may be nested.
+ */
+#define DB_EVENT_BATCH_SIZE 16
+
+typedef struct dbEventBatch {
+    struct dbEventBatch *prev;
+    unsigned count;
+    dbEventCtx evUsers[DB_EVENT_BATCH_SIZE];
+} dbEventBatch;
+
+DBCORE_API void db_event_batch_begin ( dbEventBatch *pbatch );
+DBCORE_API void db_event_batch_end ( dbEventBatch *pbatch );
+
 #ifdef EPICS_PRIVATE_API
 DBCORE_API void db_cleanup_events(void);
 DBCORE_API void db_init_event_freelists (void);
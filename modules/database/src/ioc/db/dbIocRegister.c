@@ -22,6 +22,7 @@
 #include "dbJLink.h"
 #include "dbLock.h"
 #include "dbNotify.h"
+#include "dbProcStats.h"
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbState.h"
@@ -426,6 +427,22 @@ static void scanOnceSetQueueSizeCallFunc(const iocshArgBuf *args)
     scanOnceSetQueueSize(args[0].ival);
 }
 
+/* scanThreads */
+static const iocshArg scanThreadsArg0 = { "rate",iocshArgString};
+static const iocshArg scanThreadsArg1 = { "no of threads",iocshArgInt};
+static const iocshArg * const scanThreadsArgs[2] =
+    {&scanThreadsArg0,&scanThreadsArg1};
+static const iocshFuncDef scanThreadsFuncDef = {"scanThreads",2,scanThreadsArgs,
+                                                "Scan the records of one periodic scan rate with several threads.\n"
+                                                "Records in the same lock set are always scanned by the same thread,\n"
+                                                "in phase (PHAS) order.\n"
+                                                "Must be called before iocInit().\n\n"
+                                                "Example: scanThreads \".1 second\" 4\n"};
+static void scanThreadsCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(scanThreads(args[0].sval, args[1].ival));
+}
+
 /* scanOnceQueueShow */
 static const iocshArg scanOnceQueueShowArg0 = { "reset",iocshArgInt};
 static const iocshArg * const scanOnceQueueShowArgs[1] =
@@ -446,6 +463,59 @@ static const iocshFuncDef scanpplFuncDef = {"scanppl",1,scanpplArgs,
 static void scanpplCallFunc(const iocshArgBuf *args)
 { scanppl(args[0].dval);}
 
+/* scanJitter */
+static const iocshArg scanJitterArg0 = { "reset",iocshArgInt};
+static const iocshArg * const scanJitterArgs[1] = {&scanJitterArg0};
+static const iocshFuncDef scanJitterFuncDef = {"scanJitter",1,scanJitterArgs,
+                                               "Show how late each periodic scan pass started, and how long\n"
+                                               "the passes took, as collected while dbProcStatsEnable is on.\n"
+                                               "If reset != 0, the statistics are cleared afterwards.\n"};
+static void scanJitterCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(scanJitter(args[0].ival));
+}
+
+/* dbProcStats */
+static const iocshArg dbProcStatsArg0 = { "count",iocshArgInt};
+static const iocshArg dbProcStatsArg1 = { "reset",iocshArgInt};
+static const iocshArg * const dbProcStatsArgs[2] =
+    {&dbProcStatsArg0,&dbProcStatsArg1};
+static const iocshFuncDef dbProcStatsFuncDef = {"dbProcStats",2,dbProcStatsArgs,
+                                                "List the count (default 10) records with the longest processing\n"
+                                                "times, as collected while dbProcStatsEnable is on.\n"
+                                                "If reset != 0, the statistics are cleared afterwards.\n\n"
+                                                "Example: dbProcStatsEnable 1\n"
+                                                "         dbProcStats 20\n"};
+static void dbProcStatsCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(dbProcStats(args[0].ival, args[1].ival));
+}
+
+/* dbProcStatsEnable */
+static const iocshArg dbProcStatsEnableArg0 = { "on",iocshArgInt};
+static const iocshArg * const dbProcStatsEnableArgs[1] = {&dbProcStatsEnableArg0};
+static const iocshFuncDef dbProcStatsEnableFuncDef = {"dbProcStatsEnable",1,dbProcStatsEnableArgs,
+                                                      "Start (on != 0) or stop collecting record processing times,\n"
+                                                      "periodic scan jitter, and callback queue waits.\n"};
+static void dbProcStatsEnableCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(dbProcStatsEnable(args[0].ival));
+}
+
+/* dbProcStatsRecord */
+static const iocshArg dbProcStatsRecordArg0 = { "record name",iocshArgStringRecord};
+static const iocshArg dbProcStatsRecordArg1 = { "reset",iocshArgInt};
+static const iocshArg * const dbProcStatsRecordArgs[2] =
+    {&dbProcStatsRecordArg0,&dbProcStatsRecordArg1};
+static const iocshFuncDef dbProcStatsRecordFuncDef = {"dbProcStatsRecord",2,dbProcStatsRecordArgs,
+                                                      "Show the processing times of one record, as collected while\n"
+                                                      "dbProcStatsEnable is on, and its last processing time.\n"
+                                                      "If reset != 0, its statistics are cleared afterwards.\n"};
+static void dbProcStatsRecordCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(dbProcStatsRecord(args[0].sval, args[1].ival));
+}
+
 /* scanpel */
 static const iocshArg scanpelArg0 = { "event name",iocshArgString};
 static const iocshArg * const scanpelArgs[1] = {&scanpelArg0};
@@ -608,8 +678,13 @@ void dbIocRegister(void)
     iocshRegister(&dbLockShowLockedFuncDef,dbLockShowLockedCallFunc);
 
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
+    iocshRegister(&scanThreadsFuncDef,scanThreadsCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
+    iocshRegister(&scanJitterFuncDef,scanJitterCallFunc);
+    iocshRegister(&dbProcStatsFuncDef,dbProcStatsCallFunc);
+    iocshRegister(&dbProcStatsEnableFuncDef,dbProcStatsEnableCallFunc);
+    iocshRegister(&dbProcStatsRecordFuncDef,dbProcStatsRecordCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
     iocshRegister(&scanpiolFuncDef,scanpiolCallFunc);
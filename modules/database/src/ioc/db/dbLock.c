@@ -48,10 +48,13 @@ static ELLLIST lockSetsFree; /* free list */
 static epicsMutexId lockSetsGuard;
 
 #ifndef LOCKSET_NOCNT
-/* Counter which we increment whenever
- * any lockRecord::plockSet is changed.
+/* Generation counter which we increment once for each
+ * dbLockSetMerge() or dbLockSetSplit() which changes
+ * any lockRecord::plockSet.
  * An optimization to avoid checking lockSet
  * associations when no links have changed.
+ * A dbLocker which is re-used keeps its refs[] sorted
+ * and skips re-checking them while this is unchanged.
  */
 static size_t recomputeCnt;
 #endif
@@ -183,12 +186,33 @@ unsigned long dbLockGetLockId(dbCommon *precord)
 
 void dbScanLock(dbCommon *precord)
 {
-    int cnt;
     lockRecord * const lr = precord->lset;
     lockSet *ls;
+#ifdef LOCKSET_NOFREE
+    int cnt;
+#endif
 
     assert(lr);
 
+#ifndef LOCKSET_NOFREE
+    /* lockSets are never free'd, so the lock of any lockSet we
+     * find is safe to take without holding a reference.
+     * lr->plockSet can only change while that lockSet is locked,
+     * so once we hold the lock of the lockSet it points to
+     * it can't move away.  Usually it hasn't moved since we
+     * read it, and taking an uncontended mutex is the only
+     * atomic operation on this path.
+     */
+    for(;;) {
+        ls = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &lr->plockSet);
+        epicsMutexMustLock(ls->lock);
+        if(ls==epicsAtomicGetPtrT((EpicsAtomicPtrT *) &lr->plockSet))
+            break;
+        /* collided with recompute */
+        epicsMutexUnlock(ls->lock);
+    }
+    assert(epicsAtomicGetIntT(&ls->refcount)>0);
+#else
     ls = dbLockGetRef(lr);
     assert(epicsAtomicGetIntT(&ls->refcount)>0);
 
@@ -220,6 +244,7 @@ retry:
      */
     cnt = epicsAtomicDecrIntT(&ls->refcount);
     assert(cnt>0);
+#endif /* LOCKSET_NOFREE */
 
 #ifdef LOCKSET_DEBUG
     if(ls->owner) {
@@ -237,7 +262,10 @@ retry:
 void dbScanUnlock(dbCommon *precord)
 {
     lockSet *ls = precord->lset->plockSet;
+#ifdef LOCKSET_NOFREE
+    /* keep ls alive until the unlock has returned */
     dbLockIncRef(ls);
+#endif
 #ifdef LOCKSET_DEBUG
     assert(ls->owner==epicsThreadGetIdSelf());
     assert(ls->ownercount>=1);
@@ -246,7 +274,9 @@ void dbScanUnlock(dbCommon *precord)
         ls->owner = NULL;
 #endif
     epicsMutexUnlock(ls->lock);
+#ifdef LOCKSET_NOFREE
     dbLockDecRef(ls);
+#endif
 }
 
 static
@@ -624,11 +654,12 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
 
         epicsSpinLock(lr->spin);
         lr->plockSet = A;
-#ifndef LOCKSET_NOCNT
-        epicsAtomicIncrSizeT(&recomputeCnt);
-#endif
         epicsSpinUnlock(lr->spin);
     }
+#ifndef LOCKSET_NOCNT
+    /* Lockers can't see the change until we unlock B */
+    epicsAtomicIncrSizeT(&recomputeCnt);
+#endif
 
     /* there are at minimum, 1 ref for each lockRecord,
      * and one for the locker's locked list
@@ -821,14 +852,15 @@ void dbLockSetSplit(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
 
             epicsSpinLock(lr->spin);
             lr->plockSet = splitset;
-#ifndef LOCKSET_NOCNT
-            epicsAtomicIncrSizeT(&recomputeCnt);
-#endif
             epicsSpinUnlock(lr->spin);
             /* new lockSet is "live" at this point
              * as other threads may find it.
              */
         }
+#ifndef LOCKSET_NOCNT
+        /* Lockers can't see the change until we unlock ls and splitset */
+        epicsAtomicIncrSizeT(&recomputeCnt);
+#endif
 
         /* refcount of ls can't go to zero as the locker
          * holds at least one reference (its locked list)
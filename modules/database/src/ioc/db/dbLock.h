@@ -29,6 +29,10 @@ struct dbBase;
  * A dbLocker allows a caller to simultaneously lock multiple records.
  * The list of records is provided to dbLockerAlloc().
  * And the resulting dbLocker can be locked/unlocked repeatedly.
+ * A dbLocker keeps its lock sets sorted in locking order, and while no
+ * lock sets have been merged or split since it was last locked they
+ * are not looked up or sorted again, so keeping one for records which
+ * are locked together often is cheaper than allocating it each time.
  *
  * Each thread can only lock one dbLocker at a time.
  * While locked, dbScanLock() may be called only on those records
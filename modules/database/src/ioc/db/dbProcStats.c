@@ -0,0 +1,293 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Record processing time statistics */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+
+#include "dbAccessDefs.h"
+#include "dbAddr.h"
+#include "dbBase.h"
+#include "dbCommonPvt.h"
+#include "dbLock.h"
+#include "dbProcStats.h"
+#include "dbStaticLib.h"
+
+int dbProcStatsActive = 0;
+
+/* Private to the record, hangs off its dbCommonPvt */
+struct dbRecProcStats {
+    dbProcHist hist;
+    epicsUInt64 lastNs;
+};
+
+void dbProcHistAdd(dbProcHist *phist, epicsUInt64 ns)
+{
+    epicsUInt64 us = ns / 1000;
+    int i = 0;
+
+    while (us && i < DB_PROC_HIST_BUCKETS - 1) {
+        us >>= 1;
+        i++;
+    }
+    phist->bucket[i]++;
+    phist->count++;
+    phist->sumNs += ns;
+    if (ns > phist->maxNs)
+        phist->maxNs = ns;
+}
+
+void dbProcHistMerge(dbProcHist *pdst, const dbProcHist *psrc)
+{
+    int i;
+
+    for (i = 0; i < DB_PROC_HIST_BUCKETS; i++)
+        pdst->bucket[i] += psrc->bucket[i];
+    pdst->count += psrc->count;
+    pdst->sumNs += psrc->sumNs;
+    if (psrc->maxNs > pdst->maxNs)
+        pdst->maxNs = psrc->maxNs;
+}
+
+epicsUInt64 dbProcHistPercentile(const dbProcHist *phist, double fraction)
+{
+    double want = fraction * phist->count;
+    epicsUInt32 seen = 0;
+    int i;
+
+    for (i = 0; i < DB_PROC_HIST_BUCKETS - 1; i++) {
+        seen += phist->bucket[i];
+        if (seen && seen >= want) {
+            epicsUInt64 top = (epicsUInt64)1000u << i;
+
+            return top < phist->maxNs ? top : phist->maxNs;
+        }
+    }
+    return phist->maxNs;
+}
+
+void dbProcHistShow(const dbProcHist *phist)
+{
+    if (!phist->count) {
+        printf("no samples\n");
+        return;
+    }
+    printf("%10u  mean %9.1f  50%% <%9.1f  99%% <%9.1f  max %9.1f us\n",
+           phist->count, 1e-3 * phist->sumNs / phist->count,
+           1e-3 * dbProcHistPercentile(phist, 0.5),
+           1e-3 * dbProcHistPercentile(phist, 0.99),
+           1e-3 * phist->maxNs);
+}
+
+void dbProcStatsInitRecord(struct dbCommon *precord)
+{
+    dbCommonPvt *ppvt = dbRec2Pvt(precord);
+
+    if (!ppvt->procStats)
+        ppvt->procStats = callocMustSucceed(1, sizeof(struct dbRecProcStats),
+                                            "dbProcStatsInitRecord");
+}
+
+long dbProcStatsEnable(int on)
+{
+    DBENTRY dbentry;
+    long status;
+
+    if (!on || !pdbbase) {
+        dbProcStatsActive = !!on;
+        return 0;
+    }
+
+    /* allocate everything first, so dbProcess() never has to */
+    dbInitEntry(pdbbase, &dbentry);
+    for (status = dbFirstRecordType(&dbentry); !status;
+         status = dbNextRecordType(&dbentry)) {
+        for (status = dbFirstRecord(&dbentry); !status;
+             status = dbNextRecord(&dbentry)) {
+            struct dbCommon *precord = dbentry.precnode->precord;
+
+            if (dbIsAlias(&dbentry) || !precord ||
+                dbRec2Pvt(precord)->procStats)
+                continue;
+            /* no lock sets before iocInit() */
+            if (precord->lset) {
+                dbScanLock(precord);
+                dbProcStatsInitRecord(precord);
+                dbScanUnlock(precord);
+            }
+            else
+                dbProcStatsInitRecord(precord);
+        }
+    }
+    dbFinishEntry(&dbentry);
+    dbProcStatsActive = 1;
+    return 0;
+}
+
+void dbProcStatsAdd(struct dbCommon *precord, epicsUInt64 ns)
+{
+    struct dbRecProcStats *pstats = dbRec2Pvt(precord)->procStats;
+
+    /* only missing when dbProcStatsActive was set directly */
+    if (!pstats)
+        return;
+    dbProcHistAdd(&pstats->hist, ns);
+    pstats->lastNs = ns;
+}
+
+long dbProcStatsGet(struct dbCommon *precord, dbProcHist *phist,
+    epicsUInt64 *plastNs)
+{
+    struct dbRecProcStats *pstats = dbRec2Pvt(precord)->procStats;
+
+    if (!pstats)
+        return -1;
+    *phist = pstats->hist;
+    if (plastNs)
+        *plastNs = pstats->lastNs;
+    return 0;
+}
+
+long dbProcStatsRecord(const char *pname, int reset)
+{
+    DBADDR addr;
+    struct dbCommon *precord;
+    dbProcHist hist;
+    epicsUInt64 lastNs;
+    long status;
+
+    if (!pname || !*pname) {
+        printf("Usage: dbProcStatsRecord \"record name\" [reset]\n");
+        return -1;
+    }
+    if (dbNameToAddr(pname, &addr)) {
+        printf("Record '%s' not found\n", pname);
+        return -1;
+    }
+    precord = addr.precord;
+
+    dbScanLock(precord);
+    status = dbProcStatsGet(precord, &hist, &lastNs);
+    if (!status && reset)
+        memset(dbRec2Pvt(precord)->procStats, 0,
+               sizeof(struct dbRecProcStats));
+    dbScanUnlock(precord);
+
+    if (status || !hist.count) {
+        printf("No processing times recorded for %s%s\n", precord->name,
+               dbProcStatsActive ? "" : ", run dbProcStatsEnable 1");
+        return 0;
+    }
+    printf("%s times in microseconds, last %.1f:\n", precord->name,
+           1e-3 * lastNs);
+    printf("%-28s ", precord->name);
+    dbProcHistShow(&hist);
+    return 0;
+}
+
+typedef struct {
+    struct dbCommon *precord;
+    dbProcHist *phist;
+} slowRecord;
+
+long dbProcStats(int count, int reset)
+{
+    DBENTRY dbentry;
+    slowRecord *slowest;
+    dbProcHist total;
+    int nslow = 0, i;
+    long nrecords = 0, status;
+
+    if (!pdbbase) {
+        printf("No database loaded\n");
+        return 0;
+    }
+    if (count <= 0)
+        count = 10;
+    slowest = callocMustSucceed(count, sizeof(slowRecord), "dbProcStats");
+    memset(&total, 0, sizeof(total));
+
+    dbInitEntry(pdbbase, &dbentry);
+    for (status = dbFirstRecordType(&dbentry); !status;
+         status = dbNextRecordType(&dbentry)) {
+        for (status = dbFirstRecord(&dbentry); !status;
+             status = dbNextRecord(&dbentry)) {
+            struct dbCommon *precord = dbentry.precnode->precord;
+            dbProcHist *phist;
+
+            if (dbIsAlias(&dbentry) || !precord ||
+                !dbRec2Pvt(precord)->procStats)
+                continue;
+            phist = &dbRec2Pvt(precord)->procStats->hist;
+            if (!phist->count)
+                continue;
+
+            nrecords++;
+            dbProcHistMerge(&total, phist);
+
+            /* insert into the list, longest maximum first */
+            for (i = nslow; i > 0 &&
+                 slowest[i - 1].phist->maxNs < phist->maxNs; i--) {
+                if (i < count)
+                    slowest[i] = slowest[i - 1];
+            }
+            if (i < count) {
+                slowest[i].precord = precord;
+                slowest[i].phist = phist;
+                if (nslow < count)
+                    nslow++;
+            }
+        }
+    }
+
+    if (!nrecords) {
+        printf("No processing times recorded%s\n",
+               dbProcStatsActive ? "" : ", run dbProcStatsEnable 1");
+    }
+    else {
+        printf("%ld records timed, times in microseconds:\n", nrecords);
+        printf("%-28s ", "All records");
+        dbProcHistShow(&total);
+        for (i = 0; i < nslow; i++) {
+            char *dtyp = NULL;
+
+            if (!dbFindRecord(&dbentry, slowest[i].precord->name) &&
+                !dbFindField(&dbentry, "DTYP"))
+                dtyp = dbGetString(&dbentry);
+            printf("%-28s ", slowest[i].precord->name);
+            dbProcHistShow(slowest[i].phist);
+            printf("    record type %s, DTYP \"%s\"\n",
+                   slowest[i].precord->rdes->name, dtyp ? dtyp : "");
+        }
+    }
+
+    if (reset) {
+        for (status = dbFirstRecordType(&dbentry); !status;
+             status = dbNextRecordType(&dbentry)) {
+            for (status = dbFirstRecord(&dbentry); !status;
+                 status = dbNextRecord(&dbentry)) {
+                struct dbCommon *precord = dbentry.precnode->precord;
+
+                if (dbIsAlias(&dbentry) || !precord ||
+                    !dbRec2Pvt(precord)->procStats)
+                    continue;
+                dbScanLock(precord);
+                memset(dbRec2Pvt(precord)->procStats, 0,
+                       sizeof(struct dbRecProcStats));
+                dbScanUnlock(precord);
+            }
+        }
+    }
+
+    dbFinishEntry(&dbentry);
+    free(slowest);
+    return 0;
+}
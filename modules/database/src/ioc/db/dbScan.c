@@ -42,8 +42,10 @@
 #include "dbAddr.h"
 #include "dbBase.h"
 #include "dbCommon.h"
+#include "dbEvent.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
+#include "dbProcStats.h"
 #include "dbScan.h"
 #include "dbStaticLib.h"
 #include "devSup.h"
@@ -70,10 +72,22 @@ static void *exitOnce;
 
 
 /* All other scan types */
+
+/* An array of the records in a scan list, in list order, which is walked
+ * without holding the list's lock.  A new snapshot is made when a scan
+ * pass finds that the list has changed since the last one was made, and
+ * the old one is freed by whoever drops the last reference to it.
+ */
+typedef struct scan_snapshot {
+    int                 refs;   /* atomic */
+    int                 count;
+    struct dbCommon     *records[1]; /* actually count */
+} scan_snapshot;
+
 typedef struct scan_list{
     epicsMutexId        lock;
     ELLLIST             list;
-    short               modified;/*has list been modified?*/
+    scan_snapshot       *snap;  /* NULL when the list has changed */
 } scan_list;
 /*scan_elements are allocated and the address stored in dbCommon.spvt*/
 typedef struct scan_element{
@@ -87,6 +101,16 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+struct periodic_scan_list;
+
+/* Helper thread for one shard of a periodic scan list */
+typedef struct scan_shard {
+    struct periodic_scan_list *ppsl;
+    int                 shard;
+    epicsEventId        go;
+    epicsThreadId       tid;
+} scan_shard;
+
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -94,12 +118,29 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    /* With nThreads > 1 the list is split by lock set between the
+     * periodic task, which scans shard 0, and nThreads-1 helpers.
+     */
+    int                 nThreads;
+    scan_shard          *shards;
+    int                 shardsBusy;  /* atomic */
+    epicsEventId        shardsDone;
+    scan_snapshot       *pass;  /* being scanned by the shards */
+    int                 *passShard; /* of each record in pass */
+    int                 passShardSize;
+    /* Kept by the periodic task while dbProcStatsActive is set */
+    dbProcHist          lateness;   /* of the start of each pass */
+    dbProcHist          passTime;
+    int                 statsReset; /* atomic, set by scanJitter() */
 } periodic_scan_list;
 
 static int nPeriodic = 0;
 static periodic_scan_list **papPeriodic; /* pointer to array of pointers */
 static epicsThreadId *periodicTaskId;    /* array of thread ids */
 
+/* Requested by scanThreads(), indexed like papPeriodic */
+static int *periodicThreads;
+
 
 static char *priorityName[NUM_CALLBACK_PRIORITIES] = {
     "Low", "Medium", "High"
@@ -121,7 +162,10 @@ static epicsMutexId event_lock;
 
 typedef struct io_scan_list {
     epicsCallback callback;
+    epicsCallback batchCallback; /* scan which posts events as a batch */
     scan_list scan_list;
+    int queued;         /* atomic, callback queued but not yet started */
+    int batchQueued;    /* atomic, likewise batchCallback */
 } io_scan_list;
 
 typedef struct ioscan_head {
@@ -129,6 +173,7 @@ typedef struct ioscan_head {
     struct io_scan_list iosl[NUM_CALLBACK_PRIORITIES];
     io_scan_complete cb;
     void *arg;
+    int coalesce;       /* merge requests made while one is queued */
 } ioscan_head;
 
 static ioscan_head *pioscan_list = NULL;
@@ -147,6 +192,11 @@ static void ioscanCallback(epicsCallback *pcallback);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
 static void scanList(scan_list *psl);
+static scan_snapshot * snapshotGet(scan_list *psl);
+static void snapshotRelease(scan_snapshot *snap);
+static int lockSetShard(struct dbCommon *precord, int nShards);
+static void scanSnapshot(scan_list *psl, scan_snapshot *snap,
+    int shard, const int *shardOf);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -186,8 +236,10 @@ void scanCleanup(void)
     epicsRingBytesDelete(onceQ);
 
     free(periodicTaskId);
+    free(periodicThreads);
     papPeriodic = NULL;
     periodicTaskId = NULL;
+    periodicThreads = NULL;
 }
 
 long scanInit(void)
@@ -401,13 +453,44 @@ int scanppl(double period)      /* print periodic scan list(s) */
             (fabs(period - ppsl->period) > 0.05))
             continue;
 
-        sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
-            ppsl->name, ppsl->overruns);
+        if (ppsl->nThreads > 1)
+            sprintf(message, "Records with SCAN = '%s' (%lu over-runs, "
+                "%d threads):", ppsl->name, ppsl->overruns, ppsl->nThreads);
+        else
+            sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
+                ppsl->name, ppsl->overruns);
         printList(&ppsl->scan_list, message);
     }
     return 0;
 }
 
+int scanJitter(int reset)   /* print periodic scan timing */
+{
+    int i;
+
+    if (!papPeriodic) {
+        printf("scanJitter: dbScan subsystem not initialized\n");
+        return -1;
+    }
+    if (!dbProcStatsActive)
+        printf("scanJitter: run dbProcStatsEnable 1 to collect timing\n");
+
+    printf("SCAN                       times in microseconds\n");
+    for (i = 0; i < nPeriodic; i++) {
+        periodic_scan_list *ppsl = papPeriodic[i];
+
+        if (!ppsl || !ellCount(&ppsl->scan_list.list))
+            continue;
+        printf("%-16s late  ", ppsl->name);
+        dbProcHistShow(&ppsl->lateness);
+        printf("%-16s pass  ", "");
+        dbProcHistShow(&ppsl->passTime);
+        if (reset)
+            epicsAtomicSetIntT(&ppsl->statsReset, 1);
+    }
+    return 0;
+}
+
 int scanpel(const char* eventname)   /* print event list */
 {
     char message[80];
@@ -578,6 +661,7 @@ static void ioscanDestroy(void)
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
             epicsMutexDestroy(piosh->iosl[prio].scan_list.lock);
             ellFree(&piosh->iosl[prio].scan_list.list);
+            snapshotRelease(piosh->iosl[prio].scan_list.snap);
         }
         free(piosh);
         piosh = pnext;
@@ -596,6 +680,9 @@ void scanIoInit(IOSCANPVT *pioscanpvt)
         callbackSetCallback(ioscanCallback, &piosl->callback);
         callbackSetPriority(prio, &piosl->callback);
         callbackSetUser(piosh, &piosl->callback);
+        callbackSetCallback(ioscanCallback, &piosl->batchCallback);
+        callbackSetPriority(prio, &piosl->batchCallback);
+        callbackSetUser(piosh, &piosl->batchCallback);
         ellInit(&piosl->scan_list.list);
         piosl->scan_list.lock = epicsMutexMustCreate();
     }
@@ -606,10 +693,11 @@ void scanIoInit(IOSCANPVT *pioscanpvt)
     *pioscanpvt = piosh;
 }
 
-/* Return a bit mask indicating each priority level
- * in which a callback request was successfully queued.
+/* Queue the scan callbacks of an I/O Intr source.
+ * With coalesce set, a priority level whose callback is already queued
+ * is not queued again; the pending scan will process the records anyway.
  */
-unsigned int scanIoRequest(IOSCANPVT piosh)
+static unsigned int ioRequest(ioscan_head *piosh, int coalesce, int batch)
 {
     int prio;
     unsigned int queued = 0;
@@ -619,15 +707,41 @@ unsigned int scanIoRequest(IOSCANPVT piosh)
 
     for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
         io_scan_list *piosl = &piosh->iosl[prio];
+        epicsCallback *pcallback =
+            batch ? &piosl->batchCallback : &piosl->callback;
+        int *pqueued = batch ? &piosl->batchQueued : &piosl->queued;
+
+        if (ellCount(&piosl->scan_list.list) == 0)
+            continue;
 
-        if (ellCount(&piosl->scan_list.list) > 0)
-            if (!callbackRequest(&piosl->callback))
-                queued |= 1 << prio;
+        if (coalesce &&
+            epicsAtomicCmpAndSwapIntT(pqueued, 0, 1) != 0) {
+            queued |= 1 << prio;
+        }
+        else if (!callbackRequest(pcallback)) {
+            queued |= 1 << prio;
+        }
+        else if (coalesce) {
+            epicsAtomicSetIntT(pqueued, 0);
+        }
     }
 
     return queued;
 }
 
+/* Return a bit mask indicating each priority level
+ * in which a callback request was successfully queued.
+ */
+unsigned int scanIoRequest(IOSCANPVT piosh)
+{
+    return ioRequest(piosh, piosh->coalesce, 0);
+}
+
+unsigned int scanIoRequestBatch(IOSCANPVT piosh)
+{
+    return ioRequest(piosh, 1, 1);
+}
+
 unsigned int scanIoImmediate(IOSCANPVT piosh, int prio)
 {
     io_scan_list *piosl;
@@ -657,6 +771,11 @@ void scanIoSetComplete(IOSCANPVT piosh, io_scan_complete cb, void *arg)
     piosh->arg = arg;
 }
 
+void scanIoSetCoalesce(IOSCANPVT piosh, int coalesce)
+{
+    piosh->coalesce = coalesce;
+}
+
 int scanOnce(struct dbCommon *precord) {
     return scanOnceCallback(precord, NULL, NULL);
 }
@@ -729,6 +848,48 @@ int scanOnceSetQueueSize(int size)
     return 0;
 }
 
+int scanThreads(const char *rate, int count)
+{
+    dbMenu *pmenu;
+    int i;
+
+    if (papPeriodic) {
+        fprintf(stderr, "scanThreads: Must be called before iocInit\n");
+        return -1;
+    }
+    if (!pdbbase) {
+        fprintf(stderr, "scanThreads: pdbbase not set\n");
+        return -1;
+    }
+    pmenu = dbFindMenu(pdbbase, "menuScan");
+    if (!pmenu) {
+        fprintf(stderr, "scanThreads: No menuScan\n");
+        return -1;
+    }
+    if (count < 1) {
+        fprintf(stderr, "scanThreads: Bad thread count %d\n", count);
+        return -1;
+    }
+    if (!rate)
+        rate = "";
+
+    for (i = SCAN_1ST_PERIODIC; i < pmenu->nChoice; i++) {
+        if (!epicsStrCaseCmp(rate, pmenu->papChoiceValue[i]))
+            break;
+    }
+    if (i == pmenu->nChoice) {
+        fprintf(stderr, "scanThreads: '%s' is not a periodic scan rate\n",
+            rate);
+        return -1;
+    }
+
+    if (!periodicThreads)
+        periodicThreads = dbCalloc(pmenu->nChoice - SCAN_1ST_PERIODIC,
+            sizeof(int));
+    periodicThreads[i - SCAN_1ST_PERIODIC] = count;
+    return 0;
+}
+
 int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result)
 {
     int ret;
@@ -779,6 +940,59 @@ static void initOnce(void)
     epicsEventWait(startStopEvent);
 }
 
+static void periodicShardTask(void *arg)
+{
+    scan_shard *pss = (scan_shard *)arg;
+    periodic_scan_list *ppsl = pss->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+
+    for (;;) {
+        epicsEventMustWait(pss->go);
+        if (ppsl->scanCtl == ctlExit)
+            break;
+
+        scanSnapshot(&ppsl->scan_list, ppsl->pass, pss->shard,
+            ppsl->passShard);
+        if (epicsAtomicDecrIntT(&ppsl->shardsBusy) == 0)
+            epicsEventMustTrigger(ppsl->shardsDone);
+    }
+
+    taskwdRemove(0);
+}
+
+static void scanPeriodicList(periodic_scan_list *ppsl)
+{
+    int i;
+
+    if (ppsl->nThreads <= 1) {
+        scanList(&ppsl->scan_list);
+        return;
+    }
+
+    /* All shards scan the same snapshot.  Each record's shard is fixed
+     * for the whole pass, so lock sets which merge or split meanwhile
+     * can't make a record be skipped or processed twice.
+     */
+    ppsl->pass = snapshotGet(&ppsl->scan_list);
+    if (ppsl->pass->count > ppsl->passShardSize) {
+        free(ppsl->passShard);
+        ppsl->passShard = dbCalloc(ppsl->pass->count, sizeof(int));
+        ppsl->passShardSize = ppsl->pass->count;
+    }
+    for (i = 0; i < ppsl->pass->count; i++)
+        ppsl->passShard[i] = lockSetShard(ppsl->pass->records[i],
+            ppsl->nThreads);
+
+    epicsAtomicSetIntT(&ppsl->shardsBusy, ppsl->nThreads - 1);
+    for (i = 1; i < ppsl->nThreads; i++)
+        epicsEventMustTrigger(ppsl->shards[i].go);
+    scanSnapshot(&ppsl->scan_list, ppsl->pass, 0, ppsl->passShard);
+    epicsEventMustWait(ppsl->shardsDone);
+    snapshotRelease(ppsl->pass);
+    ppsl->pass = NULL;
+}
+
 static void periodicTask(void *arg)
 {
     periodic_scan_list *ppsl = (periodic_scan_list *)arg;
@@ -789,6 +1003,7 @@ static void periodicTask(void *arg)
     double over_min = 0.0;
     double over_max = 0.0;
     const double penalty = (ppsl->period >= 2) ? 1 : (ppsl->period / 2);
+    int i;
 
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
@@ -800,8 +1015,28 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (epicsAtomicCmpAndSwapIntT(&ppsl->statsReset, 1, 0)) {
+            memset(&ppsl->lateness, 0, sizeof(dbProcHist));
+            memset(&ppsl->passTime, 0, sizeof(dbProcHist));
+        }
+
+        if (ppsl->scanCtl == ctlRun) {
+            if (dbProcStatsActive) {
+                epicsTimeStamp start, end;
+                double late;
+
+                epicsTimeGetMonotonic(&start);
+                late = epicsTimeDiffInSeconds(&start, &next);
+                dbProcHistAdd(&ppsl->lateness,
+                    late > 0.0 ? (epicsUInt64)(late * 1e9) : 0);
+                scanPeriodicList(ppsl);
+                epicsTimeGetMonotonic(&end);
+                dbProcHistAdd(&ppsl->passTime,
+                    (epicsUInt64)(epicsTimeDiffInSeconds(&end, &start) * 1e9));
+            }
+            else
+                scanPeriodicList(ppsl);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetMonotonic(&now);
@@ -846,6 +1081,11 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    for (i = 1; i < ppsl->nThreads; i++) {
+        epicsEventMustTrigger(ppsl->shards[i].go);
+        epicsThreadMustJoin(ppsl->shards[i].tid);
+    }
+
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
@@ -904,6 +1144,19 @@ static void initPeriodic(void)
         ppsl->name = choice;
         ppsl->scanCtl = ctlPause;
         ppsl->loopEvent = epicsEventMustCreate(epicsEventEmpty);
+        ppsl->nThreads = 1;
+        if (periodicThreads && periodicThreads[i] > 1) {
+            int j;
+
+            ppsl->nThreads = periodicThreads[i];
+            ppsl->shards = dbCalloc(ppsl->nThreads, sizeof(scan_shard));
+            ppsl->shardsDone = epicsEventMustCreate(epicsEventEmpty);
+            for (j = 1; j < ppsl->nThreads; j++) {
+                ppsl->shards[j].ppsl = ppsl;
+                ppsl->shards[j].shard = j;
+                ppsl->shards[j].go = epicsEventMustCreate(epicsEventEmpty);
+            }
+        }
 
         number = ppsl->period / quantum;
         if ((ppsl->period < 2 * quantum) ||
@@ -925,7 +1178,17 @@ static void deletePeriodic(void)
 
         if (!ppsl) continue;
         ellFree(&ppsl->scan_list.list);
+        snapshotRelease(ppsl->scan_list.snap);
         epicsEventDestroy(ppsl->loopEvent);
+        if (ppsl->shards) {
+            int j;
+
+            for (j = 1; j < ppsl->nThreads; j++)
+                epicsEventDestroy(ppsl->shards[j].go);
+            epicsEventDestroy(ppsl->shardsDone);
+            free(ppsl->shards);
+            free(ppsl->passShard);
+        }
         epicsMutexDestroy(ppsl->scan_list.lock);
         free(ppsl);
     }
@@ -937,7 +1200,8 @@ static void deletePeriodic(void)
 static void spawnPeriodic(int ind)
 {
     periodic_scan_list *ppsl = papPeriodic[ind];
-    char taskName[20];
+    char taskName[32];
+    int i;
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
     opts.joinable = 1;
     opts.priority = epicsThreadPriorityScanLow + ind;
@@ -945,6 +1209,12 @@ static void spawnPeriodic(int ind)
 
     if (!ppsl) return;
 
+    for (i = 1; i < ppsl->nThreads; i++) {
+        sprintf(taskName, "scan-%g-%d", ppsl->period, i);
+        ppsl->shards[i].tid = epicsThreadCreateOpt(
+            taskName, periodicShardTask, &ppsl->shards[i], &opts);
+    }
+
     sprintf(taskName, "scan-%g", ppsl->period);
     periodicTaskId[ind] = epicsThreadCreateOpt(
         taskName, periodicTask, (void *)ppsl, &opts);
@@ -957,9 +1227,25 @@ static void ioscanCallback(epicsCallback *pcallback)
     ioscan_head *piosh;
     int prio;
 
+    io_scan_list *piosl;
+
     callbackGetUser(piosh, pcallback);
     callbackGetPriority(prio, pcallback);
-    scanList(&piosh->iosl[prio].scan_list);
+    piosl = &piosh->iosl[prio];
+
+    /* Requests arriving from here on need another scan */
+    if (pcallback == &piosl->batchCallback) {
+        dbEventBatch batch;
+
+        epicsAtomicSetIntT(&piosl->batchQueued, 0);
+        db_event_batch_begin(&batch);
+        scanList(&piosl->scan_list);
+        db_event_batch_end(&batch);
+    }
+    else {
+        epicsAtomicSetIntT(&piosl->queued, 0);
+        scanList(&piosl->scan_list);
+    }
     if (piosh->cb)
         piosh->cb(piosh->arg, piosh, prio);
 }
@@ -991,61 +1277,82 @@ static void printList(scan_list *psl, char *message)
 
 static void scanList(scan_list *psl)
 {
-    /* When reading this code remember that the call to dbProcess can result
-     * in the SCAN field being changed in an arbitrary number of records.
-     */
+    scan_snapshot *snap = snapshotGet(psl);
 
-    scan_element *pse;
-    scan_element *prev = NULL;
-    scan_element *next = NULL;
+    scanSnapshot(psl, snap, 0, NULL);
+    snapshotRelease(snap);
+}
+
+static scan_snapshot * snapshotGet(scan_list *psl)
+{
+    scan_snapshot *snap;
 
     epicsMutexMustLock(psl->lock);
-    psl->modified = FALSE;
-    pse = (scan_element *)ellFirst(&psl->list);
-    if (pse) next = (scan_element *)ellNext(&pse->node);
+    snap = psl->snap;
+    if (!snap) {
+        ELLNODE *node;
+        int n = 0;
+
+        snap = dbCalloc(1, sizeof(scan_snapshot) +
+            ellCount(&psl->list) * sizeof(struct dbCommon *));
+        for (node = ellFirst(&psl->list); node; node = ellNext(node))
+            snap->records[n++] = ((scan_element *)node)->precord;
+        snap->count = n;
+        snap->refs = 1;     /* held by the list */
+        psl->snap = snap;
+    }
+    epicsAtomicIncrIntT(&snap->refs);
     epicsMutexUnlock(psl->lock);
+    return snap;
+}
 
-    while (pse) {
-        struct dbCommon *precord = pse->precord;
+static void snapshotRelease(scan_snapshot *snap)
+{
+    if (snap && epicsAtomicDecrIntT(&snap->refs) == 0)
+        free(snap);
+}
+
+/* Caller holds psl->lock */
+static void snapshotInvalidate(scan_list *psl)
+{
+    snapshotRelease(psl->snap);
+    psl->snap = NULL;
+}
+
+/* Lock set ids are handed out sequentially, often in steps, so they are
+ * hashed before being divided between the shards.  Records in one lock
+ * set when a pass starts are thus in the same shard for that pass.
+ */
+static int lockSetShard(struct dbCommon *precord, int nShards)
+{
+    epicsUInt32 id = (epicsUInt32)dbLockGetLockId(precord);
+
+    return (int)((id * 0x9e3779b1u) >> 16) % nShards;
+}
+
+/* With shardOf, only scan the records which it puts in shard */
+static void scanSnapshot(scan_list *psl, scan_snapshot *snap,
+    int shard, const int *shardOf)
+{
+    int i;
+
+    for (i = 0; i < snap->count; i++) {
+        struct dbCommon *precord = snap->records[i];
+        scan_element *pse = precord->spvt;
+
+        if (shardOf && shardOf[i] != shard)
+            continue;
 
         dbScanLock(precord);
-        dbProcess(precord);
+        /* SCAN is only changed with the record locked, so this tells
+         * whether the record has left the list since the snapshot.
+         */
+        if (pse->pscan_list == psl)
+            dbProcess(precord);
         dbScanUnlock(precord);
-
-        epicsMutexMustLock(psl->lock);
-        if (!psl->modified) {
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-        } else if (pse->pscan_list == psl) {
-            /*This scan element is still in same scan list*/
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else if (prev && prev->pscan_list == psl) {
-            /*Previous scan element is still in same scan list*/
-            pse = (scan_element *)ellNext(&prev->node);
-            if (pse) {
-                prev = (scan_element *)ellPrevious(&pse->node);
-                next = (scan_element *)ellNext(&pse->node);
-            }
-            psl->modified = FALSE;
-        } else if (next && next->pscan_list == psl) {
-            /*Next scan element is still in same scan list*/
-            pse = next;
-            prev = (scan_element *)ellPrevious(&pse->node);
-            next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else {
-            /*Too many changes. Just wait till next period*/
-            epicsMutexUnlock(psl->lock);
-            return;
-        }
-        epicsMutexUnlock(psl->lock);
     }
 }
-
+
 static void buildScanLists(void)
 {
     dbRecordType *pdbRecordType;
@@ -1087,7 +1394,7 @@ static void addToList(struct dbCommon *precord, scan_list *psl)
         ptemp = (scan_element *)ellPrevious(&ptemp->node);
     }
     ellInsert(&psl->list, (ptemp ? &ptemp->node : NULL), &pse->node);
-    psl->modified = TRUE;
+    snapshotInvalidate(psl);
     epicsMutexUnlock(psl->lock);
 }
 
@@ -1113,6 +1420,6 @@ static void deleteFromList(struct dbCommon *precord, scan_list *psl)
     }
     pse->pscan_list = NULL;
     ellDelete(&psl->list, &pse->node);
-    psl->modified = TRUE;
+    snapshotInvalidate(psl);
     epicsMutexUnlock(psl->lock);
 }
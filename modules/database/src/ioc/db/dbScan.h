@@ -67,6 +67,8 @@ DBCORE_API int scanOnceCallback(struct dbCommon *, once_complete cb, void *usr);
 DBCORE_API int scanOnceSetQueueSize(int size);
 DBCORE_API int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result);
 DBCORE_API void scanOnceQueueShow(const int reset);
+DBCORE_API int scanThreads(const char *rate, int count);
+DBCORE_API int scanJitter(int reset);
 
 /*print periodic lists*/
 DBCORE_API int scanppl(double rate);
@@ -81,6 +83,15 @@ DBCORE_API void scanIoInit(IOSCANPVT *ppios);
 DBCORE_API unsigned int scanIoRequest(IOSCANPVT pios);
 DBCORE_API unsigned int scanIoImmediate(IOSCANPVT pios, int prio);
 DBCORE_API void scanIoSetComplete(IOSCANPVT, io_scan_complete, void *usr);
+/* Merge scanIoRequest() calls made while a scan is already queued.
+ * May not be called while a scan request is queued or running.
+ */
+DBCORE_API void scanIoSetCoalesce(IOSCANPVT, int coalesce);
+/* Like scanIoRequest(), but always coalesces, and the resulting scan
+ * wakes each monitor event task only once, after all records have been
+ * processed, rather than once per posted event.
+ */
+DBCORE_API unsigned int scanIoRequestBatch(IOSCANPVT pios);
 
 #ifdef __cplusplus
 }
@@ -100,6 +100,9 @@ struct dbfl_val {
  * must explicitly call the dtor function.
  * If the dtor is NULL and no_elements > 0, then this means the array
  * data is still owned by a record. See the macro dbfl_has_copy below.
+ * The data may be a snapshot shared with the field logs of other
+ * subscriptions (see db_post_array_events()), so it must not be
+ * modified in place.
  */
 struct dbfl_ref {
     void              *pvt;   /* Private pointer */
@@ -200,20 +200,31 @@ unsigned short recGblResetAlarms(void *precord)
 
     if (prev_sevr != new_sevr) {
         stat_mask = DBE_ALARM;
-        db_post_events(pdbc, &pdbc->sevr, DBE_VALUE);
     }
     if (prev_stat != new_stat) {
         stat_mask |= DBE_VALUE;
     }
     if (stat_mask) {
-        db_post_events(pdbc, &pdbc->stat, stat_mask);
-        db_post_events(pdbc, &pdbc->amsg, stat_mask);
+        void *fields[4];
+        unsigned masks[4];
+        unsigned n = 0;
+
+        if (prev_sevr != new_sevr) {
+            fields[n] = &pdbc->sevr;
+            masks[n++] = DBE_VALUE;
+        }
+        fields[n] = &pdbc->stat;
+        masks[n++] = stat_mask;
+        fields[n] = &pdbc->amsg;
+        masks[n++] = stat_mask;
         val_mask = DBE_ALARM;
 
         if (!pdbc->ackt || new_sevr >= pdbc->acks) {
             pdbc->acks = new_sevr;
-            db_post_events(pdbc, &pdbc->acks, DBE_VALUE);
+            fields[n] = &pdbc->acks;
+            masks[n++] = DBE_VALUE;
         }
+        db_post_events_many(pdbc, fields, masks, n);
 
         if (recGblAlarmHook) {
             (*recGblAlarmHook)(pdbc, prev_sevr, prev_stat);
@@ -17,31 +17,158 @@
 
 #include "dbDefs.h"
 #include "ellLib.h"
+#include "epicsAtomic.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
+#include "epicsTypes.h"
 
 #include "dbBase.h"
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 
-typedef struct {
-    ELLLIST      list;
-    epicsMutexId lock;
-} dbPvdBucket;
-
-typedef struct dbPvd {
+/*
+ * The process variable directory is an open addressing hash table with
+ * linear probing.  dbPvdFind() takes no locks, so CA name searches don't
+ * contend with each other.  Additions and deletions are serialized by a
+ * mutex and only ever change a slot from empty to an entry, or from an
+ * entry to the deleted marker.  Table pointers and slots are published
+ * with a write barrier and read with a read barrier, as epicsAtomic
+ * loads and stores alone don't order other memory accesses.
+ *
+ * Deleted PVDENTRYs and replaced tables are only freed once no reader
+ * can still be probing them.  Readers count themselves in one of two
+ * counters, selected by the parity of an epoch number.  To reclaim the
+ * memory unlinked so far a writer advances the epoch, so new readers use
+ * the other counter, and frees it once the old counter has dropped to
+ * zero.  Until then later unlinked memory waits for the next epoch.  The
+ * writer never waits for readers, it checks again on its next change.
+ * Deleted markers are not copied when the table is replaced.  As before,
+ * the entry dbPvdFind() returns is only valid until its record is deleted.
+ *
+ * The table is replaced by one at least twice the size when more than
+ * half of its slots are used.  Entries are moved to the new table a few
+ * slots at a time by each following dbPvdAdd(), and lookups which miss in
+ * the new table also search the old one until that has been emptied.
+ *
+ * Most names looked up, e.g. by CA UDP searches, are for records held by
+ * some other IOC.  Each table has a blocked Bloom filter with 8 bits per
+ * slot, so most of those misses are rejected after reading one word
+ * without probing the table.  Bits are never cleared, so names which were
+ * deleted only cost a probe, until the table is next replaced.
+ */
+
+typedef struct dbPvdSlot {
+    PVDENTRY *entry;        /* NULL if never used, use atomic */
+    unsigned int hash;          /* written before entry */
+} dbPvdSlot;
+
+typedef struct dbPvdTable {
+    /* table being moved into this one, or NULL */
+    struct dbPvdTable *prev;    /* use atomic */
+    struct dbPvdTable *retired;
     unsigned int size;
     unsigned int mask;
-    dbPvdBucket **buckets;
+    unsigned int used;      /* entries plus deleted markers */
+    unsigned int live;
+    epicsUInt32 *filter;    /* size/4 words, follows the slots */
+    unsigned int filterMask;
+    dbPvdSlot slots[1];
+} dbPvdTable;
+
+typedef struct dbPvd {
+    epicsMutexId lock;
+    dbPvdTable *table;      /* use atomic */
+    unsigned int moved;     /* slots of table->prev already moved */
+    dbPvdTable *retired;    /* replaced tables, not yet in reclaim */
+    dbPvdTable *reclaim;    /* freed when no readers of reclaimEpoch */
+    ELLLIST deleted;        /* deleted entries, not yet in reclaim */
+    ELLLIST reclaimDeleted; /* freed with reclaim */
+    int epoch;              /* use atomic */
+    int readers[2];         /* readers by epoch parity, use atomic */
+    int reclaimEpoch;       /* of the readers which may use reclaim */
 } dbPvd;
 
+static PVDENTRY pvdDeleted;
+#define PVD_DELETED (&pvdDeleted)
+
 unsigned int dbPvdHashTableSize = 0;
 
 #define MIN_SIZE 256
 #define DEFAULT_SIZE 512
-#define MAX_SIZE 65536
 
+/* Slots of the old table moved by each dbPvdAdd() while resizing */
+#define MOVE_STEP 16
+
+
+/* Read a pointer written by dbPvdStore() by another thread, and
+ * what was written before it.
+ */
+static void * dbPvdLoad(void * const *ptarget)
+{
+    void *value = epicsAtomicGetPtrT((const EpicsAtomicPtrT *) ptarget);
+
+    epicsAtomicReadMemoryBarrier();
+    return value;
+}
+
+static void dbPvdStore(void **ptarget, void *value)
+{
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT((EpicsAtomicPtrT *) ptarget, value);
+}
+
+/* Returns the epoch to pass to dbPvdReadEnd() */
+static int dbPvdReadBegin(dbPvd *ppvd)
+{
+    for (;;) {
+        int epoch = epicsAtomicGetIntT(&ppvd->epoch);
+
+        epicsAtomicIncrIntT(&ppvd->readers[epoch & 1]);
+        /* the writer advanced the epoch first, so it may not see us */
+        if (epicsAtomicGetIntT(&ppvd->epoch) == epoch)
+            return epoch;
+        epicsAtomicDecrIntT(&ppvd->readers[epoch & 1]);
+    }
+}
+
+static void dbPvdReadEnd(dbPvd *ppvd, int epoch)
+{
+    epicsAtomicDecrIntT(&ppvd->readers[epoch & 1]);
+}
+
+static void dbPvdFreeTables(dbPvdTable *ptable)
+{
+    while (ptable) {
+        dbPvdTable *pnext = ptable->retired;
+
+        free(ptable);
+        ptable = pnext;
+    }
+}
+
+/* Free unlinked memory no reader can be using, and start the grace
+ * period of what was unlinked since.  Caller holds ppvd->lock
+ */
+static void dbPvdReclaim(dbPvd *ppvd)
+{
+    if (ppvd->reclaim || ellCount(&ppvd->reclaimDeleted)) {
+        if (epicsAtomicGetIntT(&ppvd->readers[ppvd->reclaimEpoch & 1]))
+            return;
+        dbPvdFreeTables(ppvd->reclaim);
+        ppvd->reclaim = NULL;
+        ellFree(&ppvd->reclaimDeleted);
+    }
+    if (!ppvd->retired && !ellCount(&ppvd->deleted))
+        return;
+
+    ppvd->reclaim = ppvd->retired;
+    ppvd->retired = NULL;
+    ellConcat(&ppvd->reclaimDeleted, &ppvd->deleted);
+    ppvd->reclaimEpoch = ppvd->epoch;
+    /* a full barrier, after unlinking and before counting readers */
+    epicsAtomicIncrIntT(&ppvd->epoch);
+}
 
 int dbPvdTableSize(int size)
 {
@@ -53,13 +180,48 @@ int dbPvdTableSize(int size)
     if (size < MIN_SIZE)
         size = MIN_SIZE;
 
-    if (size > MAX_SIZE)
-        size = MAX_SIZE;
-
     dbPvdHashTableSize = size;
     return 0;
 }
 
+static dbPvdTable * dbPvdTableCreate(unsigned int size)
+{
+    dbPvdTable *ptable = dbCalloc(1, sizeof(dbPvdTable) +
+        (size - 1) * sizeof(dbPvdSlot) + size / 4 * sizeof(epicsUInt32));
+
+    ptable->size = size;
+    ptable->mask = size - 1;
+    ptable->filter = (epicsUInt32 *) &ptable->slots[size];
+    ptable->filterMask = size / 4 - 1;
+    return ptable;
+}
+
+/* The filter word and bits for a name, taken from remixed hash bits
+ * since the low bits select the table slot.
+ */
+static epicsUInt32 * dbPvdFilterWord(const dbPvdTable *ptable,
+    unsigned int hash)
+{
+    epicsUInt32 x = hash * 0x9e3779b1u;
+
+    return &ptable->filter[(x ^ (x >> 16)) & ptable->filterMask];
+}
+
+static epicsUInt32 dbPvdFilterBits(unsigned int hash)
+{
+    epicsUInt32 x = hash * 0x85ebca6bu;
+
+    return (1u << (x >> 27)) | (1u << ((x >> 22) & 31)) |
+        (1u << ((x >> 17) & 31));
+}
+
+static int dbPvdMayHold(const dbPvdTable *ptable, unsigned int hash)
+{
+    epicsUInt32 bits = dbPvdFilterBits(hash);
+
+    return (*dbPvdFilterWord(ptable, hash) & bits) == bits;
+}
+
 void dbPvdInitPvt(dbBase *pdbbase)
 {
     dbPvd *ppvd;
@@ -70,131 +232,252 @@ void dbPvdInitPvt(dbBase *pdbbase)
         dbPvdHashTableSize = DEFAULT_SIZE;
     }
 
-    ppvd = (dbPvd *)dbMalloc(sizeof(dbPvd));
-    ppvd->size    = dbPvdHashTableSize;
-    ppvd->mask    = dbPvdHashTableSize - 1;
-    ppvd->buckets = dbCalloc(ppvd->size, sizeof(dbPvdBucket *));
+    ppvd = (dbPvd *)dbCalloc(1, sizeof(dbPvd));
+    ppvd->lock = epicsMutexMustCreate();
+    ppvd->table = dbPvdTableCreate(dbPvdHashTableSize);
+    ellInit(&ppvd->deleted);
+    ellInit(&ppvd->reclaimDeleted);
 
     pdbbase->ppvd = ppvd;
     return;
 }
 
+static PVDENTRY * dbPvdProbe(const dbPvdTable *ptable, const char *name,
+    size_t lenName, unsigned int hash)
+{
+    unsigned int i = hash & ptable->mask;
+
+    for (;; i = (i + 1) & ptable->mask) {
+        const dbPvdSlot *pslot = &ptable->slots[i];
+        PVDENTRY *ppvdNode = dbPvdLoad((void * const *) &pslot->entry);
+
+        if (!ppvdNode)
+            return NULL;
+
+        if (ppvdNode != PVD_DELETED && pslot->hash == hash) {
+            const char *recordname = ppvdNode->precnode->recordname;
+
+            if (strncmp(name, recordname, lenName) == 0 &&
+                recordname[lenName] == '\0')
+                return ppvdNode;
+        }
+    }
+}
+
 PVDENTRY *dbPvdFind(dbBase *pdbbase, const char *name, size_t lenName)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
-    PVDENTRY *ppvdNode;
+    int epoch = dbPvdReadBegin(ppvd);
+    dbPvdTable *ptable = dbPvdLoad((void * const *) &ppvd->table);
+    /* Before probing ptable, as an entry only moved after that probe
+     * would otherwise be missed in both tables.
+     */
+    dbPvdTable *pprev = dbPvdLoad((void * const *) &ptable->prev);
+    unsigned int hash = epicsMemHash(name, lenName, 0);
+    PVDENTRY *ppvdNode = NULL;
+
+    if (dbPvdMayHold(ptable, hash))
+        ppvdNode = dbPvdProbe(ptable, name, lenName, hash);
+
+    if (!ppvdNode && pprev && dbPvdMayHold(pprev, hash))
+        ppvdNode = dbPvdProbe(pprev, name, lenName, hash);
+
+    dbPvdReadEnd(ppvd, epoch);
+    return ppvdNode;
+}
+
+int dbPvdFilterMayHold(dbBase *pdbbase, const char *name, size_t lenName)
+{
+    dbPvd *ppvd = pdbbase->ppvd;
+    int epoch = dbPvdReadBegin(ppvd);
+    dbPvdTable *ptable = dbPvdLoad((void * const *) &ppvd->table);
+    dbPvdTable *pprev = dbPvdLoad((void * const *) &ptable->prev);
+    unsigned int hash = epicsMemHash(name, lenName, 0);
+    int mayHold = dbPvdMayHold(ptable, hash) ||
+        (pprev && dbPvdMayHold(pprev, hash));
+
+    dbPvdReadEnd(ppvd, epoch);
+    return mayHold;
+}
+
+/* Caller holds ppvd->lock */
+static void dbPvdInsert(dbPvdTable *ptable, PVDENTRY *ppvdNode,
+    unsigned int hash)
+{
+    unsigned int i = hash & ptable->mask;
+
+    while (ptable->slots[i].entry)
+        i = (i + 1) & ptable->mask;
+
+    ptable->slots[i].hash = hash;
+    *dbPvdFilterWord(ptable, hash) |= dbPvdFilterBits(hash);
+    dbPvdStore((void **) &ptable->slots[i].entry, ppvdNode);
+    ptable->used++;
+    ptable->live++;
+}
 
-    pbucket = ppvd->buckets[epicsMemHash(name, lenName, 0) & ppvd->mask];
-    if (pbucket == NULL) return NULL;
+/* Move up to nslots slots of the previous table.  Caller holds ppvd->lock */
+static void dbPvdMove(dbPvd *ppvd, unsigned int nslots)
+{
+    dbPvdTable *ptable = ppvd->table;
+    dbPvdTable *pprev = ptable->prev;
+
+    if (!pprev) return;
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        const char *recordname = ppvdNode->precnode->recordname;
+    while (nslots-- && ppvd->moved < pprev->size) {
+        dbPvdSlot *pslot = &pprev->slots[ppvd->moved++];
+        PVDENTRY *ppvdNode = pslot->entry;
 
-        if (strncmp(name, recordname, lenName) == 0 &&
-            strlen(recordname) == lenName)
-            break;
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+        if (ppvdNode && ppvdNode != PVD_DELETED)
+            dbPvdInsert(ptable, ppvdNode, pslot->hash);
     }
-    epicsMutexUnlock(pbucket->lock);
-    return ppvdNode;
+
+    if (ppvd->moved == pprev->size) {
+        dbPvdStore((void **) &ptable->prev, NULL);
+        pprev->retired = ppvd->retired;
+        ppvd->retired = pprev;
+    }
+}
+
+/* Caller holds ppvd->lock */
+static void dbPvdGrow(dbPvd *ppvd)
+{
+    dbPvdTable *ptable = ppvd->table;
+    dbPvdTable *pnew;
+    unsigned int size = ptable->size;
+
+    /* finish any earlier resize first */
+    dbPvdMove(ppvd, ~0u);
+
+    dbPvdReclaim(ppvd);
+
+    /* A table full of deleted markers is just rebuilt at the same size */
+    while (size < 4 * ptable->live)
+        size *= 2;
+
+    pnew = dbPvdTableCreate(size);
+    pnew->prev = ptable;
+    ppvd->moved = 0;
+    dbPvdStore((void **) &ppvd->table, pnew);
 }
-
+
 PVDENTRY *dbPvdAdd(dbBase *pdbbase, dbRecordType *precordType,
     dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptable;
     PVDENTRY *ppvdNode;
     char *name = precnode->recordname;
-    unsigned int h;
-
-    h = epicsStrHash(name, 0) & ppvd->mask;
-    pbucket = ppvd->buckets[h];
-    if (pbucket == NULL) {
-        pbucket = dbCalloc(1, sizeof(dbPvdBucket));
-        ellInit(&pbucket->list);
-        pbucket->lock = epicsMutexCreate();
-        ppvd->buckets[h] = pbucket;
-    }
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            epicsMutexUnlock(pbucket->lock);
-            return NULL;
-        }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+    size_t lenName = strlen(name);
+    unsigned int hash = epicsStrHash(name, 0);
+
+    epicsMutexMustLock(ppvd->lock);
+    dbPvdMove(ppvd, MOVE_STEP);
+    ptable = ppvd->table;
+
+    if (dbPvdProbe(ptable, name, lenName, hash) ||
+        (ptable->prev && dbPvdProbe(ptable->prev, name, lenName, hash))) {
+        epicsMutexUnlock(ppvd->lock);
+        return NULL;
     }
+
+    if (2 * (ptable->used + 1) > ptable->size) {
+        dbPvdGrow(ppvd);
+        ptable = ppvd->table;
+    }
+
     ppvdNode = dbCalloc(1, sizeof(PVDENTRY));
     ppvdNode->precordType = precordType;
     ppvdNode->precnode = precnode;
-    ellAdd(&pbucket->list, (ELLNODE *)ppvdNode);
-    epicsMutexUnlock(pbucket->lock);
+    dbPvdInsert(ptable, ppvdNode, hash);
+    epicsMutexUnlock(ppvd->lock);
     return ppvdNode;
 }
 
+/* Returns the entry which was deleted.  Caller holds ppvd->lock */
+static PVDENTRY * dbPvdRemove(dbPvdTable *ptable, const char *name,
+    unsigned int hash)
+{
+    unsigned int i = hash & ptable->mask;
+
+    for (;; i = (i + 1) & ptable->mask) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+        PVDENTRY *ppvdNode = pslot->entry;
+
+        if (!ppvdNode)
+            return NULL;
+
+        if (ppvdNode != PVD_DELETED && pslot->hash == hash &&
+            ppvdNode->precnode &&
+            ppvdNode->precnode->recordname &&
+            strcmp(name, ppvdNode->precnode->recordname) == 0) {
+            dbPvdStore((void **) &pslot->entry, PVD_DELETED);
+            ptable->live--;
+            return ppvdNode;
+        }
+    }
+}
+
 void dbPvdDelete(dbBase *pdbbase, dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptable;
     PVDENTRY *ppvdNode;
     char *name = precnode->recordname;
+    unsigned int hash = epicsStrHash(name, 0);
 
-    pbucket = ppvd->buckets[epicsStrHash(name, 0) & ppvd->mask];
-    if (pbucket == NULL) return;
+    epicsMutexMustLock(ppvd->lock);
+    ptable = ppvd->table;
+    /* while resizing an entry can be in both tables */
+    ppvdNode = dbPvdRemove(ptable, name, hash);
+    if (ptable->prev) {
+        PVDENTRY *pold = dbPvdRemove(ptable->prev, name, hash);
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (ppvdNode->precnode &&
-            ppvdNode->precnode->recordname &&
-            strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
-            free(ppvdNode);
-            break;
-        }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+        if (!ppvdNode)
+            ppvdNode = pold;
     }
-    epicsMutexUnlock(pbucket->lock);
+    /* a reader may still be looking at it */
+    if (ppvdNode)
+        ellAdd(&ppvd->deleted, &ppvdNode->node);
+    dbPvdReclaim(ppvd);
+    epicsMutexUnlock(ppvd->lock);
     return;
 }
 
 void dbPvdFreeMem(dbBase *pdbbase)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    unsigned int h;
+    dbPvdTable *ptable;
+    unsigned int i;
 
     if (ppvd == NULL) return;
     pdbbase->ppvd = NULL;
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
+    epicsMutexMustLock(ppvd->lock);
+    dbPvdMove(ppvd, ~0u);
+    ptable = ppvd->table;
+    for (i = 0; i < ptable->size; i++) {
+        PVDENTRY *ppvdNode = ptable->slots[i].entry;
 
-        if (pbucket == NULL) continue;
-        epicsMutexMustLock(pbucket->lock);
-        ppvd->buckets[h] = NULL;
-        while ((ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list))) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
+        if (ppvdNode && ppvdNode != PVD_DELETED)
             free(ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
-        epicsMutexDestroy(pbucket->lock);
-        free(pbucket);
     }
-    free(ppvd->buckets);
+    free(ptable);
+    dbPvdFreeTables(ppvd->retired);
+    dbPvdFreeTables(ppvd->reclaim);
+    ellFree(&ppvd->deleted);
+    ellFree(&ppvd->reclaimDeleted);
+    epicsMutexUnlock(ppvd->lock);
+    epicsMutexDestroy(ppvd->lock);
     free(ppvd);
 }
 
 void dbPvdDump(dbBase *pdbbase, int verbose)
 {
-    unsigned int empty = 0;
     dbPvd *ppvd;
-    unsigned int h;
+    dbPvdTable *ptable;
+    unsigned int i, maxProbe = 0, filterBits = 0;
+    double sumProbe = 0.0;
 
     if (!pdbbase) {
         fprintf(stderr,"pdbbase not specified\n");
@@ -203,27 +486,43 @@ void dbPvdDump(dbBase *pdbbase, int verbose)
     ppvd = pdbbase->ppvd;
     if (ppvd == NULL) return;
 
-    printf("Process Variable Directory has %u buckets", ppvd->size);
+    epicsMutexMustLock(ppvd->lock);
+    dbPvdMove(ppvd, ~0u);
+    ptable = ppvd->table;
+
+    printf("Process Variable Directory has %u slots, %u entries, "
+        "%u deleted\n", ptable->size, ptable->live,
+        ptable->used - ptable->live);
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
-        int i = 1;
+    for (i = 0; i < ptable->size; i++) {
+        PVDENTRY *ppvdNode = ptable->slots[i].entry;
+        unsigned int probe;
 
-        if (pbucket == NULL) {
-            empty++;
+        if (!ppvdNode || ppvdNode == PVD_DELETED)
             continue;
+
+        /* slots from the home position to this one */
+        probe = ((i - ptable->slots[i].hash) & ptable->mask) + 1;
+        sumProbe += probe;
+        if (probe > maxProbe)
+            maxProbe = probe;
+        if (verbose)
+            printf(" [%6u] %3u  %s\n", i, probe,
+                ppvdNode->precnode->recordname);
+    }
+    if (ptable->live)
+        printf("Probes per lookup: %.2f average, %u maximum\n",
+            sumProbe / ptable->live, maxProbe);
+
+    for (i = 0; i <= ptable->filterMask; i++) {
+        epicsUInt32 word = ptable->filter[i];
+
+        while (word) {
+            word &= word - 1;
+            filterBits++;
         }
-        epicsMutexMustLock(pbucket->lock);
-        ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-        printf("\n [%4u] %4d  ", h, ellCount(&pbucket->list));
-        while (ppvdNode && verbose) {
-            if (!(++i % 4))
-                printf("\n         ");
-            printf("  %s", ppvdNode->precnode->recordname);
-            ppvdNode = (PVDENTRY *) ellNext((ELLNODE*)ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
     }
-    printf("\n%u buckets empty.\n", empty);
+    printf("Name filter has %.1f%% of its bits set\n",
+        100.0 * filterBits / (ptable->size * 8.0));
+    epicsMutexUnlock(ppvd->lock);
 }
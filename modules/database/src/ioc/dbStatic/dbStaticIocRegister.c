@@ -181,10 +181,11 @@ static const iocshFuncDef dbPvdDumpFuncDef = {
     "dbPvdDump",
     2,
     dbPvdDumpArgs,
-    "Dump the various buckets of the process variable directory.\n"
-    "If verbose is greater than 0, also print the process variables in each bucket.\n"
+    "Show the size and usage of the process variable directory.\n"
+    "If verbose is greater than 0, also print each process variable with its\n"
+    "slot and the number of slots probed to find it.\n"
     "Example: dbPvdDump pdbbase 1\n"
-    "If the last argument(s) are missing, dump all buckets as though verbose is 0.\n",
+    "If the last argument(s) are missing, dump as though verbose is 0.\n",
 };
 static void dbPvdDumpCallFunc(const iocshArgBuf *args)
 {
@@ -199,7 +200,7 @@ static const iocshFuncDef dbPvdTableSizeFuncDef = {
     "dbPvdTableSize",
     1,
     dbPvdTableSizeArgs,
-    "Change the number of buckets in the process variable directory.\n\n"
+    "Change the initial number of slots in the process variable directory.\n\n"
     "The process variable directory size should be set before loading the database.\n"
     "The size of the process variable directory can automatically grow.\n"
     "The size must be a power of 2.\n\n"
@@ -116,6 +116,8 @@ PVDENTRY *dbPvdFind(DBBASE *pdbbase,const char *name,size_t lenname);
 PVDENTRY *dbPvdAdd(DBBASE *pdbbase,dbRecordType *precordType,dbRecordNode *precnode);
 void dbPvdDelete(DBBASE *pdbbase,dbRecordNode *precnode);
 void dbPvdFreeMem(DBBASE *pdbbase);
+/* For tests: is the name passed by the name filter? */
+DBCORE_API int dbPvdFilterMayHold(DBBASE *pdbbase,const char *name,size_t lenname);
 
 DBCORE_API
 char** dbCompleteRecord(const char *word);
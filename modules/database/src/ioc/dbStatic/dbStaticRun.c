@@ -28,6 +28,7 @@
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 #include "dbAccess.h"
+#include "dbProcStats.h"
 #include "devSup.h"
 #include "special.h"
 #include "epicsExport.h"
@@ -95,6 +96,8 @@ long dbAllocRecord(DBENTRY *pdbentry,const char *precordName)
     ppvt->recnode = precnode;
     precord->rdes = pdbRecordType;
     precnode->precord = precord;
+    if(dbProcStatsActive)
+        dbProcStatsInitRecord(precord);
     pflddes = pdbRecordType->papFldDes[0];
     if(!pflddes) {
         epicsPrintf("dbAllocRecord pflddes for NAME not found\n");
@@ -180,6 +183,7 @@ long dbFreeRecord(DBENTRY *pdbentry)
     if(!pdbRecordType) return(S_dbLib_recordTypeNotFound);
     if(!precnode) return(S_dbLib_recNotFound);
     if(!precnode->precord) return(S_dbLib_recNotFound);
+    free(dbRec2Pvt(precnode->precord)->procStats);
     free(dbRec2Pvt(precnode->precord));
     precnode->precord = NULL;
     return(0);
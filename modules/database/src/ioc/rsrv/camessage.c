@@ -24,6 +24,7 @@
 #include <stdarg.h>
 #include <limits.h>
 
+#include "epicsEndian.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
@@ -44,6 +45,7 @@
 #include "db_access_routines.h"
 #include "dbChannel.h"
 #include "dbCommon.h"
+#include "db_convert.h"
 #include "dbEvent.h"
 #include "db_field_log.h"
 #include "dbNotify.h"
@@ -368,6 +370,17 @@ static int tcp_version_action ( caHdrLargeArray *mp, void *pPayload,
         return RSRV_ERROR;
     }
 
+    /*
+     * The available field is used (abused) here to carry the
+     * size of the smallest response which the client wants
+     * compressed starting with CA V4.14
+     */
+    if ( CA_V414 ( mp->m_count ) ) {
+        SEND_LOCK ( client );
+        client->compressThreshold = mp->m_available;
+        SEND_UNLOCK ( client );
+    }
+
     if ( mp->m_dataType > CA_PROTO_PRIORITY_MAX ) {
         return RSRV_ERROR;
     }
@@ -479,6 +492,89 @@ static void no_read_access_event ( struct client *pClient,
     }
 }
 
+/*
+ * Smaller payloads are cheaper to copy into the send buffer
+ * than to send with a separate gathering write.  Arrays this large
+ * always come with their own copy from db_post_array_events().
+ */
+#define DIRECT_SEND_MIN_BYTES DB_EVENT_ARRAY_COPY_BYTES
+
+/*
+ * read_reply_direct()
+ *
+ * If a subscription update can be sent straight out of the field log's
+ * own copy of the data, return the element count to send.  That is when
+ * the copy already has the requested value type.  Elements which are not
+ * in network byte order are swapped as they are sent.
+ */
+static long read_reply_direct ( struct dbChannel *dbch, ca_uint16_t dataType,
+    ca_uint32_t count, const db_field_log *pfl )
+{
+    ca_uint16_t valueType = dataType % ( LAST_TYPE + 1 );
+
+    if ( ! pfl || pfl->type != dbfl_type_ref || ! pfl->dtor ||
+            pfl->no_elements <= 0 ||
+            dbChannelSpecial ( dbch ) != SPC_DBADDR ||
+            dataType > DBR_CTRL_DOUBLE || valueType == DBR_STRING ||
+            pfl->field_type < 0 || pfl->field_type > newDBR_ENUM ) {
+        return 0;
+    }
+    if ( count == 0 ) {
+        count = pfl->no_elements;
+    }
+    else if ( count > (unsigned long) pfl->no_elements ) {
+        return 0;
+    }
+    if ( dbr_size_n ( dataType, count ) < DIRECT_SEND_MIN_BYTES ) {
+        return 0;
+    }
+
+    /* the data must already be of the requested type */
+    if ( dbDBRoldToDBFnew[valueType] != pfl->field_type &&
+            ! ( valueType == DBR_CHAR &&
+                dbDBRnewToDBRold[pfl->field_type] == DBR_CHAR ) ) {
+        return 0;
+    }
+    return count;
+}
+
+/*
+ * read_reply_send_direct()
+ *
+ * Send a subscription update accepted by read_reply_direct().  Only
+ * the meta-data which precedes the value is fetched through the
+ * database, the values themselves are sent from the field log.
+ */
+static int read_reply_send_direct ( struct client *pClient,
+    struct event_ext *pevext, struct dbChannel *dbch,
+    db_field_log *pfl, long item_count )
+{
+    const ca_uint16_t dataType = pevext->msg.m_dataType;
+    const unsigned metaSize = dbr_value_offset[dataType];
+    struct dbr_ctrl_double meta; /* the largest supported */
+    long zero = 0;
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_BIG && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_BIG
+    const int convert = FALSE;
+#else
+    const int convert = dbr_value_size[dataType] != 1;
+#endif
+
+    assert ( metaSize < sizeof ( meta ) );
+    if ( metaSize ) {
+        if ( dbChannel_get_count ( dbch, dataType, &meta, &zero, pfl ) < 0 ||
+                caNetConvert ( dataType, &meta, &meta, TRUE, 1 )
+                    != ECA_NORMAL ) {
+            return FALSE;
+        }
+    }
+
+    return cas_send_bs_data ( pClient, pevext->msg.m_cmmd, dataType,
+        item_count, ECA_NORMAL, pevext->msg.m_available,
+        &meta, metaSize, pfl->u.r.field,
+        item_count * dbr_value_size[dataType], convert ) == ECA_NORMAL;
+}
+
 /*
  *  read_reply()
  */
@@ -502,6 +598,26 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
 
     cid = ECA_NORMAL;
 
+    /* Large arrays which need no conversion bypass the send buffer,
+     * unless they are large enough to be compressed there.  A CAS-io
+     * thread can't wait for the gathering write. */
+    if ( readAccess && pClient->proto == IPPROTO_TCP &&
+            ! casIoThreadIsCurrent ( pClient ) ) {
+        item_count = read_reply_direct ( dbch, pevext->msg.m_dataType,
+            pevext->msg.m_count, pfl );
+        if ( item_count > 0 && pClient->compressThreshold &&
+                sizeof ( caHdr ) + 2 * sizeof ( ca_uint32_t ) +
+                dbr_size_n ( pevext->msg.m_dataType, item_count ) >=
+                pClient->compressThreshold ) {
+            item_count = 0;
+        }
+        if ( item_count > 0 && read_reply_send_direct ( pClient, pevext,
+                dbch, pfl, item_count ) ) {
+            SEND_UNLOCK ( pClient );
+            return;
+        }
+    }
+
     /* If the client has requested a zero element count we interpret this as a
      * request for all available elements.  In this case we initialize the
      * header with the maximum element size specified by the database. */
@@ -591,7 +707,9 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
             memset ( pPayload, 0, payload_size );
             cas_set_header_cid ( pClient, cacStatus );
         }
-        cas_commit_msg ( pClient, payload_size );
+        cas_commit_compressed_msg ( pClient, payload_size,
+            dbr_type_is_STRING ( pevext->msg.m_dataType ) ? 1u :
+                dbr_value_size[pevext->msg.m_dataType] );
     }
 
     /*
@@ -2542,6 +2660,10 @@ int camessage ( struct client *client )
             }
         }
         else {
+            if ( casIoThreadIsCurrent ( client ) && casIoHoldRecv ( client ) ) {
+                status = RSRV_OK;
+                break;
+            }
             if ( msg.m_cmmd < NELEMENTS(tcpJumpTable) ) {
                 status = ( *tcpJumpTable[msg.m_cmmd] ) ( &msg, pBody, client );
                 if ( status != RSRV_OK ) {
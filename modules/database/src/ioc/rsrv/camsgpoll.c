@@ -0,0 +1,590 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Multiplexed CA server TCP circuit service.
+ *
+ *  When EPICS_CAS_IO_THREADS is set to a positive number, TCP clients
+ *  are not given their own "CAS-client" receive thread.  Instead each
+ *  new circuit is attached to the least loaded of a fixed pool of
+ *  "CAS-io" threads, which wait for input on all of their circuits
+ *  with epoll(7) and dispatch complete messages through camessage().
+ *
+ *  An I/O thread never waits for one client.  Replies are sent
+ *  without blocking; what the socket doesn't take stays queued and
+ *  the circuit waits for EPOLLOUT instead of EPOLLIN, so no more
+ *  requests are read from a client until it has taken its replies.
+ *  A circuit which runs out of network buffers, or whose send lock
+ *  is held by a thread waiting for the client, is removed from the
+ *  epoll set and looked at again later.  Circuits are torn down by
+ *  the "CAS-io-free" thread.
+ *
+ *  The per client "CAS-event" thread still sends subscription
+ *  updates with blocking writes.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__linux__)
+#  include <unistd.h>
+#  include <poll.h>
+#  include <sys/epoll.h>
+#  define CAS_HAVE_EPOLL
+#endif
+
+#include "dbDefs.h"
+#include "ellLib.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsMutex.h"
+#include "epicsSignal.h"
+#include "epicsStdio.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "osiSock.h"
+#include "taskwd.h"
+#include "cantProceed.h"
+
+#include "rsrv.h"
+#include "server.h"
+
+typedef struct casIoThread {
+    epicsThreadId   tid;
+    int             epfd;
+    int             nClients;   /* atomic */
+    /* client::ioNode of the circuits removed from the epoll set,
+     * only used by this thread */
+    ELLLIST         retryList;
+    epicsTimeStamp  lastNoBufsMsg;
+    unsigned        noBufsSuppressed;
+} casIoThread;
+
+static casIoThread *casIoThreads;
+static unsigned casIoThreadCount;
+
+#ifdef CAS_HAVE_EPOLL
+
+static void casIoThreadDetach ( casIoThread *pio, struct client *client );
+
+#define CAS_IO_MAX_EVENTS 64
+
+/* as long as camsgtask() sleeps when out of network buffers */
+#define CAS_IO_NOBUFS_DELAY 15.0
+/* before looking again at a circuit whose send lock was busy */
+#define CAS_IO_BUSY_DELAY 0.05
+/* between "Out of network buffers" messages from one I/O thread */
+#define CAS_IO_NOBUFS_MSG_INTERVAL 60.0
+
+/* client::node of the circuits waiting to be destroyed */
+static ELLLIST casIoFreeList = ELLLIST_INIT;
+static epicsMutexId casIoFreeLock;
+static epicsEventId casIoFreeEvent;
+
+/*
+ * Change the events which the circuit waits for, zero to remove it
+ * from the epoll set.  A socket in the set always reports hang-ups,
+ * which would wake a level triggered epoll_wait() at once.
+ */
+static int casIoArm ( casIoThread *pio, struct client *client,
+    unsigned events )
+{
+    struct epoll_event ev;
+    int op;
+
+    if ( events == client->ioEvents ) {
+        return RSRV_OK;
+    }
+    if ( ! client->ioEvents ) {
+        op = EPOLL_CTL_ADD;
+    }
+    else if ( ! events ) {
+        op = EPOLL_CTL_DEL;
+    }
+    else {
+        op = EPOLL_CTL_MOD;
+    }
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = events;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( pio->epfd, op, client->sock, &ev ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_ctl " ERL_ERROR ": %s\n",
+            sockErrBuf );
+        return RSRV_ERROR;
+    }
+    client->ioEvents = events;
+    return RSRV_OK;
+}
+
+/*
+ * Stop waiting for events on the circuit for delay seconds
+ */
+static int casIoRetryLater ( casIoThread *pio, struct client *client,
+    double delay )
+{
+    if ( casIoArm ( pio, client, 0u ) != RSRV_OK ) {
+        return RSRV_ERROR;
+    }
+    epicsTimeGetCurrent ( &client->ioRetryTime );
+    epicsTimeAddSeconds ( &client->ioRetryTime, delay );
+    ellAdd ( &pio->retryList, &client->ioNode );
+    return RSRV_OK;
+}
+
+static int casIoNoBufs ( casIoThread *pio, struct client *client )
+{
+    epicsTimeStamp now;
+
+    epicsTimeGetCurrent ( &now );
+    if ( epicsTimeDiffInSeconds ( &now, &pio->lastNoBufsMsg ) >=
+            CAS_IO_NOBUFS_MSG_INTERVAL ) {
+        if ( pio->noBufsSuppressed ) {
+            errlogPrintf ( "CAS: Out of network buffers, retrying in %g"
+                " seconds (%u similar messages suppressed)\n",
+                CAS_IO_NOBUFS_DELAY, pio->noBufsSuppressed );
+        }
+        else {
+            errlogPrintf ( "CAS: Out of network buffers, retrying in %g"
+                " seconds\n", CAS_IO_NOBUFS_DELAY );
+        }
+        pio->lastNoBufsMsg = now;
+        pio->noBufsSuppressed = 0u;
+    }
+    else {
+        pio->noBufsSuppressed++;
+    }
+    return casIoRetryLater ( pio, client, CAS_IO_NOBUFS_DELAY );
+}
+
+/*
+ * Process the requests in the receive buffer, nchars of which
+ * have just been received
+ */
+static int casIoDispatch ( struct client *client, unsigned nchars )
+{
+    int status;
+
+    client->ioRecvHeld = FALSE;
+    client->recv.stk = 0;
+    epicsThreadPrivateSet ( rsrvCurrentClient, client );
+    status = casProcessRecv ( client, nchars );
+    epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+    if ( status != RSRV_OK || client->disconnect ) {
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+/*
+ * Send what the circuit has queued without waiting, and process
+ * the requests held back meanwhile.  Then wait for input if
+ * everything went, or for the socket to become writable if not.
+ */
+static int casIoFlush ( casIoThread *pio, struct client *client )
+{
+    while ( TRUE ) {
+        enum casSendStatus status;
+
+        if ( epicsMutexTryLock ( client->lock ) != epicsMutexLockOK ) {
+            /* another thread is sending */
+            return casIoRetryLater ( pio, client, CAS_IO_BUSY_DELAY );
+        }
+        status = cas_send_bs_nowait ( client );
+        SEND_UNLOCK ( client );
+
+        if ( client->disconnect ) {
+            return RSRV_ERROR;
+        }
+        if ( status == casSendPending ) {
+            return casIoArm ( pio, client, EPOLLOUT );
+        }
+        if ( status == casSendNoBufs ) {
+            return casIoNoBufs ( pio, client );
+        }
+        if ( ! client->ioRecvHeld ) {
+            return casIoArm ( pio, client, EPOLLIN );
+        }
+        if ( casIoDispatch ( client, 0u ) != RSRV_OK ) {
+            return RSRV_ERROR;
+        }
+    }
+}
+
+/*
+ * True when the CAS-event thread waits in send() for a client which
+ * is not reading, so that camessage() could wait for the send lock.
+ */
+static int casIoSendBlocked ( struct client *client )
+{
+    struct pollfd pfd;
+
+    if ( ! epicsAtomicGetIntT ( &client->sendWaiting ) ) {
+        return FALSE;
+    }
+    pfd.fd = client->sock;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+    return poll ( &pfd, 1, 0 ) == 0;
+}
+
+/*
+ * Read whatever is available for one circuit and process it.
+ * Returns RSRV_ERROR when the circuit should be torn down.
+ */
+static int casIoReceive ( casIoThread *pio, struct client *client )
+{
+    osiSockIoctl_t check_nchars;
+    long nchars;
+    int status;
+
+    if ( casIoSendBlocked ( client ) ) {
+        return casIoRetryLater ( pio, client, CAS_IO_BUSY_DELAY );
+    }
+
+    assert ( client->recv.maxstk >= client->recv.cnt );
+    nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
+            (int) ( client->recv.maxstk - client->recv.cnt ), MSG_DONTWAIT );
+    if ( nchars == 0 ) {
+        if ( CASDEBUG > 0 ) {
+            errlogPrintf ( "CAS: nill message disconnect\n" );
+        }
+        return RSRV_ERROR;
+    }
+    else if ( nchars < 0 ) {
+        int anerrno = SOCKERRNO;
+
+        if ( anerrno == SOCK_EINTR || anerrno == SOCK_EWOULDBLOCK ||
+                anerrno == EAGAIN ) {
+            return RSRV_OK;
+        }
+
+        if ( anerrno == SOCK_ENOBUFS ) {
+            return casIoNoBufs ( pio, client );
+        }
+
+        if (    ( anerrno != SOCK_ECONNABORTED &&
+            anerrno != SOCK_ECONNRESET &&
+            anerrno != SOCK_ETIMEDOUT ) ||
+            CASDEBUG > 2 ) {
+            char sockErrBuf[64];
+
+            epicsSocketConvertErrorToString(
+                sockErrBuf, sizeof ( sockErrBuf ), anerrno);
+            errlogPrintf ( "CAS: Client disconnected - %s\n",
+                sockErrBuf );
+        }
+        return RSRV_ERROR;
+    }
+
+    if ( casIoDispatch ( client, ( unsigned ) nchars ) != RSRV_OK ) {
+        return RSRV_ERROR;
+    }
+
+    /*
+     * allow message to batch up if more are coming
+     */
+    status = socket_ioctl (client->sock, FIONREAD, &check_nchars);
+    if ( client->ioRecvHeld || status < 0 || check_nchars == 0 ) {
+        return casIoFlush ( pio, client );
+    }
+    return RSRV_OK;
+}
+
+static int casIoServiceClient ( casIoThread *pio, struct client *client )
+{
+    if ( castcp_ctl != ctlRun || client->disconnect ) {
+        return RSRV_ERROR;
+    }
+    if ( client->ioEvents & EPOLLOUT ) {
+        return casIoFlush ( pio, client );
+    }
+    return casIoReceive ( pio, client );
+}
+
+/*
+ * Look again at the circuits whose retry time has come.  Returns
+ * the epoll_wait() timeout until the next one, in milliseconds.
+ */
+static int casIoRetry ( casIoThread *pio )
+{
+    struct client *client, *next;
+    epicsTimeStamp now;
+    double wait = -1.0;
+
+    if ( ! ellCount ( &pio->retryList ) ) {
+        return -1;
+    }
+    epicsTimeGetCurrent ( &now );
+    for ( client = CONTAINER ( ellFirst ( &pio->retryList ),
+                struct client, ioNode );
+            client; client = next ) {
+        double delay = epicsTimeDiffInSeconds ( &client->ioRetryTime, &now );
+        ELLNODE *pNext = ellNext ( &client->ioNode );
+
+        next = pNext ? CONTAINER ( pNext, struct client, ioNode ) : NULL;
+        if ( delay > 0.0 ) {
+            if ( wait < 0.0 || delay < wait ) {
+                wait = delay;
+            }
+            continue;
+        }
+        ellDelete ( &pio->retryList, &client->ioNode );
+        if ( casIoArm ( pio, client, EPOLLIN ) != RSRV_OK ) {
+            /* still not in the epoll set */
+            ellAdd ( &pio->retryList, &client->ioNode );
+            casIoThreadDetach ( pio, client );
+        }
+        else if ( casIoFlush ( pio, client ) != RSRV_OK ) {
+            casIoThreadDetach ( pio, client );
+        }
+    }
+    return wait < 0.0 ? -1 : (int) ( wait * 1000.0 ) + 1;
+}
+
+static void casIoFreeTask ( void *pParm )
+{
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+
+    while ( TRUE ) {
+        struct client *client;
+
+        epicsMutexMustLock ( casIoFreeLock );
+        client = (struct client *) ellGet ( &casIoFreeList );
+        epicsMutexUnlock ( casIoFreeLock );
+
+        if ( client ) {
+            destroy_tcp_client ( client );
+        }
+        else {
+            epicsEventMustWait ( casIoFreeEvent );
+        }
+    }
+}
+
+static void casIoThreadDetach ( casIoThread *pio, struct client *client )
+{
+    if ( client->ioEvents ) {
+        epoll_ctl ( pio->epfd, EPOLL_CTL_DEL, client->sock, NULL );
+        client->ioEvents = 0u;
+    }
+    else {
+        ellDelete ( &pio->retryList, &client->ioNode );
+    }
+    epicsAtomicDecrIntT ( &pio->nClients );
+
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    UNLOCK_CLIENTQ;
+
+    /* this thread's watchdog entry is not owned by the client */
+    client->tid = 0;
+
+    /* the teardown may wait for the client's other threads */
+    epicsMutexMustLock ( casIoFreeLock );
+    ellAdd ( &casIoFreeList, &client->node );
+    epicsMutexUnlock ( casIoFreeLock );
+    epicsEventMustTrigger ( casIoFreeEvent );
+}
+
+static void casIoThreadTask ( void *pParm )
+{
+    casIoThread *pio = (casIoThread *) pParm;
+    struct epoll_event events[CAS_IO_MAX_EVENTS];
+
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+
+    while ( TRUE ) {
+        int i, n;
+
+        n = epoll_wait ( pio->epfd, events, NELEMENTS(events),
+            casIoRetry ( pio ) );
+        if ( n < 0 ) {
+            char sockErrBuf[64];
+
+            if ( errno == EINTR ) {
+                continue;
+            }
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: epoll_wait " ERL_ERROR ": %s\n",
+                sockErrBuf );
+            epicsThreadSleep ( 1.0 );
+            continue;
+        }
+
+        for ( i = 0; i < n; i++ ) {
+            struct client *client = (struct client *) events[i].data.ptr;
+
+            if ( casIoServiceClient ( pio, client ) != RSRV_OK ) {
+                casIoThreadDetach ( pio, client );
+            }
+        }
+    }
+}
+
+unsigned casIoThreadsInit ( unsigned count )
+{
+    unsigned i;
+
+    casIoFreeLock = epicsMutexMustCreate ();
+    casIoFreeEvent = epicsEventMustCreate ( epicsEventEmpty );
+    if ( ! epicsThreadCreate ( "CAS-io-free", epicsThreadPriorityCAServerLow,
+            epicsThreadGetStackSize ( epicsThreadStackBig ),
+            casIoFreeTask, NULL ) ) {
+        errlogPrintf ( "CAS: task creation for I/O thread failed\n" );
+        errlogPrintf ( "CAS: falling back to one thread per client\n" );
+        return 0u;
+    }
+
+    casIoThreads = callocMustSucceed ( count, sizeof ( *casIoThreads ),
+        "casIoThreadsInit" );
+
+    for ( i = 0; i < count; i++ ) {
+        casIoThread *pio = &casIoThreads[i];
+        char name[16];
+
+        pio->epfd = epoll_create1 ( EPOLL_CLOEXEC );
+        if ( pio->epfd < 0 ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: epoll_create " ERL_ERROR ": %s\n",
+                sockErrBuf );
+            break;
+        }
+
+        epicsSnprintf ( name, sizeof ( name ), "CAS-io%u", i );
+        pio->tid = epicsThreadCreate ( name, epicsThreadPriorityCAServerLow,
+                epicsThreadGetStackSize ( epicsThreadStackBig ),
+                casIoThreadTask, pio );
+        if ( ! pio->tid ) {
+            errlogPrintf ( "CAS: task creation for I/O thread failed\n" );
+            close ( pio->epfd );
+            break;
+        }
+    }
+
+    casIoThreadCount = i;
+    if ( casIoThreadCount == 0 ) {
+        free ( casIoThreads );
+        casIoThreads = NULL;
+        errlogPrintf ( "CAS: falling back to one thread per client\n" );
+    }
+    return casIoThreadCount;
+}
+
+int casIoThreadAttach ( struct client *client )
+{
+    casIoThread *pio;
+    struct epoll_event ev;
+    unsigned i;
+
+    assert ( casIoThreadCount );
+
+    pio = &casIoThreads[0];
+    for ( i = 1; i < casIoThreadCount; i++ ) {
+        if ( epicsAtomicGetIntT ( &casIoThreads[i].nClients ) <
+                epicsAtomicGetIntT ( &pio->nClients ) ) {
+            pio = &casIoThreads[i];
+        }
+    }
+
+    client->tid = pio->tid;
+    client->ioThread = pio;
+    client->ioEvents = EPOLLIN;
+    epicsAtomicIncrIntT ( &pio->nClients );
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( pio->epfd, EPOLL_CTL_ADD, client->sock, &ev ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_ctl " ERL_ERROR ": %s\n",
+            sockErrBuf );
+        epicsAtomicDecrIntT ( &pio->nClients );
+        client->tid = 0;
+        client->ioThread = NULL;
+        client->ioEvents = 0u;
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+#else /* CAS_HAVE_EPOLL */
+
+unsigned casIoThreadsInit ( unsigned count )
+{
+    errlogPrintf ( "CAS: EPICS_CAS_IO_THREADS is not supported on this target,"
+        " using one thread per client\n" );
+    return 0u;
+}
+
+int casIoThreadAttach ( struct client *client )
+{
+    return RSRV_ERROR;
+}
+
+#endif /* CAS_HAVE_EPOLL */
+
+/*
+ * Called by the I/O thread before each request, true if the rest
+ * of the requests received are to wait until the client has taken
+ * the replies queued so far.
+ */
+int casIoHoldRecv ( struct client *client )
+{
+    if ( client->send.stk < MAX_TCP ) {
+        return FALSE;
+    }
+    SEND_LOCK ( client );
+    cas_send_bs_nowait ( client );
+    client->ioRecvHeld = client->send.stk != 0u;
+    SEND_UNLOCK ( client );
+    return client->ioRecvHeld;
+}
+
+/*
+ * True if called by the I/O thread which serves the client's circuit
+ */
+int casIoThreadIsCurrent ( const struct client *client )
+{
+    return client->ioThread && client->tid == epicsThreadGetIdSelf ();
+}
+
+unsigned casIoThreadsActive ( void )
+{
+    return casIoThreadCount;
+}
+
+void casIoThreadsShow ( unsigned level )
+{
+    unsigned i;
+
+    if ( ! casIoThreadCount ) {
+        return;
+    }
+
+    printf ( "TCP circuits multiplexed over %u I/O thread%s\n",
+        casIoThreadCount, casIoThreadCount == 1 ? "" : "s" );
+    if ( level < 2u ) {
+        return;
+    }
+    for ( i = 0; i < casIoThreadCount; i++ ) {
+        printf ( "    CAS-io%u (%p) serving %d client(s)\n", i,
+            (void *) casIoThreads[i].tid,
+            epicsAtomicGetIntT ( &casIoThreads[i].nClients ) );
+    }
+}
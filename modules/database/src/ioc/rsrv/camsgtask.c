@@ -33,6 +33,64 @@
 #include "rsrv.h"
 #include "server.h"
 
+/*
+ *  casProcessRecv()
+ *
+ *  Dispatch nchars of new data just received into the tail of
+ *  client->recv.  Any trailing partial message is moved to the
+ *  start of the buffer.  Shared by the per client thread and by
+ *  the multiplexing I/O threads.
+ *
+ *  Returns RSRV_ERROR if the client must be disconnected.
+ */
+int casProcessRecv ( struct client *client, unsigned nchars )
+{
+    int status;
+
+    epicsTimeGetCurrent ( &client->time_at_last_recv );
+    client->recv.cnt += nchars;
+
+    status = camessage ( client );
+    if (status == 0) {
+        /*
+         * if there is a partial message
+         * align it with the start of the buffer
+         */
+        if (client->recv.cnt > client->recv.stk) {
+            unsigned bytes_left;
+
+            bytes_left = client->recv.cnt - client->recv.stk;
+
+            /*
+             * overlapping regions handled
+             * properly by memmove
+             */
+            memmove (client->recv.buf,
+                &client->recv.buf[client->recv.stk], bytes_left);
+            client->recv.cnt = bytes_left;
+        }
+        else {
+            client->recv.cnt = 0ul;
+        }
+        return RSRV_OK;
+    }
+    else {
+        char buf[64];
+
+        /* flush any queued messages before shutdown */
+        cas_send_bs_msg(client, 1);
+
+        client->recv.cnt = 0ul;
+
+        /*
+         * disconnect when there are severe message errors
+         */
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
+        return RSRV_ERROR;
+    }
+}
+
 /*
  *  camsgtask()
  *
@@ -110,46 +168,8 @@ void camsgtask ( void *pParm )
             break;
         }
 
-        epicsTimeGetCurrent ( &client->time_at_last_recv );
-        client->recv.cnt += ( unsigned ) nchars;
-
-        status = camessage ( client );
-        if (status == 0) {
-            /*
-             * if there is a partial message
-             * align it with the start of the buffer
-             */
-            if (client->recv.cnt > client->recv.stk) {
-                unsigned bytes_left;
-
-                bytes_left = client->recv.cnt - client->recv.stk;
-
-                /*
-                 * overlapping regions handled
-                 * properly by memmove
-                 */
-                memmove (client->recv.buf,
-                    &client->recv.buf[client->recv.stk], bytes_left);
-                client->recv.cnt = bytes_left;
-            }
-            else {
-                client->recv.cnt = 0ul;
-            }
-        }
-        else {
-            char buf[64];
-
-            /* flush any queued messages before shutdown */
-            cas_send_bs_msg(client, 1);
-
-            client->recv.cnt = 0ul;
-
-            /*
-             * disconnect when there are severe message errors
-             */
-            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-            epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
-                break;
+        if ( casProcessRecv ( client, ( unsigned ) nchars ) != RSRV_OK ) {
+            break;
         }
     }
 
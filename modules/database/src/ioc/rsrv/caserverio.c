@@ -21,7 +21,13 @@
 #include <errno.h>
 #include <limits.h>
 
+#if !defined(_WIN32) && !defined(vxWorks)
+#  include <sys/uio.h>
+#  define CAS_HAVE_SENDMSG
+#endif
+
 #include "dbDefs.h"
+#include "epicsAtomic.h"
 #include "epicsSignal.h"
 #include "epicsTime.h"
 #include "errlog.h"
@@ -29,25 +35,110 @@
 
 #include "caerr.h"
 #include "net_convert.h"
+#include "caCompress.h"
+#include "db_access.h"
 
 #include "server.h"
 
 /*
- *  cas_send_bs_msg()
+ *  casSendFailed()
  *
- *  (channel access server send message)
+ *  Handle a failed TCP send.  Returns TRUE if the send should be
+ *  retried, otherwise the client is marked for disconnect.
+ */
+static int casSendFailed ( struct client *pclient )
+{
+    int causeWasSocketHangup = 0;
+    int anerrno = SOCKERRNO;
+    char buf[64];
+
+    if ( pclient->disconnect ) {
+        pclient->send.stk = 0u;
+        return FALSE;
+    }
+
+    if ( anerrno == SOCK_EINTR ) {
+        return TRUE;
+    }
+
+    if ( anerrno == SOCK_ENOBUFS ) {
+        errlogPrintf (
+            "CAS: Out of network buffers, retrying send in 15 seconds\n" );
+        epicsThreadSleep ( 15.0 );
+        return TRUE;
+    }
+
+    ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+
+    if (
+        anerrno == SOCK_ECONNABORTED ||
+        anerrno == SOCK_ECONNRESET ||
+        anerrno == SOCK_EPIPE ||
+        anerrno == SOCK_ETIMEDOUT ) {
+        causeWasSocketHangup = 1;
+    }
+    else {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: TCP send to %s failed: %s\n",
+            buf, sockErrBuf);
+    }
+    pclient->disconnect = TRUE;
+    pclient->send.stk = 0u;
+
+    /*
+     * wakeup the receive thread
+     */
+    if ( ! causeWasSocketHangup ) {
+        enum epicsSocketSystemCallInterruptMechanismQueryInfo info  =
+            epicsSocketSystemCallInterruptMechanismQuery ();
+        switch ( info ) {
+        case esscimqi_socketCloseRequired:
+            if ( pclient->sock != INVALID_SOCKET ) {
+                epicsSocketDestroy ( pclient->sock );
+                pclient->sock = INVALID_SOCKET;
+            }
+            break;
+        case esscimqi_socketBothShutdownRequired:
+            {
+                int status = shutdown ( pclient->sock, SHUT_RDWR );
+                if ( status ) {
+                    char sockErrBuf[64];
+                    epicsSocketConvertErrnoToString (
+                        sockErrBuf, sizeof ( sockErrBuf ) );
+                    errlogPrintf ("CAS: Socket shutdown " ERL_ERROR ": %s\n",
+                        sockErrBuf );
+                }
+            }
+            break;
+        case esscimqi_socketSigAlarmRequired:
+            epicsSignalRaiseSigAlarm ( pclient->tid );
+            break;
+        default:
+            break;
+        };
+    }
+    return FALSE;
+}
+
+#ifndef MSG_DONTWAIT
+#  define MSG_DONTWAIT 0 /* only CAS-io threads, which need epoll, use it */
+#endif
+
+/*
+ *  casSendBs()
  *
+ *  Send what is queued in the send buffer.  Unless wait is set,
+ *  give up as soon as the socket would block and leave the rest
+ *  queued.
  *
- * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ *  send lock must be on while in this routine
  */
-void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+static enum casSendStatus casSendBs ( struct client *pclient, int wait )
 {
     int status;
 
-    if ( lock_needed ) {
-        SEND_LOCK ( pclient );
-    }
-
     if ( CASDEBUG > 2 && pclient->send.stk ) {
         errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
     }
@@ -58,13 +149,24 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
         }
         pclient->send.stk = 0u;
-        if(lock_needed)
-            SEND_UNLOCK(pclient);
-        return;
+        return casSendDone;
     }
 
     while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+        if ( wait ) {
+            if ( pclient->ioThread ) {
+                epicsAtomicSetIntT ( &pclient->sendWaiting, 1 );
+            }
+            status = send ( pclient->sock, pclient->send.buf,
+                pclient->send.stk, 0 );
+            if ( pclient->ioThread ) {
+                epicsAtomicSetIntT ( &pclient->sendWaiting, 0 );
+            }
+        }
+        else {
+            status = send ( pclient->sock, pclient->send.buf,
+                pclient->send.stk, MSG_DONTWAIT );
+        }
         if ( status >= 0 ) {
             unsigned transferSize = (unsigned) status;
             if ( transferSize >= pclient->send.stk ) {
@@ -79,89 +181,59 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 pclient->send.stk = bytesLeft;
             }
         }
-        else {
-            int causeWasSocketHangup = 0;
-            int anerrno = SOCKERRNO;
-            char buf[64];
-
-            if ( pclient->disconnect ) {
-                pclient->send.stk = 0u;
-                break;
-            }
-
-            if ( anerrno == SOCK_EINTR ) {
-                continue;
-            }
-
-            if ( anerrno == SOCK_ENOBUFS ) {
-                errlogPrintf (
-                    "CAS: Out of network buffers, retrying send in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
-                continue;
-            }
+        else if ( ! wait && ( SOCKERRNO == SOCK_EWOULDBLOCK ||
+                SOCKERRNO == EAGAIN ) ) {
+            return casSendPending;
+        }
+        else if ( ! wait && SOCKERRNO == SOCK_ENOBUFS ) {
+            return casSendNoBufs;
+        }
+        else if ( ! casSendFailed ( pclient ) ) {
+            break;
+        }
+    }
 
-            ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+    DLOG ( 3, ( "------------------------------\n\n" ) );
 
-            if (
-                anerrno == SOCK_ECONNABORTED ||
-                anerrno == SOCK_ECONNRESET ||
-                anerrno == SOCK_EPIPE ||
-                anerrno == SOCK_ETIMEDOUT ) {
-                causeWasSocketHangup = 1;
-            }
-            else {
-                char sockErrBuf[64];
-                epicsSocketConvertErrnoToString (
-                    sockErrBuf, sizeof ( sockErrBuf ) );
-                errlogPrintf ( "CAS: TCP send to %s failed: %s\n",
-                    buf, sockErrBuf);
-            }
-            pclient->disconnect = TRUE;
-            pclient->send.stk = 0u;
+    return casSendDone;
+}
 
-            /*
-             * wakeup the receive thread
-             */
-            if ( ! causeWasSocketHangup ) {
-                enum epicsSocketSystemCallInterruptMechanismQueryInfo info  =
-                    epicsSocketSystemCallInterruptMechanismQuery ();
-                switch ( info ) {
-                case esscimqi_socketCloseRequired:
-                    if ( pclient->sock != INVALID_SOCKET ) {
-                        epicsSocketDestroy ( pclient->sock );
-                        pclient->sock = INVALID_SOCKET;
-                    }
-                    break;
-                case esscimqi_socketBothShutdownRequired:
-                    {
-                        int status = shutdown ( pclient->sock, SHUT_RDWR );
-                        if ( status ) {
-                            char sockErrBuf[64];
-                            epicsSocketConvertErrnoToString (
-                                sockErrBuf, sizeof ( sockErrBuf ) );
-                            errlogPrintf ("CAS: Socket shutdown " ERL_ERROR ": %s\n",
-                                sockErrBuf );
-                        }
-                    }
-                    break;
-                case esscimqi_socketSigAlarmRequired:
-                    epicsSignalRaiseSigAlarm ( pclient->tid );
-                    break;
-                default:
-                    break;
-                };
-                break;
-            }
-        }
+/*
+ *  cas_send_bs_msg()
+ *
+ *  (channel access server send message)
+ *
+ *  Called from the CAS-io thread serving the circuit, this does
+ *  not wait for the client and may leave part of the message
+ *  queued.  The CAS-io thread sends the rest once the socket is
+ *  writable.
+ *
+ * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ */
+void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+{
+    if ( lock_needed ) {
+        SEND_LOCK ( pclient );
     }
 
+    casSendBs ( pclient, ! casIoThreadIsCurrent ( pclient ) );
+
     if ( lock_needed ) {
         SEND_UNLOCK(pclient);
     }
+}
 
-    DLOG ( 3, ( "------------------------------\n\n" ) );
-
-    return;
+/*
+ *  cas_send_bs_nowait()
+ *
+ *  Send as much of the send buffer as the socket accepts without
+ *  blocking.
+ *
+ *  send lock must be on while in this routine
+ */
+enum casSendStatus cas_send_bs_nowait ( struct client *pclient )
+{
+    return casSendBs ( pclient, FALSE );
 }
 
 /*
@@ -200,8 +272,25 @@ void cas_send_dg_msg ( struct client * pclient )
         sizeDG -= sizeof (caHdr);
     }
 
-    status = sendto ( pclient->sock, pDG, sizeDG, 0,
-       (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+    if ( pclient->udpSendBatch ) {
+        casUdpSendBatch *pBatch = pclient->udpSendBatch;
+        epicsSocketDatagram *pdg;
+
+        if ( pBatch->count == NELEMENTS ( pBatch->dgs ) ) {
+            cas_flush_dg_batch ( pclient );
+        }
+        pdg = &pBatch->dgs[pBatch->count];
+        pdg->buf = pBatch->bufs[pBatch->count];
+        pdg->len = sizeDG;
+        pdg->addr.ia = pclient->addr;
+        memcpy ( pdg->buf, pDG, sizeDG );
+        pBatch->count++;
+        status = sizeDG;
+    }
+    else {
+        status = sendto ( pclient->sock, pDG, sizeDG, 0,
+           (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+    }
     if ( status >= 0 ) {
         if ( status >= sizeDG ) {
             epicsTimeGetCurrent ( &pclient->time_at_last_send );
@@ -235,6 +324,74 @@ void cas_send_dg_msg ( struct client * pclient )
     return;
 }
 
+/*
+ *  cas_flush_dg_batch()
+ *
+ *  (send the udp messages queued by cas_send_dg_msg())
+ */
+void cas_flush_dg_batch ( struct client * pclient )
+{
+    casUdpSendBatch *pBatch = pclient->udpSendBatch;
+    unsigned i = 0u;
+
+    SEND_LOCK ( pclient );
+
+    while ( pBatch && i < pBatch->count ) {
+        int status = epicsSocketSendMany ( pclient->sock, &pBatch->dgs[i],
+            pBatch->count - i );
+
+        if ( status > 0 ) {
+            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+            i += status;
+        }
+        else {
+            /* skip the reply which can't be sent */
+            char sockErrBuf[64];
+            char buf[128];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pBatch->dgs[i].addr.ia, buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
+            i++;
+        }
+    }
+    if ( pBatch ) {
+        pBatch->count = 0u;
+    }
+
+    SEND_UNLOCK ( pclient );
+}
+
+/*
+ *  casFillHeader()
+ *
+ *  Write a (possibly large array) message header at pMsg.
+ *  Return pointer to message body.
+ */
+static void * casFillHeader ( caHdr *pMsg, ca_uint16_t response,
+    ca_uint32_t alignedPayloadSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific )
+{
+    pMsg->m_cmmd = htons(response);
+    pMsg->m_dataType = htons(dataType);
+    pMsg->m_cid = htonl(cid);
+    pMsg->m_available = htonl(responseSpecific);
+    if (alignedPayloadSize < 0xffff && nElem < 0xffff) {
+        pMsg->m_postsize = htons(((ca_uint16_t) alignedPayloadSize));
+        pMsg->m_count = htons(((ca_uint16_t) nElem));
+        return (void *) (pMsg + 1);
+    }
+    else {
+        ca_uint32_t *pW32 = (ca_uint32_t *) (pMsg + 1);
+        pMsg->m_postsize = htons(0xffff);
+        pMsg->m_count = htons(0u);
+        pW32[0] = htonl(alignedPayloadSize);
+        pW32[1] = htonl(nElem);
+        return (void *) (pW32 + 2);
+    }
+}
+
 /*
  *
  *  cas_copy_in_header()
@@ -255,6 +412,7 @@ int cas_copy_in_header (
     unsigned    msgSize;
     ca_uint32_t alignedPayloadSize;
     caHdr *pMsg;
+    void *pPayload;
 
     if ( payloadSize > UINT_MAX - sizeof ( caHdr ) - 8u ) {
         return ECA_TOLARGE;
@@ -284,6 +442,18 @@ int cas_copy_in_header (
         else{
             if ( pclient->proto == IPPROTO_TCP) {
                 cas_send_bs_msg ( pclient, FALSE );
+                if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+                    /* a CAS-io thread queues rather than wait for the
+                     * client, up to EPICS_CA_MAX_ARRAY_BYTES */
+                    if ( pclient->send.stk < rsrvSizeofLargeBufTCP &&
+                            msgSize <= rsrvSizeofLargeBufTCP - pclient->send.stk ) {
+                        casExpandSendBuffer ( pclient,
+                            pclient->send.stk + msgSize );
+                    }
+                    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+                        casSendBs ( pclient, TRUE );
+                    }
+                }
             }
             else if ( pclient->proto == IPPROTO_UDP ) {
                 cas_send_dg_msg ( pclient );
@@ -295,29 +465,14 @@ int cas_copy_in_header (
     }
 
     pMsg = (caHdr *) &pclient->send.buf[pclient->send.stk];
-    pMsg->m_cmmd = htons(response);
-    pMsg->m_dataType = htons(dataType);
-    pMsg->m_cid = htonl(cid);
-    pMsg->m_available = htonl(responseSpecific);
-    if (alignedPayloadSize < 0xffff && nElem < 0xffff) {
-        pMsg->m_postsize = htons(((ca_uint16_t) alignedPayloadSize));
-        pMsg->m_count = htons(((ca_uint16_t) nElem));
-        if (ppPayload)
-            *ppPayload = (void *) (pMsg + 1);
-    }
-    else {
-        ca_uint32_t *pW32 = (ca_uint32_t *) (pMsg + 1);
-        pMsg->m_postsize = htons(0xffff);
-        pMsg->m_count = htons(0u);
-        pW32[0] = htonl(alignedPayloadSize);
-        pW32[1] = htonl(nElem);
-        if (ppPayload)
-            *ppPayload = (void *) (pW32 + 2);
-    }
+    pPayload = casFillHeader ( pMsg, response, alignedPayloadSize,
+        dataType, nElem, cid, responseSpecific );
+    if (ppPayload)
+        *ppPayload = pPayload;
 
     /* zero out pad bytes */
     if ( alignedPayloadSize > payloadSize ) {
-        char *p = ( char * ) *ppPayload;
+        char *p = ( char * ) pPayload;
         memset ( p + payloadSize, '\0',
             alignedPayloadSize - payloadSize );
     }
@@ -325,6 +480,178 @@ int cas_copy_in_header (
     return ECA_NORMAL;
 }
 
+/*
+ *  casSendParts()
+ *
+ *  Write the parts out with as few gathering writes as possible.
+ *  Returns TRUE once they are all sent.
+ */
+struct casSendPart {
+    const char *base;
+    size_t len;
+};
+
+static int casSendParts ( struct client *pclient,
+    struct casSendPart *part, unsigned nPart )
+{
+    unsigned i = 0;
+
+    while ( i < nPart && ! pclient->disconnect ) {
+        int status;
+#ifdef CAS_HAVE_SENDMSG
+        struct iovec iov[3];
+        struct msghdr msg;
+        unsigned j;
+
+        assert ( nPart <= NELEMENTS(iov) );
+        for ( j = i; j < nPart; j++ ) {
+            iov[j - i].iov_base = ( void * ) part[j].base;
+            iov[j - i].iov_len = part[j].len;
+        }
+        memset ( &msg, 0, sizeof ( msg ) );
+        msg.msg_iov = iov;
+        msg.msg_iovlen = nPart - i;
+        status = sendmsg ( pclient->sock, &msg, 0 );
+#else
+        status = send ( pclient->sock, part[i].base, (int) part[i].len, 0 );
+#endif
+        if ( status >= 0 ) {
+            size_t transferSize = (size_t) status;
+            while ( i < nPart && transferSize >= part[i].len ) {
+                transferSize -= part[i++].len;
+            }
+            if ( i < nPart ) {
+                part[i].base += transferSize;
+                part[i].len -= transferSize;
+            }
+        }
+        else if ( ! casSendFailed ( pclient ) ) {
+            break;
+        }
+    }
+    return i == nPart;
+}
+
+/*
+ *  cas_send_bs_data()
+ *
+ *  Send a TCP response whose payload, after metaSize bytes from pMeta,
+ *  is taken from pData instead of being copied into the send buffer,
+ *  so that large arrays never need a large send buffer.
+ *
+ *  If the data is already in network byte order (convert is FALSE),
+ *  anything already queued, the header and meta-data, the data and its
+ *  pad bytes go out in one gathering write.  Otherwise the elements are
+ *  converted piecewise into the client's send buffer, which is written
+ *  out each time it fills up.
+ *
+ *  send lock must be on while in this routine
+ *
+ *  Returns ECA_NORMAL, or an error without sending anything if the
+ *  message would not fit in EPICS_CA_MAX_ARRAY_BYTES.
+ */
+int cas_send_bs_data (
+    struct client *pclient, ca_uint16_t response, ca_uint16_t dataType,
+    ca_uint32_t nElem, ca_uint32_t cid, ca_uint32_t responseSpecific,
+    const void *pMeta, ca_uint32_t metaSize,
+    const void *pData, ca_uint32_t dataSize, int convert )
+{
+    static const char pad[8];
+    ca_uint32_t payloadSize = metaSize + dataSize;
+    ca_uint32_t alignedPayloadSize;
+    unsigned hdrSize = sizeof ( caHdr );
+    void *pPayload;
+    struct casSendPart part[3];
+    unsigned nPart = 0;
+    int sent;
+
+    assert ( pclient->proto == IPPROTO_TCP );
+
+    if ( dataSize > UINT_MAX - sizeof ( caHdr ) - 8u - metaSize ) {
+        return ECA_TOLARGE;
+    }
+    alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
+    if ( alignedPayloadSize >= 0xffff || nElem >= 0xffff ) {
+        if ( ! CA_V49 ( pclient->minor_version_number ) ) {
+            return ECA_16KARRAYCLIENT;
+        }
+        hdrSize += 2 * sizeof ( ca_uint32_t );
+    }
+    if ( alignedPayloadSize > rsrvSizeofLargeBufTCP - hdrSize ) {
+        return ECA_TOLARGE;
+    }
+
+    if ( pclient->send.stk > pclient->send.maxstk - hdrSize - metaSize ) {
+        cas_send_bs_msg ( pclient, FALSE );
+    }
+    if ( pclient->disconnect ) {
+        pclient->send.stk = 0u;
+        return ECA_NORMAL;
+    }
+
+    pPayload = casFillHeader (
+        ( caHdr * ) &pclient->send.buf[pclient->send.stk],
+        response, alignedPayloadSize, dataType, nElem, cid,
+        responseSpecific );
+    memcpy ( pPayload, pMeta, metaSize );
+    pclient->send.stk += hdrSize + metaSize;
+
+    if ( ! convert ) {
+        part[nPart].base = pclient->send.buf;
+        part[nPart++].len = pclient->send.stk;
+        part[nPart].base = ( const char * ) pData;
+        part[nPart++].len = dataSize;
+        if ( alignedPayloadSize > payloadSize ) {
+            part[nPart].base = pad;
+            part[nPart++].len = alignedPayloadSize - payloadSize;
+        }
+        sent = casSendParts ( pclient, part, nPart );
+    }
+    else {
+        const unsigned valueType = dataType % ( LAST_TYPE + 1 );
+        const unsigned elemSize = dbr_value_size[dataType];
+        const char *pSrc = ( const char * ) pData;
+        ca_uint32_t left = dataSize;
+
+        assert ( dataSize % elemSize == 0 );
+        do {
+            /* whole elements, leaving room for the pad bytes */
+            ca_uint32_t room = pclient->send.maxstk - pclient->send.stk;
+            ca_uint32_t n;
+
+            room = room > 8u ? room - 8u : 0u;
+            n = left < room ? left : room - room % elemSize;
+            if ( n && caNetConvert ( valueType, pSrc,
+                    &pclient->send.buf[pclient->send.stk], TRUE,
+                    n / elemSize ) != ECA_NORMAL ) {
+                /* the header has been committed, so the circuit is lost */
+                pclient->disconnect = TRUE;
+                break;
+            }
+            pclient->send.stk += n;
+            pSrc += n;
+            left -= n;
+            if ( ! left && alignedPayloadSize > payloadSize ) {
+                memset ( &pclient->send.buf[pclient->send.stk], '\0',
+                    alignedPayloadSize - payloadSize );
+                pclient->send.stk += alignedPayloadSize - payloadSize;
+            }
+            part[0].base = pclient->send.buf;
+            part[0].len = pclient->send.stk;
+            pclient->send.stk = 0u;
+        } while ( casSendParts ( pclient, part, 1 ) && left );
+        sent = ! left && ! pclient->disconnect;
+    }
+    if ( sent ) {
+        epicsTimeGetCurrent ( &pclient->time_at_last_send );
+    }
+    pclient->send.stk = 0u;
+
+    DLOG ( 3, ( "------------------------------\n\n" ) );
+
+    return ECA_NORMAL;
+}
+
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t cid )
 {
     caHdr *pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
@@ -365,6 +692,66 @@ void cas_commit_msg ( struct client *pClient, ca_uint32_t size )
     pClient->send.stk += size;
 }
 
+/*
+ *  cas_commit_compressed_msg()
+ *
+ *  Commit the message like cas_commit_msg(), then replace it with a
+ *  CA_PROTO_COMPRESSED message carrying a compressed copy of it when
+ *  the client asked for messages of its size to be compressed, and
+ *  when that makes it smaller.  The array elements in the message
+ *  have elemSize bytes.
+ *
+ *  send lock must be on while in this routine
+ */
+void cas_commit_compressed_msg ( struct client *pClient, ca_uint32_t size,
+    unsigned elemSize )
+{
+    static const unsigned maxHdrSize =
+        sizeof ( caHdr ) + 2 * sizeof ( ca_uint32_t );
+    const unsigned stk = pClient->send.stk;
+    unsigned msgSize, maxSize, workSize, compressedSize;
+    char *pMsg, *pCompressed;
+    void *pPayload;
+
+    cas_commit_msg ( pClient, size );
+
+    msgSize = pClient->send.stk - stk;
+    if ( ! pClient->compressThreshold ||
+            msgSize < pClient->compressThreshold ||
+            msgSize <= 2 * maxHdrSize ) {
+        return;
+    }
+
+    /* the compressed message, with its header and padding, must be smaller */
+    maxSize = msgSize - maxHdrSize - 8u;
+    workSize = caCompressWorkSize ( msgSize );
+    if ( pClient->compressBufSize < workSize + maxSize ) {
+        char *pBuf = realloc ( pClient->pCompressBuf, workSize + maxSize );
+        if ( ! pBuf ) {
+            return;
+        }
+        pClient->pCompressBuf = pBuf;
+        pClient->compressBufSize = workSize + maxSize;
+    }
+    pMsg = &pClient->send.buf[stk];
+    pCompressed = pClient->pCompressBuf + workSize;
+    compressedSize = caCompress ( pMsg, msgSize, pCompressed, maxSize,
+        elemSize, pClient->pCompressBuf );
+    if ( ! compressedSize ) {
+        return;
+    }
+
+    /* the m_cid field carries the exact compressed size */
+    pPayload = casFillHeader ( ( caHdr * ) pMsg, CA_PROTO_COMPRESSED,
+        CA_MESSAGE_ALIGN ( compressedSize ), ( ca_uint16_t ) elemSize,
+        msgSize, compressedSize, CA_COMPRESS_SHUFFLE_LZ4 );
+    memcpy ( pPayload, pCompressed, compressedSize );
+    memset ( ( char * ) pPayload + compressedSize, '\0',
+        CA_MESSAGE_ALIGN ( compressedSize ) - compressedSize );
+    pClient->send.stk = ( unsigned ) ( ( char * ) pPayload - pClient->send.buf )
+        + CA_MESSAGE_ALIGN ( compressedSize );
+}
+
 /*
  * this assumes that we have already checked to see
  * if sufficent bytes are available
@@ -56,7 +56,8 @@ epicsThreadPrivateId rsrvCurrentClient;
  *  CA server task
  *
  *  Waits for connections at the CA port and spawns a task to
- *  handle each of them
+ *  handle each of them, or hands them to the I/O thread pool
+ *  when EPICS_CAS_IO_THREADS is set
  *
  */
 static void req_server (void *pParm)
@@ -106,6 +107,17 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( casIoThreadsActive () ) {
+                if ( casIoThreadAttach ( pClient ) != RSRV_OK ) {
+                    LOCK_CLIENTQ;
+                    ellDelete ( &clientQ, &pClient->node );
+                    UNLOCK_CLIENTQ;
+                    destroy_tcp_client ( pClient );
+                    epicsThreadSleep ( 15.0 );
+                }
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -534,6 +546,19 @@ void rsrv_init (void)
         freeListInitPvt ( &rsrvLargeBufFreeListTCP, rsrvSizeofLargeBufTCP, 1 );
     else
         rsrvLargeBufFreeListTCP = NULL;
+
+    if ( envGetConfigParamPtr ( &EPICS_CAS_IO_THREADS ) ) {
+        long nIoThreads;
+
+        status = envGetLongConfigParam ( &EPICS_CAS_IO_THREADS, &nIoThreads );
+        if ( status || nIoThreads < 0 ) {
+            errlogPrintf ( "CAS: EPICS_CAS_IO_THREADS was not a non-negative integer\n" );
+        }
+        else if ( nIoThreads > 0 ) {
+            casIoThreadsInit ( ( unsigned ) nIoThreads );
+        }
+    }
+
     pCaBucket = bucketCreate(CAS_HASH_TABLE_SIZE);
     if (!pCaBucket)
         cantProceed("RSRV failed to allocate ID lookup table\n");
@@ -552,7 +577,7 @@ void rsrv_init (void)
      * Now starting global
      *  Beacon sender: epicsThreadPriorityCAServerLow-3
      * Started later per TCP client
-     *  TCP receiver: epicsThreadPriorityCAServerLow
+     *  TCP receiver: epicsThreadPriorityCAServerLow (or CAS-io pool)
      *  TCP sender : epicsThreadPriorityCAServerLow-1
      */
     {
@@ -932,6 +957,10 @@ void casr (unsigned level)
     }
     UNLOCK_CLIENTQ
 
+    if (level>=1) {
+        casIoThreadsShow (level);
+    }
+
     if (level>=1) {
         rsrv_iface_config *iface = (rsrv_iface_config *) ellFirst ( &servers );
         while (iface) {
@@ -1104,6 +1133,10 @@ void destroy_client ( struct client *client )
         }
     }
 
+    if ( client->pCompressBuf ) {
+        free ( client->pCompressBuf );
+    }
+
     if ( client->eventqLock ) {
         epicsMutexDestroy ( client->eventqLock );
     }
@@ -37,6 +37,7 @@
 #include <string.h>
 #include <errno.h>
 
+#include "cantProceed.h"
 #include "dbDefs.h"
 #include "envDefs.h"
 #include "epicsMutex.h"
@@ -124,6 +125,10 @@ void cast_server(void *pParm)
     osiSockIoctl_t      nchars;
     SOCKET              recv_sock, reply_sock;
     struct client      *client;
+    epicsSocketDatagram dgs[CAS_UDP_BATCH];
+    char               *recv_buf;
+    char               *batch_bufs;
+    int                 ndgs, idg, nbatch;
 
     recv_addr_size = sizeof(new_recv_addr);
 
@@ -151,6 +156,32 @@ void cast_server(void *pParm)
     }
     client->udpRecv = recv_sock;
 
+    /*
+     * The first datagram of each batch goes in the client's receive
+     * buffer.  Every other one gets a buffer of the same size, so any
+     * datagram which fits in one fits in all.  Those are only allocated
+     * where datagrams are received in batches.
+     */
+    nbatch = ( int ) epicsSocketRecvManyMax ();
+    if ( nbatch > CAS_UDP_BATCH ) {
+        nbatch = CAS_UDP_BATCH;
+    }
+    recv_buf = client->recv.buf;
+    batch_bufs = NULL;
+    if ( nbatch > 1 ) {
+        batch_bufs = mallocMustSucceed (
+            ( nbatch - 1 ) * ( size_t ) client->recv.maxstk, "cast_server" );
+    }
+    memset ( dgs, 0, sizeof ( dgs ) );
+    dgs[0].buf = recv_buf;
+    dgs[0].bufSize = client->recv.maxstk;
+    for ( idg = 1; idg < nbatch; idg++ ) {
+        dgs[idg].buf = &batch_bufs[( idg - 1 ) * ( size_t ) client->recv.maxstk];
+        dgs[idg].bufSize = client->recv.maxstk;
+    }
+    client->udpSendBatch = callocMustSucceed ( 1, sizeof ( casUdpSendBatch ),
+        "cast_server" );
+
     casAttachThreadToClient ( client );
 
     /*
@@ -164,14 +195,8 @@ void cast_server(void *pParm)
     epicsEventSignal(casudp_startStopEvent);
 
     while (TRUE) {
-        status = recvfrom (
-            recv_sock,
-            client->recv.buf,
-            client->recv.maxstk,
-            0,
-            (struct sockaddr *)&new_recv_addr,
-            &recv_addr_size);
-        if (status < 0) {
+        ndgs = epicsSocketRecvMany ( recv_sock, dgs, ( unsigned ) nbatch );
+        if (ndgs < 0) {
             if (SOCKERRNO != SOCK_EINTR) {
                 char sockErrBuf[64];
                 epicsSocketConvertErrnoToString (
@@ -180,9 +205,13 @@ void cast_server(void *pParm)
                         sockErrBuf);
                 epicsThreadSleep(1.0);
             }
+        }
 
-        } else {
+        for (idg = 0; idg < ndgs; idg++) {
             size_t idx;
+
+            new_recv_addr = dgs[idg].addr.ia;
+            status = (int) dgs[idg].len;
             for(idx=0; casIgnoreAddrs[idx]; idx++)
             {
                 if(new_recv_addr.sin_addr.s_addr==casIgnoreAddrs[idx]) {
@@ -190,9 +219,22 @@ void cast_server(void *pParm)
                     break;
                 }
             }
-        }
 
-        if (status >= 0 && casudp_ctl == ctlRun) {
+            if (status >= 0 && dgs[idg].truncated) {
+                if (CASDEBUG>0) {
+                    char buf[40];
+
+                    ipAddrToDottedIP (&new_recv_addr, buf, sizeof(buf));
+                    errlogPrintf ("CAS: oversized UDP msg from %s ignored\n",
+                        buf);
+                }
+                status = -1;
+            }
+
+            if (status < 0 || casudp_ctl != ctlRun)
+                continue;
+
+            client->recv.buf = dgs[idg].buf;
             client->recv.cnt = (unsigned) status;
             client->recv.stk = 0ul;
             epicsTimeGetCurrent(&client->time_at_last_recv);
@@ -267,6 +309,7 @@ void cast_server(void *pParm)
                 }
             }
         }
+        client->recv.buf = recv_buf;
 
         /*
          * allow messages to batch up if more are coming
@@ -282,10 +325,14 @@ void cast_server(void *pParm)
             cas_send_dg_msg (client);
             clean_addrq (client);
         }
+        cas_flush_dg_batch (client);
     }
 
     /* ATM never reached, just a placeholder */
 
+    free(client->udpSendBatch);
+    client->udpSendBatch = NULL;
+    free(batch_bufs);
     if(!mysocket)
         client->sock = INVALID_SOCKET; /* only one cast_server should destroy the reply socket */
     destroy_client(client);
@@ -23,7 +23,7 @@
 #include "asLib.h"
 #include "dbChannel.h"
 #include "dbNotify.h"
-#define CA_MINOR_PROTOCOL_REVISION 13
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 #include "ellLib.h"
 #include "epicsTime.h"
@@ -65,6 +65,19 @@ struct message_buffer {
 
 extern epicsThreadPrivateId rsrvCurrentClient;
 
+/* Number of UDP datagrams received, or replies sent, per system call */
+#define CAS_UDP_BATCH 16
+
+/*
+ * UDP replies queued by cas_send_dg_msg() while the cast server works
+ * through a batch of received requests, sent by cas_flush_dg_batch()
+ */
+typedef struct casUdpSendBatch {
+  unsigned                  count;
+  epicsSocketDatagram       dgs[CAS_UDP_BATCH];
+  char                      bufs[CAS_UDP_BATCH][MAX_UDP_SEND];
+} casUdpSendBatch;
+
 typedef struct client {
   ELLNODE               node;
   /*! guarded by SEND_LOCK()  aka. client::lock */
@@ -92,9 +105,31 @@ typedef struct client {
   ca_uint32_t           seqNoOfReq; /* for udp  */
   unsigned              recvBytesToDrain;
   unsigned              priority;
+  /*! guarded by SEND_LOCK(), zero unless responses are to be compressed */
+  ca_uint32_t           compressThreshold;
+  char                  *pCompressBuf;
+  unsigned              compressBufSize;
   char                  disconnect; /* disconnect detected */
+  /*! UDP only, NULL to send each reply when it is complete */
+  casUdpSendBatch       *udpSendBatch;
+  /*! TCP only, NULL unless the circuit is served by a CAS-io thread */
+  struct casIoThread    *ioThread;
+  /*! private to the CAS-io thread, cf. camsgpoll.c */
+  ELLNODE               ioNode;
+  epicsTimeStamp        ioRetryTime;
+  unsigned              ioEvents;
+  char                  ioRecvHeld; /* requests wait in recv for the replies to go */
+  /*! atomic, set while a thread waits in send() for this circuit */
+  int                   sendWaiting;
 } client;
 
+/* cas_send_bs_nowait() results */
+enum casSendStatus {
+    casSendDone,        /* nothing left queued */
+    casSendPending,     /* the socket would block */
+    casSendNoBufs       /* the system is out of network buffers */
+};
+
 /* Channel state shows which struct client list a
  * channel_in_us::node is in.
  *
@@ -220,8 +255,17 @@ extern "C" {
 #endif
 
 void camsgtask (void *client);
+int casProcessRecv ( struct client *client, unsigned nchars );
+unsigned casIoThreadsInit ( unsigned count );
+unsigned casIoThreadsActive ( void );
+int casIoThreadAttach ( struct client *client );
+void casIoThreadsShow ( unsigned level );
+int casIoThreadIsCurrent ( const struct client *client );
+int casIoHoldRecv ( struct client *client );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
+enum casSendStatus cas_send_bs_nowait ( struct client *pclient );
 void cas_send_dg_msg ( struct client *pclient );
+void cas_flush_dg_batch ( struct client *pclient );
 void rsrv_online_notify_task (void *);
 void cast_server (void *);
 struct client *create_client ( SOCKET sock, int proto );
@@ -254,6 +298,13 @@ int cas_copy_in_header (
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t );
 void cas_set_header_count (struct client *pClient, ca_uint32_t count);
 void cas_commit_msg ( struct client *pClient, ca_uint32_t size );
+void cas_commit_compressed_msg ( struct client *pClient, ca_uint32_t size,
+    unsigned elemSize );
+int cas_send_bs_data (
+    struct client *pClient, ca_uint16_t response, ca_uint16_t dataType,
+    ca_uint32_t nElem, ca_uint32_t cid, ca_uint32_t responseSpecific,
+    const void *pMeta, ca_uint32_t metaSize,
+    const void *pData, ca_uint32_t dataSize, int convert );
 
 #ifdef __cplusplus
 }
@@ -10,6 +10,9 @@
 /*  Usage
  *      {calc:{expr:"A*B", args:[{...}, ...], units:"mm"}}
  *  First link in 'args' is 'A', second is 'B', and so forth.
+ *
+ *  When an array is read through the link and some of the args are
+ *  arrays, the expression is evaluated for each element of those arrays.
  */
 
 #include <string.h>
@@ -61,14 +64,20 @@ typedef struct calc_link {
     char *post_expr;
     char *post_major;
     char *post_minor;
+    calcCompiled *comp_expr;
     char *units;
     short tinp;
     struct link inp[CALCPERFORM_NARGS];
     struct link out;
     double arg[CALCPERFORM_NARGS];
+    double *array[CALCPERFORM_NARGS];   /* array args */
+    long nelem[CALCPERFORM_NARGS];      /* elements in array[i] */
+    long asize[CALCPERFORM_NARGS];      /* space in array[i] */
     epicsTimeStamp time;
     epicsUTag utag;
     double val;
+    double *aval;       /* array result */
+    long avalsize;      /* space in aval */
 } calc_link;
 
 static lset lnkCalc_lset;
@@ -116,6 +125,10 @@ static void lnkCalc_free(jlink *pjlink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcCompiledFree(clink->comp_expr);
+    for (i = 0; i < CALCPERFORM_NARGS; i++)
+        free(clink->array[i]);
+    free(clink->aval);
     free(clink->units);
     free(clink);
 }
@@ -226,6 +239,14 @@ static jlif_result lnkCalc_string(jlink *pjlink, const char *val, size_t len)
         return jlif_stop;
     }
 
+    if (clink->pstate == ps_expr) {
+        clink->comp_expr = calcCompile(postbuf);
+        if (!clink->comp_expr) {
+            errlogPrintf("lnkCalc: Out of memory\n");
+            return jlif_stop;
+        }
+    }
+
     return jlif_continue;
 }
 
@@ -412,8 +433,12 @@ static void lnkCalc_report(const jlink *pjlink, int level, int indent)
             jlink *child = plink->type == JSON_LINK ?
                 plink->value.json.jlink : NULL;
 
-            printf("%*s  Input %c: %g\n", indent, "",
-                i + 'A', clink->arg[i]);
+            if (clink->nelem[i] > 1)
+                printf("%*s  Input %c: %g, ... (%ld elements)\n", indent, "",
+                    i + 'A', clink->arg[i], clink->nelem[i]);
+            else
+                printf("%*s  Input %c: %g\n", indent, "",
+                    i + 'A', clink->arg[i]);
 
             if (child)
                 dbJLinkReport(child, level - 1, indent + 4);
@@ -448,6 +473,49 @@ static long lnkCalc_map_children(jlink *pjlink, jlink_map_fn rtn, void *ctx)
 
 /*************************** lset Routines **************************/
 
+/* Make space for n values in an array, zeroing any new elements */
+static long growArray(double **parray, long *psize, long n)
+{
+    double *pnew;
+
+    if (n <= *psize)
+        return 0;
+    pnew = realloc(*parray, n * sizeof(double));
+    if (!pnew)
+        return S_db_noMemory;
+    memset(pnew + *psize, 0, (n - *psize) * sizeof(double));
+    *parray = pnew;
+    *psize = n;
+    return 0;
+}
+
+/* Load a constant arg, which may be an array */
+static void loadArg(calc_link *clink, int i)
+{
+    struct link *child = &clink->inp[i];
+    long nReq = 16;
+
+    while (!growArray(&clink->array[i], &clink->asize[i], nReq)) {
+        long n = nReq;
+
+        if (dbLoadLinkArray(child, DBR_DOUBLE, clink->array[i], &n))
+            break;
+        if (n < nReq) {
+            if (n > 1) {
+                clink->nelem[i] = n;
+                clink->arg[i] = clink->array[i][0];
+                return;
+            }
+            break;
+        }
+        nReq *= 2;
+    }
+    free(clink->array[i]);
+    clink->array[i] = NULL;
+    clink->asize[i] = 0;
+    dbLoadLink(child, DBR_DOUBLE, &clink->arg[i]);
+}
+
 static void lnkCalc_open(struct link *plink)
 {
     calc_link *clink = CONTAINER(plink->value.json.jlink,
@@ -459,7 +527,10 @@ static void lnkCalc_open(struct link *plink)
 
         child->precord = plink->precord;
         dbJLinkInit(child);
-        dbLoadLink(child, DBR_DOUBLE, &clink->arg[i]);
+        if (child->type == JSON_LINK && dbLinkIsConstant(child))
+            loadArg(clink, i);
+        else
+            dbLoadLink(child, DBR_DOUBLE, &clink->arg[i]);
     }
 
     if (clink->out.type == JSON_LINK) {
@@ -489,6 +560,10 @@ static void lnkCalc_remove(struct dbLocker *locker, struct link *plink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcCompiledFree(clink->comp_expr);
+    for (i = 0; i < CALCPERFORM_NARGS; i++)
+        free(clink->array[i]);
+    free(clink->aval);
     free(clink->units);
     free(clink);
     plink->value.json.jlink = NULL;
@@ -525,15 +600,42 @@ static int lnkCalc_getDBFtype(const struct link *plink)
     return DBF_DOUBLE;
 }
 
+/* Elements in arg i if it's an array, else 0 or 1 */
+static long argElements(const calc_link *clink, int i)
+{
+    const struct link *child = &clink->inp[i];
+    long n = 0;
+
+    if (child->type != JSON_LINK)
+        return 0;
+    if (dbLinkIsConstant(child))
+        return clink->nelem[i];
+    if (dbGetNelements(child, &n))
+        return 0;
+    return n;
+}
+
 static long lnkCalc_getElements(const struct link *plink, long *nelements)
 {
-    *nelements = 1;
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+    long n = 1;
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        long nargs = argElements(clink, i);
+
+        if (nargs > n)
+            n = nargs;
+    }
+    *nelements = n;
     return 0;
 }
 
 /* Get value and timestamp atomically for link indicated by time */
 struct lcvt {
     double *pval;
+    long *pnReq;
     epicsTimeStamp *ptime;
     epicsUTag *ptag;
 };
@@ -541,8 +643,7 @@ struct lcvt {
 static long readLocked(struct link *pinp, void *vvt)
 {
     struct lcvt *pvt = (struct lcvt *) vvt;
-    long nReq = 1;
-    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL, &nReq);
+    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL, pvt->pnReq);
 
     if (!status && pvt->ptime)
         dbGetTimeStampTag(pinp, pvt->ptime, pvt->ptag);
@@ -550,13 +651,85 @@ static long readLocked(struct link *pinp, void *vvt)
     return status;
 }
 
+/* Read up to *pnReq values of arg i into pval */
+static long readArg(calc_link *clink, dbCommon *prec, int i, double *pval,
+    long *pnReq)
+{
+    struct link *child = &clink->inp[i];
+    long status;
+
+    if (i == clink->tinp) {
+        struct lcvt vt = {pval, pnReq, &clink->time, &clink->utag};
+
+        status = dbLinkDoLocked(child, readLocked, &vt);
+        if (status == S_db_noLSET)
+            status = readLocked(child, &vt);
+
+        if (dbLinkIsConstant(&prec->tsel) &&
+            prec->tse == epicsTimeEventDeviceTime) {
+            prec->time = clink->time;
+            prec->utag = clink->utag;
+        }
+    }
+    else
+        status = dbGetLink(child, DBR_DOUBLE, pval, NULL, pnReq);
+
+    return status;
+}
+
+/* Read the args, the ones that are arrays into clink->array.  Returns the
+ * number of elements to calculate, the fewest in any array arg but no more
+ * than nRequest, or 0 if there are no array args.
+ */
+static long readArgs(calc_link *clink, dbCommon *prec, long nRequest,
+    const double **parrays)
+{
+    long nelem = nRequest;
+    int arrays = 0;
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+        long nReq = 1;
+        long n = nRequest > 1 ? argElements(clink, i) : 0;
+
+        parrays[i] = NULL;
+        if (n <= 1) {
+            /* Any link errors will trigger a LINK/INVALID alarm in the
+             * child link */
+            readArg(clink, prec, i, &clink->arg[i], &nReq);
+            continue;
+        }
+
+        if (!dbLinkIsConstant(child)) {
+            nReq = n < nRequest ? n : nRequest;
+            if (growArray(&clink->array[i], &clink->asize[i], nReq) ||
+                readArg(clink, prec, i, clink->array[i], &nReq))
+                nReq = 0;
+            clink->nelem[i] = nReq;
+            if (nReq)
+                clink->arg[i] = clink->array[i][0];
+        }
+
+        parrays[i] = clink->array[i];
+        arrays = 1;
+        if (clink->nelem[i] < nelem)
+            nelem = clink->nelem[i];
+    }
+    for (; i < CALCPERFORM_NARGS; i++)
+        parrays[i] = NULL;
+
+    return arrays ? nelem : 0;
+}
+
 static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     long *pnRequest)
 {
     calc_link *clink = CONTAINER(plink->value.json.jlink,
         struct calc_link, jlink);
     dbCommon *prec = plink->precord;
-    int i;
+    const double *arrays[CALCPERFORM_NARGS];
+    long nelem;
     long status;
     FASTCONVERT conv;
 
@@ -565,32 +738,30 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
 
     conv = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType];
 
-    /* Any link errors will trigger a LINK/INVALID alarm in the child link */
-    for (i = 0; i < clink->nArgs; i++) {
-        struct link *child = &clink->inp[i];
-        long nReq = 1;
-
-        if (i == clink->tinp) {
-            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag};
-
-            status = dbLinkDoLocked(child, readLocked, &vt);
-            if (status == S_db_noLSET)
-                status = readLocked(child, &vt);
-
-            if (dbLinkIsConstant(&prec->tsel) &&
-                prec->tse == epicsTimeEventDeviceTime) {
-                prec->time = clink->time;
-                prec->utag = clink->utag;
-            }
-        }
-        else
-            dbGetLink(child, DBR_DOUBLE, &clink->arg[i], NULL, &nReq);
-    }
+    nelem = readArgs(clink, prec, pnRequest ? *pnRequest : 1, arrays);
     clink->stat = 0;
     clink->sevr = 0;
     clink->amsg[0] = '\0';
 
-    if (clink->post_expr) {
+    if (nelem && clink->comp_expr) {
+        /* The alarm expressions below see the first elements */
+        status = growArray(&clink->aval, &clink->avalsize, nelem);
+        if (!status)
+            status = calcCompiledPerformArray(clink->comp_expr, clink->arg,
+                arrays, clink->aval, nelem);
+        if (!status) {
+            short size = dbValueSize(dbrType);
+            char *pdest = pbuffer;
+            long i;
+
+            clink->val = clink->aval[0];
+            for (i = 0; !status && i < nelem; i++, pdest += size)
+                status = conv(&clink->aval[i], pdest, NULL);
+        }
+        if (!status)
+            *pnRequest = nelem;
+    }
+    else if (clink->post_expr) {
         status = calcPerform(clink->arg, &clink->val, clink->post_expr);
         if (!status)
             status = conv(&clink->val, pbuffer, NULL);
@@ -647,24 +818,9 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
 
     /* Any link errors will trigger a LINK/INVALID alarm in the child link */
     for (i = 0; i < clink->nArgs; i++) {
-        struct link *child = &clink->inp[i];
         long nReq = 1;
 
-        if (i == clink->tinp) {
-            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag};
-
-            status = dbLinkDoLocked(child, readLocked, &vt);
-            if (status == S_db_noLSET)
-                status = readLocked(child, &vt);
-
-            if (dbLinkIsConstant(&prec->tsel) &&
-                prec->tse == epicsTimeEventDeviceTime) {
-                prec->time = clink->time;
-                prec->utag = clink->utag;
-            }
-        }
-        else
-            dbGetLink(child, DBR_DOUBLE, &clink->arg[i], NULL, &nReq);
+        readArg(clink, prec, i, &clink->arg[i], &nReq);
     }
     clink->stat = 0;
     clink->sevr = 0;
@@ -458,11 +458,15 @@ static void monitor(aiRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec,&prec->val,monitor_mask);
+        void *fields[2] = {&prec->val, &prec->rval};
+        unsigned masks[2] = {monitor_mask, monitor_mask};
+        unsigned n = 1;
+
         if(prec->oraw != prec->rval) {
-            db_post_events(prec,&prec->rval,monitor_mask);
             prec->oraw = prec->rval;
+            n = 2;
         }
+        db_post_events_many(prec, fields, masks, n);
     }
     return;
 }
@@ -108,6 +108,7 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    prec->dpvt = calcCompile(prec->rpcl);
     return 0;
 }
 
@@ -118,7 +119,9 @@ static long process(struct dbCommon *pcommon)
 
     prec->pact = TRUE;
     if (fetch_values(prec) == 0) {
-        if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+        if (prec->dpvt ?
+            calcCompiledPerform(prec->dpvt, &prec->a, &prec->val) :
+            calcPerform(&prec->a, &prec->val, prec->rpcl)) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else
             prec->udf = isnan(prec->val);
@@ -143,7 +146,11 @@ static long special(DBADDR *paddr, int after)
 
     if (!after) return 0;
     if (paddr->special == SPC_CALC) {
-        if (postfix(prec->calc, prec->rpcl, &error_number)) {
+        long status = postfix(prec->calc, prec->rpcl, &error_number);
+
+        calcCompiledFree(prec->dpvt);
+        prec->dpvt = calcCompile(prec->rpcl);
+        if (status) {
             recGblRecordError(S_db_badField, (void *)prec,
                               "calc: Illegal CALC field");
             errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
@@ -112,6 +112,8 @@ typedef struct rpvtStruct {
     epicsCallback checkLinkCb;
     short    cbScheduled;
     short    caLinkStat; /* NO_CA_LINKS, CA_LINKS_ALL_OK, CA_LINKS_NOT_OK */
+    calcCompiled *rpcc; /* compiled CALC and OCAL, may be NULL */
+    calcCompiled *orpcc;
 } rpvtStruct;
 
 static void checkAlarms(calcoutRecord *prec);
@@ -189,6 +191,7 @@ static long init_record(struct dbCommon *pcommon, int pass)
     }
 
     prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
+    prpvt->rpcc = calcCompile(prec->rpcl);
     if (prec->clcv){
         recGblRecordError(S_db_badField, (void *)prec,
                           "calcout: init_record: Illegal CALC field");
@@ -197,6 +200,7 @@ static long init_record(struct dbCommon *pcommon, int pass)
     }
 
     prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
+    prpvt->orpcc = calcCompile(prec->orpc);
     if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
         recGblRecordError(S_db_badField, (void *)prec,
                           "calcout: init_record: Illegal OCAL field");
@@ -204,7 +208,6 @@ static long init_record(struct dbCommon *pcommon, int pass)
                      prec->name, calcErrorStr(error_number), prec->ocal);
     }
 
-    prpvt = prec->rpvt;
     callbackSetCallback(checkLinksCallback, &prpvt->checkLinkCb);
     callbackSetPriority(0, &prpvt->checkLinkCb);
     callbackSetUser(prec, &prpvt->checkLinkCb);
@@ -235,7 +238,9 @@ static long process(struct dbCommon *pcommon)
             checkLinks(prec);
         }
         if (fetch_values(prec) == 0) {
-            if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+            if (prpvt->rpcc ?
+                calcCompiledPerform(prpvt->rpcc, &prec->a, &prec->val) :
+                calcPerform(&prec->a, &prec->val, prec->rpcl)) {
                 recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "calcPerform");
             } else {
                 prec->udf = isnan(prec->val);
@@ -324,6 +329,8 @@ static long special(DBADDR *paddr, int after)
     switch(fieldIndex) {
       case(calcoutRecordCALC):
         prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
+        calcCompiledFree(prpvt->rpcc);
+        prpvt->rpcc = calcCompile(prec->rpcl);
         if (prec->clcv){
             recGblRecordError(S_db_badField, (void *)prec,
                       "calcout: special(): Illegal CALC field");
@@ -335,6 +342,8 @@ static long special(DBADDR *paddr, int after)
 
       case(calcoutRecordOCAL):
         prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
+        calcCompiledFree(prpvt->orpcc);
+        prpvt->orpcc = calcCompile(prec->orpc);
         if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
             recGblRecordError(S_db_badField, (void *)prec,
                     "calcout: special(): Illegal OCAL field");
@@ -603,13 +612,17 @@ static void checkAlarms(calcoutRecord *prec)
 
 static void execOutput(calcoutRecord *prec)
 {
+    rpvtStruct *prpvt = prec->rpvt;
+
     /* Determine output data */
     switch(prec->dopt) {
     case calcoutDOPT_Use_VAL:
         prec->oval = prec->val;
         break;
     case calcoutDOPT_Use_OVAL:
-        if (calcPerform(&prec->a, &prec->oval, prec->orpc)) {
+        if (prpvt->orpcc ?
+            calcCompiledPerform(prpvt->orpcc, &prec->a, &prec->oval) :
+            calcPerform(&prec->a, &prec->oval, prec->orpc)) {
             recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "OCAL calcPerform");
         } else {
             prec->udf = isnan(prec->oval);
@@ -321,7 +321,7 @@ static void monitor(waveformRecord *prec)
     }
 
     if (monitor_mask) {
-        db_post_events(prec, &prec->val, monitor_mask);
+        db_post_array_events(prec, &prec->val, monitor_mask);
     }
 }
 
@@ -0,0 +1,455 @@
+/** @file arrRecord.h
+ * @brief Declarations for the @ref arrRecord "arr" record type.
+ *
+ * This header was generated from arrRecord.dbd
+ */
+
+#ifndef INC_arrRecord_H
+#define INC_arrRecord_H
+
+#include "epicsTypes.h"
+#include "link.h"
+#include "epicsMutex.h"
+#include "ellLib.h"
+#include "devSup.h"
+#include "epicsTime.h"
+
+#ifndef menuPost_NUM_CHOICES
+/** @brief Enumerated type from menu menuPost */
+typedef enum {
+    menuPost_OnChange               /**< @brief State string "On Change" */,
+    menuPost_Always                 /**< @brief State string "Always" */
+} menuPost;
+/** @brief Number of states defined for menu menuPost */
+#define menuPost_NUM_CHOICES 2
+#endif
+
+#ifndef menuPriority_NUM_CHOICES
+/** @brief Enumerated type from menu menuPriority */
+typedef enum {
+    menuPriorityLOW                 /**< @brief State string "LOW" */,
+    menuPriorityMEDIUM              /**< @brief State string "MEDIUM" */,
+    menuPriorityHIGH                /**< @brief State string "HIGH" */
+} menuPriority;
+/** @brief Number of states defined for menu menuPriority */
+#define menuPriority_NUM_CHOICES 3
+#endif
+
+#ifndef menuOmsl_NUM_CHOICES
+/** @brief Enumerated type from menu menuOmsl */
+typedef enum {
+    menuOmslsupervisory             /**< @brief State string "supervisory" */,
+    menuOmslclosed_loop             /**< @brief State string "closed_loop" */
+} menuOmsl;
+/** @brief Number of states defined for menu menuOmsl */
+#define menuOmsl_NUM_CHOICES 2
+#endif
+
+#ifndef menuConvert_NUM_CHOICES
+/** @brief Enumerated type from menu menuConvert */
+typedef enum {
+    menuConvertNO_CONVERSION        /**< @brief State string "NO CONVERSION" */,
+    menuConvertSLOPE                /**< @brief State string "SLOPE" */,
+    menuConvertLINEAR               /**< @brief State string "LINEAR" */,
+    menuConverttypeKdegF            /**< @brief State string "typeKdegF" */,
+    menuConverttypeKdegC            /**< @brief State string "typeKdegC" */,
+    menuConverttypeJdegF            /**< @brief State string "typeJdegF" */,
+    menuConverttypeJdegC            /**< @brief State string "typeJdegC" */,
+    menuConverttypeEdegF            /**< @brief State string "typeEdegF(ixe only)" */,
+    menuConverttypeEdegC            /**< @brief State string "typeEdegC(ixe only)" */,
+    menuConverttypeTdegF            /**< @brief State string "typeTdegF" */,
+    menuConverttypeTdegC            /**< @brief State string "typeTdegC" */,
+    menuConverttypeRdegF            /**< @brief State string "typeRdegF" */,
+    menuConverttypeRdegC            /**< @brief State string "typeRdegC" */,
+    menuConverttypeSdegF            /**< @brief State string "typeSdegF" */,
+    menuConverttypeSdegC            /**< @brief State string "typeSdegC" */
+} menuConvert;
+/** @brief Number of states defined for menu menuConvert */
+#define menuConvert_NUM_CHOICES 15
+#endif
+
+#ifndef menuAlarmSevr_NUM_CHOICES
+/** @brief Enumerated type from menu menuAlarmSevr */
+typedef enum {
+    menuAlarmSevrNO_ALARM           /**< @brief State string "NO_ALARM" */,
+    menuAlarmSevrMINOR              /**< @brief State string "MINOR" */,
+    menuAlarmSevrMAJOR              /**< @brief State string "MAJOR" */,
+    menuAlarmSevrINVALID            /**< @brief State string "INVALID" */
+} menuAlarmSevr;
+/** @brief Number of states defined for menu menuAlarmSevr */
+#define menuAlarmSevr_NUM_CHOICES 4
+#endif
+
+#ifndef menuAlarmStat_NUM_CHOICES
+/** @brief Enumerated type from menu menuAlarmStat */
+typedef enum {
+    menuAlarmStatNO_ALARM           /**< @brief State string "NO_ALARM" */,
+    menuAlarmStatREAD               /**< @brief State string "READ" */,
+    menuAlarmStatWRITE              /**< @brief State string "WRITE" */,
+    menuAlarmStatHIHI               /**< @brief State string "HIHI" */,
+    menuAlarmStatHIGH               /**< @brief State string "HIGH" */,
+    menuAlarmStatLOLO               /**< @brief State string "LOLO" */,
+    menuAlarmStatLOW                /**< @brief State string "LOW" */,
+    menuAlarmStatSTATE              /**< @brief State string "STATE" */,
+    menuAlarmStatCOS                /**< @brief State string "COS" */,
+    menuAlarmStatCOMM               /**< @brief State string "COMM" */,
+    menuAlarmStatTIMEOUT            /**< @brief State string "TIMEOUT" */,
+    menuAlarmStatHWLIMIT            /**< @brief State string "HWLIMIT" */,
+    menuAlarmStatCALC               /**< @brief State string "CALC" */,
+    menuAlarmStatSCAN               /**< @brief State string "SCAN" */,
+    menuAlarmStatLINK               /**< @brief State string "LINK" */,
+    menuAlarmStatSOFT               /**< @brief State string "SOFT" */,
+    menuAlarmStatBAD_SUB            /**< @brief State string "BAD_SUB" */,
+    menuAlarmStatUDF                /**< @brief State string "UDF" */,
+    menuAlarmStatDISABLE            /**< @brief State string "DISABLE" */,
+    menuAlarmStatSIMM               /**< @brief State string "SIMM" */,
+    menuAlarmStatREAD_ACCESS        /**< @brief State string "READ_ACCESS" */,
+    menuAlarmStatWRITE_ACCESS       /**< @brief State string "WRITE_ACCESS" */
+} menuAlarmStat;
+/** @brief Number of states defined for menu menuAlarmStat */
+#define menuAlarmStat_NUM_CHOICES 22
+#endif
+
+#ifndef menuPini_NUM_CHOICES
+/** @brief Enumerated type from menu menuPini */
+typedef enum {
+    menuPiniNO                      /**< @brief State string "NO" */,
+    menuPiniYES                     /**< @brief State string "YES" */,
+    menuPiniRUN                     /**< @brief State string "RUN" */,
+    menuPiniRUNNING                 /**< @brief State string "RUNNING" */,
+    menuPiniPAUSE                   /**< @brief State string "PAUSE" */,
+    menuPiniPAUSED                  /**< @brief State string "PAUSED" */
+} menuPini;
+/** @brief Number of states defined for menu menuPini */
+#define menuPini_NUM_CHOICES 6
+#endif
+
+#ifndef menuYesNo_NUM_CHOICES
+/** @brief Enumerated type from menu menuYesNo */
+typedef enum {
+    menuYesNoNO                     /**< @brief State string "NO" */,
+    menuYesNoYES                    /**< @brief State string "YES" */
+} menuYesNo;
+/** @brief Number of states defined for menu menuYesNo */
+#define menuYesNo_NUM_CHOICES 2
+#endif
+
+#ifndef menuFtype_NUM_CHOICES
+/** @brief Enumerated type from menu menuFtype */
+typedef enum {
+    menuFtypeSTRING                 /**< @brief State string "STRING" */,
+    menuFtypeCHAR                   /**< @brief State string "CHAR" */,
+    menuFtypeUCHAR                  /**< @brief State string "UCHAR" */,
+    menuFtypeSHORT                  /**< @brief State string "SHORT" */,
+    menuFtypeUSHORT                 /**< @brief State string "USHORT" */,
+    menuFtypeLONG                   /**< @brief State string "LONG" */,
+    menuFtypeULONG                  /**< @brief State string "ULONG" */,
+    menuFtypeINT64                  /**< @brief State string "INT64" */,
+    menuFtypeUINT64                 /**< @brief State string "UINT64" */,
+    menuFtypeFLOAT                  /**< @brief State string "FLOAT" */,
+    menuFtypeDOUBLE                 /**< @brief State string "DOUBLE" */,
+    menuFtypeENUM                   /**< @brief State string "ENUM" */
+} menuFtype;
+/** @brief Number of states defined for menu menuFtype */
+#define menuFtype_NUM_CHOICES 12
+#endif
+
+#ifndef menuIvoa_NUM_CHOICES
+/** @brief Enumerated type from menu menuIvoa */
+typedef enum {
+    menuIvoaContinue_normally       /**< @brief State string "Continue normally" */,
+    menuIvoaDon_t_drive_outputs     /**< @brief State string "Don't drive outputs" */,
+    menuIvoaSet_output_to_IVOV      /**< @brief State string "Set output to IVOV" */
+} menuIvoa;
+/** @brief Number of states defined for menu menuIvoa */
+#define menuIvoa_NUM_CHOICES 3
+#endif
+
+#ifndef menuScan_NUM_CHOICES
+/** @brief Enumerated type from menu menuScan */
+typedef enum {
+    menuScanPassive                 /**< @brief State string "Passive" */,
+    menuScanEvent                   /**< @brief State string "Event" */,
+    menuScanI_O_Intr                /**< @brief State string "I/O Intr" */,
+    menuScan10_second               /**< @brief State string "10 second" */,
+    menuScan5_second                /**< @brief State string "5 second" */,
+    menuScan2_second                /**< @brief State string "2 second" */,
+    menuScan1_second                /**< @brief State string "1 second" */,
+    menuScan_5_second               /**< @brief State string ".5 second" */,
+    menuScan_2_second               /**< @brief State string ".2 second" */,
+    menuScan_1_second               /**< @brief State string ".1 second" */
+} menuScan;
+/** @brief Number of states defined for menu menuScan */
+#define menuScan_NUM_CHOICES 10
+#endif
+
+#ifndef menuSimm_NUM_CHOICES
+/** @brief Enumerated type from menu menuSimm */
+typedef enum {
+    menuSimmNO                      /**< @brief State string "NO" */,
+    menuSimmYES                     /**< @brief State string "YES" */,
+    menuSimmRAW                     /**< @brief State string "RAW" */
+} menuSimm;
+/** @brief Number of states defined for menu menuSimm */
+#define menuSimm_NUM_CHOICES 3
+#endif
+
+/** @brief Declaration of arr record type. */
+typedef struct arrRecord {
+    char                name[61];   /**< @brief Record Name */
+    char                desc[41];   /**< @brief Descriptor */
+    char                asg[29];    /**< @brief Access Security Group */
+    epicsEnum16         scan;       /**< @brief Scan Mechanism */
+    epicsEnum16         pini;       /**< @brief Process at iocInit */
+    epicsInt16          phas;       /**< @brief Scan Phase */
+    char                evnt[40];   /**< @brief Event Name */
+    epicsInt16          tse;        /**< @brief Time Stamp Event */
+    DBLINK              tsel;       /**< @brief Time Stamp Link */
+    epicsEnum16         dtyp;       /**< @brief Device Type */
+    epicsInt16          disv;       /**< @brief Disable Value */
+    epicsInt16          disa;       /**< @brief Disable */
+    DBLINK              sdis;       /**< @brief Scanning Disable */
+    epicsMutexId        mlok;       /**< @brief Monitor lock */
+    ELLLIST             mlis;       /**< @brief Monitor List */
+    ELLLIST             bklnk;      /**< @brief Backwards link tracking */
+    epicsUInt8          disp;       /**< @brief Disable putField */
+    epicsUInt8          proc;       /**< @brief Force Processing */
+    epicsEnum16         stat;       /**< @brief Alarm Status */
+    epicsEnum16         sevr;       /**< @brief Alarm Severity */
+    char                amsg[40];   /**< @brief Alarm Message */
+    epicsEnum16         nsta;       /**< @brief New Alarm Status */
+    epicsEnum16         nsev;       /**< @brief New Alarm Severity */
+    char                namsg[40];  /**< @brief New Alarm Message */
+    epicsEnum16         acks;       /**< @brief Alarm Ack Severity */
+    epicsEnum16         ackt;       /**< @brief Alarm Ack Transient */
+    epicsEnum16         diss;       /**< @brief Disable Alarm Sevrty */
+    epicsUInt8          lcnt;       /**< @brief Lock Count */
+    epicsUInt8          pact;       /**< @brief Record active */
+    epicsUInt8          putf;       /**< @brief dbPutField process */
+    epicsUInt8          rpro;       /**< @brief Reprocess  */
+    struct asgMember    *asp;       /**< @brief Access Security Pvt */
+    struct processNotify *ppn;      /**< @brief pprocessNotify */
+    struct processNotifyRecord *ppnr; /**< @brief pprocessNotifyRecord */
+    struct scan_element *spvt;      /**< @brief Scan Private */
+    struct typed_rset   *rset;      /**< @brief Address of RSET */
+    unambiguous_dset    *dset;      /**< @brief DSET address */
+    void                *dpvt;      /**< @brief Device Private */
+    struct dbRecordType *rdes;      /**< @brief Address of dbRecordType */
+    struct lockRecord   *lset;      /**< @brief Lock Set */
+    epicsEnum16         prio;       /**< @brief Scheduling Priority */
+    epicsUInt8          tpro;       /**< @brief Trace Processing */
+    epicsUInt8          bkpt;       /**< @brief Break Point */
+    epicsUInt8          udf;        /**< @brief Undefined */
+    epicsEnum16         udfs;       /**< @brief Undefined Alarm Sevrty */
+    epicsTimeStamp      time;       /**< @brief Time */
+    epicsUInt64         utag;       /**< @brief Time Tag */
+    DBLINK              flnk;       /**< @brief Forward Process Link */
+    void *val;                      /**< @brief Value */
+    epicsUInt32         nelm;       /**< @brief Number of Elements */
+    epicsEnum16         ftvl;       /**< @brief Field Type of Value */
+    epicsUInt32         nord;       /**< @brief Number elements read */
+    epicsUInt32         off;        /**< @brief Offset into array */
+    void *bptr;                     /**< @brief Buffer Pointer */
+    DBLINK              inp;        /**< @brief Input Link */
+    void (*clbk)(struct arrRecord*); /**< @brief Processing callback */
+} arrRecord;
+
+typedef enum {
+	arrRecordNAME = 0,
+	arrRecordDESC = 1,
+	arrRecordASG = 2,
+	arrRecordSCAN = 3,
+	arrRecordPINI = 4,
+	arrRecordPHAS = 5,
+	arrRecordEVNT = 6,
+	arrRecordTSE = 7,
+	arrRecordTSEL = 8,
+	arrRecordDTYP = 9,
+	arrRecordDISV = 10,
+	arrRecordDISA = 11,
+	arrRecordSDIS = 12,
+	arrRecordMLOK = 13,
+	arrRecordMLIS = 14,
+	arrRecordBKLNK = 15,
+	arrRecordDISP = 16,
+	arrRecordPROC = 17,
+	arrRecordSTAT = 18,
+	arrRecordSEVR = 19,
+	arrRecordAMSG = 20,
+	arrRecordNSTA = 21,
+	arrRecordNSEV = 22,
+	arrRecordNAMSG = 23,
+	arrRecordACKS = 24,
+	arrRecordACKT = 25,
+	arrRecordDISS = 26,
+	arrRecordLCNT = 27,
+	arrRecordPACT = 28,
+	arrRecordPUTF = 29,
+	arrRecordRPRO = 30,
+	arrRecordASP = 31,
+	arrRecordPPN = 32,
+	arrRecordPPNR = 33,
+	arrRecordSPVT = 34,
+	arrRecordRSET = 35,
+	arrRecordDSET = 36,
+	arrRecordDPVT = 37,
+	arrRecordRDES = 38,
+	arrRecordLSET = 39,
+	arrRecordPRIO = 40,
+	arrRecordTPRO = 41,
+	arrRecordBKPT = 42,
+	arrRecordUDF = 43,
+	arrRecordUDFS = 44,
+	arrRecordTIME = 45,
+	arrRecordUTAG = 46,
+	arrRecordFLNK = 47,
+	arrRecordVAL = 48,
+	arrRecordNELM = 49,
+	arrRecordFTVL = 50,
+	arrRecordNORD = 51,
+	arrRecordOFF = 52,
+	arrRecordBPTR = 53,
+	arrRecordINP = 54,
+	arrRecordCLBK = 55
+} arrFieldIndex;
+
+#ifdef GEN_SIZE_OFFSET
+
+#include <epicsExport.h>
+#include <cantProceed.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+static int arrRecordSizeOffset(dbRecordType *prt)
+{
+    arrRecord *prec = 0;
+
+    if (prt->no_fields != 56) {
+        cantProceed("IOC build or installation error:\n"
+            "    The arrRecord defined in the DBD file has %d fields,\n"
+            "    but the record support code was built with 56.\n",
+            prt->no_fields);
+    }
+    prt->papFldDes[arrRecordNAME]->size = sizeof(prec->name);
+    prt->papFldDes[arrRecordNAME]->offset = (unsigned short)offsetof(arrRecord, name);
+    prt->papFldDes[arrRecordDESC]->size = sizeof(prec->desc);
+    prt->papFldDes[arrRecordDESC]->offset = (unsigned short)offsetof(arrRecord, desc);
+    prt->papFldDes[arrRecordASG]->size = sizeof(prec->asg);
+    prt->papFldDes[arrRecordASG]->offset = (unsigned short)offsetof(arrRecord, asg);
+    prt->papFldDes[arrRecordSCAN]->size = sizeof(prec->scan);
+    prt->papFldDes[arrRecordSCAN]->offset = (unsigned short)offsetof(arrRecord, scan);
+    prt->papFldDes[arrRecordPINI]->size = sizeof(prec->pini);
+    prt->papFldDes[arrRecordPINI]->offset = (unsigned short)offsetof(arrRecord, pini);
+    prt->papFldDes[arrRecordPHAS]->size = sizeof(prec->phas);
+    prt->papFldDes[arrRecordPHAS]->offset = (unsigned short)offsetof(arrRecord, phas);
+    prt->papFldDes[arrRecordEVNT]->size = sizeof(prec->evnt);
+    prt->papFldDes[arrRecordEVNT]->offset = (unsigned short)offsetof(arrRecord, evnt);
+    prt->papFldDes[arrRecordTSE]->size = sizeof(prec->tse);
+    prt->papFldDes[arrRecordTSE]->offset = (unsigned short)offsetof(arrRecord, tse);
+    prt->papFldDes[arrRecordTSEL]->size = sizeof(prec->tsel);
+    prt->papFldDes[arrRecordTSEL]->offset = (unsigned short)offsetof(arrRecord, tsel);
+    prt->papFldDes[arrRecordDTYP]->size = sizeof(prec->dtyp);
+    prt->papFldDes[arrRecordDTYP]->offset = (unsigned short)offsetof(arrRecord, dtyp);
+    prt->papFldDes[arrRecordDISV]->size = sizeof(prec->disv);
+    prt->papFldDes[arrRecordDISV]->offset = (unsigned short)offsetof(arrRecord, disv);
+    prt->papFldDes[arrRecordDISA]->size = sizeof(prec->disa);
+    prt->papFldDes[arrRecordDISA]->offset = (unsigned short)offsetof(arrRecord, disa);
+    prt->papFldDes[arrRecordSDIS]->size = sizeof(prec->sdis);
+    prt->papFldDes[arrRecordSDIS]->offset = (unsigned short)offsetof(arrRecord, sdis);
+    prt->papFldDes[arrRecordMLOK]->size = sizeof(prec->mlok);
+    prt->papFldDes[arrRecordMLOK]->offset = (unsigned short)offsetof(arrRecord, mlok);
+    prt->papFldDes[arrRecordMLIS]->size = sizeof(prec->mlis);
+    prt->papFldDes[arrRecordMLIS]->offset = (unsigned short)offsetof(arrRecord, mlis);
+    prt->papFldDes[arrRecordBKLNK]->size = sizeof(prec->bklnk);
+    prt->papFldDes[arrRecordBKLNK]->offset = (unsigned short)offsetof(arrRecord, bklnk);
+    prt->papFldDes[arrRecordDISP]->size = sizeof(prec->disp);
+    prt->papFldDes[arrRecordDISP]->offset = (unsigned short)offsetof(arrRecord, disp);
+    prt->papFldDes[arrRecordPROC]->size = sizeof(prec->proc);
+    prt->papFldDes[arrRecordPROC]->offset = (unsigned short)offsetof(arrRecord, proc);
+    prt->papFldDes[arrRecordSTAT]->size = sizeof(prec->stat);
+    prt->papFldDes[arrRecordSTAT]->offset = (unsigned short)offsetof(arrRecord, stat);
+    prt->papFldDes[arrRecordSEVR]->size = sizeof(prec->sevr);
+    prt->papFldDes[arrRecordSEVR]->offset = (unsigned short)offsetof(arrRecord, sevr);
+    prt->papFldDes[arrRecordAMSG]->size = sizeof(prec->amsg);
+    prt->papFldDes[arrRecordAMSG]->offset = (unsigned short)offsetof(arrRecord, amsg);
+    prt->papFldDes[arrRecordNSTA]->size = sizeof(prec->nsta);
+    prt->papFldDes[arrRecordNSTA]->offset = (unsigned short)offsetof(arrRecord, nsta);
+    prt->papFldDes[arrRecordNSEV]->size = sizeof(prec->nsev);
+    prt->papFldDes[arrRecordNSEV]->offset = (unsigned short)offsetof(arrRecord, nsev);
+    prt->papFldDes[arrRecordNAMSG]->size = sizeof(prec->namsg);
+    prt->papFldDes[arrRecordNAMSG]->offset = (unsigned short)offsetof(arrRecord, namsg);
+    prt->papFldDes[arrRecordACKS]->size = sizeof(prec->acks);
+    prt->papFldDes[arrRecordACKS]->offset = (unsigned short)offsetof(arrRecord, acks);
+    prt->papFldDes[arrRecordACKT]->size = sizeof(prec->ackt);
+    prt->papFldDes[arrRecordACKT]->offset = (unsigned short)offsetof(arrRecord, ackt);
+    prt->papFldDes[arrRecordDISS]->size = sizeof(prec->diss);
+    prt->papFldDes[arrRecordDISS]->offset = (unsigned short)offsetof(arrRecord, diss);
+    prt->papFldDes[arrRecordLCNT]->size = sizeof(prec->lcnt);
+    prt->papFldDes[arrRecordLCNT]->offset = (unsigned short)offsetof(arrRecord, lcnt);
+    prt->papFldDes[arrRecordPACT]->size = sizeof(prec->pact);
+    prt->papFldDes[arrRecordPACT]->offset = (unsigned short)offsetof(arrRecord, pact);
+    prt->papFldDes[arrRecordPUTF]->size = sizeof(prec->putf);
+    prt->papFldDes[arrRecordPUTF]->offset = (unsigned short)offsetof(arrRecord, putf);
+    prt->papFldDes[arrRecordRPRO]->size = sizeof(prec->rpro);
+    prt->papFldDes[arrRecordRPRO]->offset = (unsigned short)offsetof(arrRecord, rpro);
+    prt->papFldDes[arrRecordASP]->size = sizeof(prec->asp);
+    prt->papFldDes[arrRecordASP]->offset = (unsigned short)offsetof(arrRecord, asp);
+    prt->papFldDes[arrRecordPPN]->size = sizeof(prec->ppn);
+    prt->papFldDes[arrRecordPPN]->offset = (unsigned short)offsetof(arrRecord, ppn);
+    prt->papFldDes[arrRecordPPNR]->size = sizeof(prec->ppnr);
+    prt->papFldDes[arrRecordPPNR]->offset = (unsigned short)offsetof(arrRecord, ppnr);
+    prt->papFldDes[arrRecordSPVT]->size = sizeof(prec->spvt);
+    prt->papFldDes[arrRecordSPVT]->offset = (unsigned short)offsetof(arrRecord, spvt);
+    prt->papFldDes[arrRecordRSET]->size = sizeof(prec->rset);
+    prt->papFldDes[arrRecordRSET]->offset = (unsigned short)offsetof(arrRecord, rset);
+    prt->papFldDes[arrRecordDSET]->size = sizeof(prec->dset);
+    prt->papFldDes[arrRecordDSET]->offset = (unsigned short)offsetof(arrRecord, dset);
+    prt->papFldDes[arrRecordDPVT]->size = sizeof(prec->dpvt);
+    prt->papFldDes[arrRecordDPVT]->offset = (unsigned short)offsetof(arrRecord, dpvt);
+    prt->papFldDes[arrRecordRDES]->size = sizeof(prec->rdes);
+    prt->papFldDes[arrRecordRDES]->offset = (unsigned short)offsetof(arrRecord, rdes);
+    prt->papFldDes[arrRecordLSET]->size = sizeof(prec->lset);
+    prt->papFldDes[arrRecordLSET]->offset = (unsigned short)offsetof(arrRecord, lset);
+    prt->papFldDes[arrRecordPRIO]->size = sizeof(prec->prio);
+    prt->papFldDes[arrRecordPRIO]->offset = (unsigned short)offsetof(arrRecord, prio);
+    prt->papFldDes[arrRecordTPRO]->size = sizeof(prec->tpro);
+    prt->papFldDes[arrRecordTPRO]->offset = (unsigned short)offsetof(arrRecord, tpro);
+    prt->papFldDes[arrRecordBKPT]->size = sizeof(prec->bkpt);
+    prt->papFldDes[arrRecordBKPT]->offset = (unsigned short)offsetof(arrRecord, bkpt);
+    prt->papFldDes[arrRecordUDF]->size = sizeof(prec->udf);
+    prt->papFldDes[arrRecordUDF]->offset = (unsigned short)offsetof(arrRecord, udf);
+    prt->papFldDes[arrRecordUDFS]->size = sizeof(prec->udfs);
+    prt->papFldDes[arrRecordUDFS]->offset = (unsigned short)offsetof(arrRecord, udfs);
+    prt->papFldDes[arrRecordTIME]->size = sizeof(prec->time);
+    prt->papFldDes[arrRecordTIME]->offset = (unsigned short)offsetof(arrRecord, time);
+    prt->papFldDes[arrRecordUTAG]->size = sizeof(prec->utag);
+    prt->papFldDes[arrRecordUTAG]->offset = (unsigned short)offsetof(arrRecord, utag);
+    prt->papFldDes[arrRecordFLNK]->size = sizeof(prec->flnk);
+    prt->papFldDes[arrRecordFLNK]->offset = (unsigned short)offsetof(arrRecord, flnk);
+    prt->papFldDes[arrRecordVAL]->size = sizeof(prec->val);
+    prt->papFldDes[arrRecordVAL]->offset = (unsigned short)offsetof(arrRecord, val);
+    prt->papFldDes[arrRecordNELM]->size = sizeof(prec->nelm);
+    prt->papFldDes[arrRecordNELM]->offset = (unsigned short)offsetof(arrRecord, nelm);
+    prt->papFldDes[arrRecordFTVL]->size = sizeof(prec->ftvl);
+    prt->papFldDes[arrRecordFTVL]->offset = (unsigned short)offsetof(arrRecord, ftvl);
+    prt->papFldDes[arrRecordNORD]->size = sizeof(prec->nord);
+    prt->papFldDes[arrRecordNORD]->offset = (unsigned short)offsetof(arrRecord, nord);
+    prt->papFldDes[arrRecordOFF]->size = sizeof(prec->off);
+    prt->papFldDes[arrRecordOFF]->offset = (unsigned short)offsetof(arrRecord, off);
+    prt->papFldDes[arrRecordBPTR]->size = sizeof(prec->bptr);
+    prt->papFldDes[arrRecordBPTR]->offset = (unsigned short)offsetof(arrRecord, bptr);
+    prt->papFldDes[arrRecordINP]->size = sizeof(prec->inp);
+    prt->papFldDes[arrRecordINP]->offset = (unsigned short)offsetof(arrRecord, inp);
+    prt->papFldDes[arrRecordCLBK]->size = sizeof(prec->clbk);
+    prt->papFldDes[arrRecordCLBK]->offset = (unsigned short)offsetof(arrRecord, clbk);
+    prt->rec_size = sizeof(*prec);
+    return 0;
+}
+epicsExportRegistrar(arrRecordSizeOffset);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* GEN_SIZE_OFFSET */
+
+#endif /* INC_arrRecord_H */
@@ -0,0 +1,318 @@
+/** @file xRecord.h
+ * @brief Declarations for the @ref xRecord "x" record type.
+ *
+ * This header was generated from xRecord.dbd
+ */
+
+#ifndef INC_xRecord_H
+#define INC_xRecord_H
+
+#include "epicsTypes.h"
+#include "link.h"
+#include "epicsMutex.h"
+#include "ellLib.h"
+#include "devSup.h"
+#include "epicsTime.h"
+
+#ifndef xSFX_NUM_CHOICES
+/** @brief Enumerated type from menu xSFX */
+typedef enum {
+    SFX_Before                      /**< @brief State string "Before" */,
+    SFX_After                       /**< @brief State string "After" */,
+    SFX_None                        /**< @brief State string "None" */
+} xSFX;
+/** @brief Number of states defined for menu xSFX */
+#define xSFX_NUM_CHOICES 3
+#endif
+
+/** @brief Declaration of x record type. */
+typedef struct xRecord {
+    char                name[61];   /**< @brief Record Name */
+    char                desc[41];   /**< @brief Descriptor */
+    char                asg[29];    /**< @brief Access Security Group */
+    epicsEnum16         scan;       /**< @brief Scan Mechanism */
+    epicsEnum16         pini;       /**< @brief Process at iocInit */
+    epicsInt16          phas;       /**< @brief Scan Phase */
+    char                evnt[40];   /**< @brief Event Name */
+    epicsInt16          tse;        /**< @brief Time Stamp Event */
+    DBLINK              tsel;       /**< @brief Time Stamp Link */
+    epicsEnum16         dtyp;       /**< @brief Device Type */
+    epicsInt16          disv;       /**< @brief Disable Value */
+    epicsInt16          disa;       /**< @brief Disable */
+    DBLINK              sdis;       /**< @brief Scanning Disable */
+    epicsMutexId        mlok;       /**< @brief Monitor lock */
+    ELLLIST             mlis;       /**< @brief Monitor List */
+    ELLLIST             bklnk;      /**< @brief Backwards link tracking */
+    epicsUInt8          disp;       /**< @brief Disable putField */
+    epicsUInt8          proc;       /**< @brief Force Processing */
+    epicsEnum16         stat;       /**< @brief Alarm Status */
+    epicsEnum16         sevr;       /**< @brief Alarm Severity */
+    char                amsg[40];   /**< @brief Alarm Message */
+    epicsEnum16         nsta;       /**< @brief New Alarm Status */
+    epicsEnum16         nsev;       /**< @brief New Alarm Severity */
+    char                namsg[40];  /**< @brief New Alarm Message */
+    epicsEnum16         acks;       /**< @brief Alarm Ack Severity */
+    epicsEnum16         ackt;       /**< @brief Alarm Ack Transient */
+    epicsEnum16         diss;       /**< @brief Disable Alarm Sevrty */
+    epicsUInt8          lcnt;       /**< @brief Lock Count */
+    epicsUInt8          pact;       /**< @brief Record active */
+    epicsUInt8          putf;       /**< @brief dbPutField process */
+    epicsUInt8          rpro;       /**< @brief Reprocess  */
+    struct asgMember    *asp;       /**< @brief Access Security Pvt */
+    struct processNotify *ppn;      /**< @brief pprocessNotify */
+    struct processNotifyRecord *ppnr; /**< @brief pprocessNotifyRecord */
+    struct scan_element *spvt;      /**< @brief Scan Private */
+    struct typed_rset   *rset;      /**< @brief Address of RSET */
+    unambiguous_dset    *dset;      /**< @brief DSET address */
+    void                *dpvt;      /**< @brief Device Private */
+    struct dbRecordType *rdes;      /**< @brief Address of dbRecordType */
+    struct lockRecord   *lset;      /**< @brief Lock Set */
+    epicsEnum16         prio;       /**< @brief Scheduling Priority */
+    epicsUInt8          tpro;       /**< @brief Trace Processing */
+    epicsUInt8          bkpt;       /**< @brief Break Point */
+    epicsUInt8          udf;        /**< @brief Undefined */
+    epicsEnum16         udfs;       /**< @brief Undefined Alarm Sevrty */
+    epicsTimeStamp      time;       /**< @brief Time */
+    epicsUInt64         utag;       /**< @brief Time Tag */
+    DBLINK              flnk;       /**< @brief Forward Process Link */
+    epicsInt32          val;        /**< @brief Value */
+    epicsInt8           c8;         /**< @brief Char */
+    epicsUInt8          u8;         /**< @brief Byte */
+    epicsInt16          i16;        /**< @brief Short */
+    epicsUInt16         u16;        /**< @brief UShort */
+    epicsInt32          i32;        /**< @brief Integer */
+    epicsUInt32         u32;        /**< @brief Unsigned */
+    epicsInt64          i64;        /**< @brief Long */
+    epicsUInt64         u64;        /**< @brief ULong */
+    epicsFloat32        f32;        /**< @brief Float */
+    epicsFloat64        f64;        /**< @brief Double */
+    DBLINK              lnk;        /**< @brief Link */
+    DBLINK              inp;        /**< @brief Input Link */
+    void (*clbk)(struct xRecord*);  /**< @brief Processing callback */
+    epicsFloat64        otst;       /**< @brief dbGet() options test */
+    epicsEnum16         sfx;        /**< @brief Special effects */
+} xRecord;
+
+typedef enum {
+	xRecordNAME = 0,
+	xRecordDESC = 1,
+	xRecordASG = 2,
+	xRecordSCAN = 3,
+	xRecordPINI = 4,
+	xRecordPHAS = 5,
+	xRecordEVNT = 6,
+	xRecordTSE = 7,
+	xRecordTSEL = 8,
+	xRecordDTYP = 9,
+	xRecordDISV = 10,
+	xRecordDISA = 11,
+	xRecordSDIS = 12,
+	xRecordMLOK = 13,
+	xRecordMLIS = 14,
+	xRecordBKLNK = 15,
+	xRecordDISP = 16,
+	xRecordPROC = 17,
+	xRecordSTAT = 18,
+	xRecordSEVR = 19,
+	xRecordAMSG = 20,
+	xRecordNSTA = 21,
+	xRecordNSEV = 22,
+	xRecordNAMSG = 23,
+	xRecordACKS = 24,
+	xRecordACKT = 25,
+	xRecordDISS = 26,
+	xRecordLCNT = 27,
+	xRecordPACT = 28,
+	xRecordPUTF = 29,
+	xRecordRPRO = 30,
+	xRecordASP = 31,
+	xRecordPPN = 32,
+	xRecordPPNR = 33,
+	xRecordSPVT = 34,
+	xRecordRSET = 35,
+	xRecordDSET = 36,
+	xRecordDPVT = 37,
+	xRecordRDES = 38,
+	xRecordLSET = 39,
+	xRecordPRIO = 40,
+	xRecordTPRO = 41,
+	xRecordBKPT = 42,
+	xRecordUDF = 43,
+	xRecordUDFS = 44,
+	xRecordTIME = 45,
+	xRecordUTAG = 46,
+	xRecordFLNK = 47,
+	xRecordVAL = 48,
+	xRecordC8 = 49,
+	xRecordU8 = 50,
+	xRecordI16 = 51,
+	xRecordU16 = 52,
+	xRecordI32 = 53,
+	xRecordU32 = 54,
+	xRecordI64 = 55,
+	xRecordU64 = 56,
+	xRecordF32 = 57,
+	xRecordF64 = 58,
+	xRecordLNK = 59,
+	xRecordINP = 60,
+	xRecordCLBK = 61,
+	xRecordOTST = 62,
+	xRecordSFX = 63
+} xFieldIndex;
+
+#ifdef GEN_SIZE_OFFSET
+
+#include <epicsExport.h>
+#include <cantProceed.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+static int xRecordSizeOffset(dbRecordType *prt)
+{
+    xRecord *prec = 0;
+
+    if (prt->no_fields != 64) {
+        cantProceed("IOC build or installation error:\n"
+            "    The xRecord defined in the DBD file has %d fields,\n"
+            "    but the record support code was built with 64.\n",
+            prt->no_fields);
+    }
+    prt->papFldDes[xRecordNAME]->size = sizeof(prec->name);
+    prt->papFldDes[xRecordNAME]->offset = (unsigned short)offsetof(xRecord, name);
+    prt->papFldDes[xRecordDESC]->size = sizeof(prec->desc);
+    prt->papFldDes[xRecordDESC]->offset = (unsigned short)offsetof(xRecord, desc);
+    prt->papFldDes[xRecordASG]->size = sizeof(prec->asg);
+    prt->papFldDes[xRecordASG]->offset = (unsigned short)offsetof(xRecord, asg);
+    prt->papFldDes[xRecordSCAN]->size = sizeof(prec->scan);
+    prt->papFldDes[xRecordSCAN]->offset = (unsigned short)offsetof(xRecord, scan);
+    prt->papFldDes[xRecordPINI]->size = sizeof(prec->pini);
+    prt->papFldDes[xRecordPINI]->offset = (unsigned short)offsetof(xRecord, pini);
+    prt->papFldDes[xRecordPHAS]->size = sizeof(prec->phas);
+    prt->papFldDes[xRecordPHAS]->offset = (unsigned short)offsetof(xRecord, phas);
+    prt->papFldDes[xRecordEVNT]->size = sizeof(prec->evnt);
+    prt->papFldDes[xRecordEVNT]->offset = (unsigned short)offsetof(xRecord, evnt);
+    prt->papFldDes[xRecordTSE]->size = sizeof(prec->tse);
+    prt->papFldDes[xRecordTSE]->offset = (unsigned short)offsetof(xRecord, tse);
+    prt->papFldDes[xRecordTSEL]->size = sizeof(prec->tsel);
+    prt->papFldDes[xRecordTSEL]->offset = (unsigned short)offsetof(xRecord, tsel);
+    prt->papFldDes[xRecordDTYP]->size = sizeof(prec->dtyp);
+    prt->papFldDes[xRecordDTYP]->offset = (unsigned short)offsetof(xRecord, dtyp);
+    prt->papFldDes[xRecordDISV]->size = sizeof(prec->disv);
+    prt->papFldDes[xRecordDISV]->offset = (unsigned short)offsetof(xRecord, disv);
+    prt->papFldDes[xRecordDISA]->size = sizeof(prec->disa);
+    prt->papFldDes[xRecordDISA]->offset = (unsigned short)offsetof(xRecord, disa);
+    prt->papFldDes[xRecordSDIS]->size = sizeof(prec->sdis);
+    prt->papFldDes[xRecordSDIS]->offset = (unsigned short)offsetof(xRecord, sdis);
+    prt->papFldDes[xRecordMLOK]->size = sizeof(prec->mlok);
+    prt->papFldDes[xRecordMLOK]->offset = (unsigned short)offsetof(xRecord, mlok);
+    prt->papFldDes[xRecordMLIS]->size = sizeof(prec->mlis);
+    prt->papFldDes[xRecordMLIS]->offset = (unsigned short)offsetof(xRecord, mlis);
+    prt->papFldDes[xRecordBKLNK]->size = sizeof(prec->bklnk);
+    prt->papFldDes[xRecordBKLNK]->offset = (unsigned short)offsetof(xRecord, bklnk);
+    prt->papFldDes[xRecordDISP]->size = sizeof(prec->disp);
+    prt->papFldDes[xRecordDISP]->offset = (unsigned short)offsetof(xRecord, disp);
+    prt->papFldDes[xRecordPROC]->size = sizeof(prec->proc);
+    prt->papFldDes[xRecordPROC]->offset = (unsigned short)offsetof(xRecord, proc);
+    prt->papFldDes[xRecordSTAT]->size = sizeof(prec->stat);
+    prt->papFldDes[xRecordSTAT]->offset = (unsigned short)offsetof(xRecord, stat);
+    prt->papFldDes[xRecordSEVR]->size = sizeof(prec->sevr);
+    prt->papFldDes[xRecordSEVR]->offset = (unsigned short)offsetof(xRecord, sevr);
+    prt->papFldDes[xRecordAMSG]->size = sizeof(prec->amsg);
+    prt->papFldDes[xRecordAMSG]->offset = (unsigned short)offsetof(xRecord, amsg);
+    prt->papFldDes[xRecordNSTA]->size = sizeof(prec->nsta);
+    prt->papFldDes[xRecordNSTA]->offset = (unsigned short)offsetof(xRecord, nsta);
+    prt->papFldDes[xRecordNSEV]->size = sizeof(prec->nsev);
+    prt->papFldDes[xRecordNSEV]->offset = (unsigned short)offsetof(xRecord, nsev);
+    prt->papFldDes[xRecordNAMSG]->size = sizeof(prec->namsg);
+    prt->papFldDes[xRecordNAMSG]->offset = (unsigned short)offsetof(xRecord, namsg);
+    prt->papFldDes[xRecordACKS]->size = sizeof(prec->acks);
+    prt->papFldDes[xRecordACKS]->offset = (unsigned short)offsetof(xRecord, acks);
+    prt->papFldDes[xRecordACKT]->size = sizeof(prec->ackt);
+    prt->papFldDes[xRecordACKT]->offset = (unsigned short)offsetof(xRecord, ackt);
+    prt->papFldDes[xRecordDISS]->size = sizeof(prec->diss);
+    prt->papFldDes[xRecordDISS]->offset = (unsigned short)offsetof(xRecord, diss);
+    prt->papFldDes[xRecordLCNT]->size = sizeof(prec->lcnt);
+    prt->papFldDes[xRecordLCNT]->offset = (unsigned short)offsetof(xRecord, lcnt);
+    prt->papFldDes[xRecordPACT]->size = sizeof(prec->pact);
+    prt->papFldDes[xRecordPACT]->offset = (unsigned short)offsetof(xRecord, pact);
+    prt->papFldDes[xRecordPUTF]->size = sizeof(prec->putf);
+    prt->papFldDes[xRecordPUTF]->offset = (unsigned short)offsetof(xRecord, putf);
+    prt->papFldDes[xRecordRPRO]->size = sizeof(prec->rpro);
+    prt->papFldDes[xRecordRPRO]->offset = (unsigned short)offsetof(xRecord, rpro);
+    prt->papFldDes[xRecordASP]->size = sizeof(prec->asp);
+    prt->papFldDes[xRecordASP]->offset = (unsigned short)offsetof(xRecord, asp);
+    prt->papFldDes[xRecordPPN]->size = sizeof(prec->ppn);
+    prt->papFldDes[xRecordPPN]->offset = (unsigned short)offsetof(xRecord, ppn);
+    prt->papFldDes[xRecordPPNR]->size = sizeof(prec->ppnr);
+    prt->papFldDes[xRecordPPNR]->offset = (unsigned short)offsetof(xRecord, ppnr);
+    prt->papFldDes[xRecordSPVT]->size = sizeof(prec->spvt);
+    prt->papFldDes[xRecordSPVT]->offset = (unsigned short)offsetof(xRecord, spvt);
+    prt->papFldDes[xRecordRSET]->size = sizeof(prec->rset);
+    prt->papFldDes[xRecordRSET]->offset = (unsigned short)offsetof(xRecord, rset);
+    prt->papFldDes[xRecordDSET]->size = sizeof(prec->dset);
+    prt->papFldDes[xRecordDSET]->offset = (unsigned short)offsetof(xRecord, dset);
+    prt->papFldDes[xRecordDPVT]->size = sizeof(prec->dpvt);
+    prt->papFldDes[xRecordDPVT]->offset = (unsigned short)offsetof(xRecord, dpvt);
+    prt->papFldDes[xRecordRDES]->size = sizeof(prec->rdes);
+    prt->papFldDes[xRecordRDES]->offset = (unsigned short)offsetof(xRecord, rdes);
+    prt->papFldDes[xRecordLSET]->size = sizeof(prec->lset);
+    prt->papFldDes[xRecordLSET]->offset = (unsigned short)offsetof(xRecord, lset);
+    prt->papFldDes[xRecordPRIO]->size = sizeof(prec->prio);
+    prt->papFldDes[xRecordPRIO]->offset = (unsigned short)offsetof(xRecord, prio);
+    prt->papFldDes[xRecordTPRO]->size = sizeof(prec->tpro);
+    prt->papFldDes[xRecordTPRO]->offset = (unsigned short)offsetof(xRecord, tpro);
+    prt->papFldDes[xRecordBKPT]->size = sizeof(prec->bkpt);
+    prt->papFldDes[xRecordBKPT]->offset = (unsigned short)offsetof(xRecord, bkpt);
+    prt->papFldDes[xRecordUDF]->size = sizeof(prec->udf);
+    prt->papFldDes[xRecordUDF]->offset = (unsigned short)offsetof(xRecord, udf);
+    prt->papFldDes[xRecordUDFS]->size = sizeof(prec->udfs);
+    prt->papFldDes[xRecordUDFS]->offset = (unsigned short)offsetof(xRecord, udfs);
+    prt->papFldDes[xRecordTIME]->size = sizeof(prec->time);
+    prt->papFldDes[xRecordTIME]->offset = (unsigned short)offsetof(xRecord, time);
+    prt->papFldDes[xRecordUTAG]->size = sizeof(prec->utag);
+    prt->papFldDes[xRecordUTAG]->offset = (unsigned short)offsetof(xRecord, utag);
+    prt->papFldDes[xRecordFLNK]->size = sizeof(prec->flnk);
+    prt->papFldDes[xRecordFLNK]->offset = (unsigned short)offsetof(xRecord, flnk);
+    prt->papFldDes[xRecordVAL]->size = sizeof(prec->val);
+    prt->papFldDes[xRecordVAL]->offset = (unsigned short)offsetof(xRecord, val);
+    prt->papFldDes[xRecordC8]->size = sizeof(prec->c8);
+    prt->papFldDes[xRecordC8]->offset = (unsigned short)offsetof(xRecord, c8);
+    prt->papFldDes[xRecordU8]->size = sizeof(prec->u8);
+    prt->papFldDes[xRecordU8]->offset = (unsigned short)offsetof(xRecord, u8);
+    prt->papFldDes[xRecordI16]->size = sizeof(prec->i16);
+    prt->papFldDes[xRecordI16]->offset = (unsigned short)offsetof(xRecord, i16);
+    prt->papFldDes[xRecordU16]->size = sizeof(prec->u16);
+    prt->papFldDes[xRecordU16]->offset = (unsigned short)offsetof(xRecord, u16);
+    prt->papFldDes[xRecordI32]->size = sizeof(prec->i32);
+    prt->papFldDes[xRecordI32]->offset = (unsigned short)offsetof(xRecord, i32);
+    prt->papFldDes[xRecordU32]->size = sizeof(prec->u32);
+    prt->papFldDes[xRecordU32]->offset = (unsigned short)offsetof(xRecord, u32);
+    prt->papFldDes[xRecordI64]->size = sizeof(prec->i64);
+    prt->papFldDes[xRecordI64]->offset = (unsigned short)offsetof(xRecord, i64);
+    prt->papFldDes[xRecordU64]->size = sizeof(prec->u64);
+    prt->papFldDes[xRecordU64]->offset = (unsigned short)offsetof(xRecord, u64);
+    prt->papFldDes[xRecordF32]->size = sizeof(prec->f32);
+    prt->papFldDes[xRecordF32]->offset = (unsigned short)offsetof(xRecord, f32);
+    prt->papFldDes[xRecordF64]->size = sizeof(prec->f64);
+    prt->papFldDes[xRecordF64]->offset = (unsigned short)offsetof(xRecord, f64);
+    prt->papFldDes[xRecordLNK]->size = sizeof(prec->lnk);
+    prt->papFldDes[xRecordLNK]->offset = (unsigned short)offsetof(xRecord, lnk);
+    prt->papFldDes[xRecordINP]->size = sizeof(prec->inp);
+    prt->papFldDes[xRecordINP]->offset = (unsigned short)offsetof(xRecord, inp);
+    prt->papFldDes[xRecordCLBK]->size = sizeof(prec->clbk);
+    prt->papFldDes[xRecordCLBK]->offset = (unsigned short)offsetof(xRecord, clbk);
+    prt->papFldDes[xRecordOTST]->size = sizeof(prec->otst);
+    prt->papFldDes[xRecordOTST]->offset = (unsigned short)offsetof(xRecord, otst);
+    prt->papFldDes[xRecordSFX]->size = sizeof(prec->sfx);
+    prt->papFldDes[xRecordSFX]->offset = (unsigned short)offsetof(xRecord, sfx);
+    prt->rec_size = sizeof(*prec);
+    return 0;
+}
+epicsExportRegistrar(xRecordSizeOffset);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* GEN_SIZE_OFFSET */
+
+#endif /* INC_xRecord_H */
@@ -5,26 +5,55 @@
 * EPICS BASE is distributed subject to a Software License Agreement found
 * in file LICENSE that is included with this distribution.
 \*************************************************************************/
+/*
+ * Array conversion throughput, for dbGet() type conversions and for
+ * the host to network byte order conversion done when sending CA
+ * replies.  Rates are given in GB/s of source data.
+ */
 #include "string.h"
 
 #include "cantProceed.h"
-#include "dbAddr.h"
-#include "dbConvert.h"
 #include "dbDefs.h"
 #include "epicsTime.h"
 #include "epicsMath.h"
 #include "epicsAssert.h"
+#include "caerr.h"
+#include "db_access.h"
+#include "net_convert.h"
+
+#include "dbAddr.h"
+#include "db_convert.h"
 
 #include "epicsUnitTest.h"
 #include "testMain.h"
 
+/* Types are the CA (old) DBR types */
+typedef struct {
+    const char *desc;
+    short srcType;
+    short dstType;      /* for dbGet() conversion, or -1 for caNetConvert() */
+} benchCase;
+
+static const benchCase cases[] = {
+    {"dbGet SHORT -> SHORT",   DBR_SHORT,  DBR_SHORT},
+    {"dbGet SHORT -> DOUBLE",  DBR_SHORT,  DBR_DOUBLE},
+    {"dbGet LONG -> DOUBLE",   DBR_LONG,   DBR_DOUBLE},
+    {"dbGet FLOAT -> DOUBLE",  DBR_FLOAT,  DBR_DOUBLE},
+    {"dbGet DOUBLE -> FLOAT",  DBR_DOUBLE, DBR_FLOAT},
+    {"caNetConvert SHORT",     DBR_SHORT,  -1},
+    {"caNetConvert LONG",      DBR_LONG,   -1},
+    {"caNetConvert FLOAT",     DBR_FLOAT,  -1},
+    {"caNetConvert DOUBLE",    DBR_DOUBLE, -1},
+};
+
 typedef struct {
+    const benchCase *bc;
     size_t nelem, niter;
 
-    short *output;
-    short *input;
+    void *output;
+    void *input;
 
-    GETCONVERTFUNC getter;
+    long (*getter)(struct dbAddr *, void *, long, long, long);
 
     DBADDR addr;
 } testData;
@@ -33,38 +62,62 @@ static long runRep(testData *D)
 {
     size_t i;
 
-    for(i=0; i<D->niter; i++) {
-        D->getter(&D->addr, D->output, D->nelem, D->nelem, 0);
+    if(D->getter) {
+        for(i=0; i<D->niter; i++) {
+            D->getter(&D->addr, D->output, D->nelem, D->nelem, 0);
+        }
+    } else {
+        for(i=0; i<D->niter; i++) {
+            if(caNetConvert(D->bc->srcType, D->input, D->output, 1,
+                            D->nelem) != ECA_NORMAL)
+                return -1;
+        }
     }
     return 0;
 }
 
-static void runBench(size_t nelem, size_t niter, size_t nrep)
+static void fillInput(testData *D)
+{
+    size_t i;
+
+    for(i=0; i<D->nelem; i++) {
+        switch(D->bc->srcType) {
+        case DBR_SHORT:  ((dbr_short_t*)D->input)[i] = (dbr_short_t)i; break;
+        case DBR_LONG:   ((dbr_long_t*)D->input)[i] = (dbr_long_t)i; break;
+        case DBR_FLOAT:  ((dbr_float_t*)D->input)[i] = (dbr_float_t)i; break;
+        case DBR_DOUBLE: ((dbr_double_t*)D->input)[i] = (dbr_double_t)i; break;
+        default: assert(0);
+        }
+    }
+}
+
+static void runBench(const benchCase *bc, size_t nelem, size_t niter, size_t nrep)
 {
     size_t i;
     testData tdat;
     double *reptimes;
-    testDiag("Using %lu element arrays.",(unsigned long)nelem);
-    testDiag("run %lu reps with %lu iterations each",
-             (unsigned long)nrep, (unsigned long)niter);
+    size_t srcSize = dbr_value_size[bc->srcType];
+    size_t dstSize = bc->dstType < 0 ? srcSize : dbr_value_size[bc->dstType];
 
     reptimes = callocMustSucceed(nrep, sizeof(*reptimes), "runBench");
-    tdat.output = callocMustSucceed(nelem, sizeof(*tdat.output), "runBench");
-    tdat.input = callocMustSucceed(nelem, sizeof(*tdat.input), "runBench");
+    tdat.output = callocMustSucceed(nelem, dstSize, "runBench");
+    tdat.input = callocMustSucceed(nelem, srcSize, "runBench");
 
+    tdat.bc = bc;
     tdat.nelem = nelem;
     tdat.niter = niter;
 
-    tdat.getter = dbGetConvertRoutine[DBF_SHORT][DBF_SHORT];
+    tdat.getter = bc->dstType < 0 ? NULL :
+        dbGetConvertRoutine[dbDBRoldToDBFnew[bc->srcType]]
+                           [dbDBRoldToDBFnew[bc->dstType]];
 
     memset(&tdat.addr, 0, sizeof(tdat.addr));
-    tdat.addr.field_type = DBF_SHORT;
-    tdat.addr.field_size = nelem*sizeof(*tdat.input);
+    tdat.addr.field_type = dbDBRoldToDBFnew[bc->srcType];
+    tdat.addr.field_size = srcSize;
     tdat.addr.no_elements = nelem;
-    tdat.addr.pfield = (void*)tdat.input;
+    tdat.addr.pfield = tdat.input;
 
-    for(i=0; i<nelem; i++)
-        tdat.input[i] = (short)i;
+    fillInput(&tdat);
 
     for(i=0; i<nrep; i++)
     {
@@ -75,8 +128,10 @@ static void runBench(size_t nelem, size_t niter, size_t nrep)
             goto done;
         }
 
-        if(runRep(&tdat))
+        if(runRep(&tdat)) {
+            testAbort("%s conversion failed", bc->desc);
             goto done;
+        }
 
         if(epicsTimeGetCurrent(&stop)!=epicsTimeOK) {
             testAbort("Failed to get timestamp");
@@ -84,11 +139,6 @@ static void runBench(size_t nelem, size_t niter, size_t nrep)
         }
 
         reptimes[i] = epicsTimeDiffInSeconds(&stop, &start);
-
-        testDiag("%lu bytes in %.03f ms.  %.1f MB/s",
-                 (unsigned long)(nelem*niter),
-                 reptimes[i]*1e3,
-                 (nelem*niter)/reptimes[i]/1e6);
     }
 
     {
@@ -99,11 +149,11 @@ static void runBench(size_t nelem, size_t niter, size_t nrep)
         }
 
         mean = sum/nrep;
-        testDiag("Final: %.04f ms +- %.05f ms.  %.1f MB/s  (for %lu elements)",
+        testDiag("%-22s %8lu elements: %.04f ms +- %.05f ms.  %.2f GB/s",
+                 bc->desc, (unsigned long)nelem,
                  mean*1e3,
                  sqrt(sum2/nrep - mean*mean)*1e3,
-                 (nelem*niter)/mean/1e6,
-                 (unsigned long)nelem);
+                 (nelem*niter*srcSize)/mean/1e9);
     }
 
 done:
@@ -114,14 +164,25 @@ done:
 
 MAIN(benchdbConvert)
 {
+    unsigned i;
+
     testPlan(0);
-    runBench(1, 10000000, 10);
-    runBench(2,  5000000, 10);
-    runBench(10, 1000000, 10);
-    runBench(100, 100000, 10);
-    runBench(10000, 1000, 10);
-    runBench(100000, 100, 10);
-    runBench(1000000, 10, 10);
-    runBench(10000000, 1, 10);
+
+    testDiag("Array size scan, SHORT -> SHORT");
+    runBench(&cases[0], 1, 10000000, 10);
+    runBench(&cases[0], 2,  5000000, 10);
+    runBench(&cases[0], 10, 1000000, 10);
+    runBench(&cases[0], 100, 100000, 10);
+    runBench(&cases[0], 10000, 1000, 10);
+    runBench(&cases[0], 100000, 100, 10);
+    runBench(&cases[0], 1000000, 10, 10);
+    runBench(&cases[0], 10000000, 1, 10);
+
+    testDiag("Conversions, cache resident and memory bound arrays");
+    for(i=0; i<NELEMENTS(cases); i++) {
+        runBench(&cases[i], 4096, 2000, 10);
+        runBench(&cases[i], 4000000, 2, 10);
+    }
+
     return testDone();
 }
@@ -0,0 +1,201 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Event queue posting benchmark.
+ *
+ * N threads each post value changes of their own record to
+ * subscriptions which all share one event queue, as happens when
+ * many scan threads update monitors of a single busy CA client.
+ *
+ * As in an IOC the event task runs at a lower priority than the
+ * posting threads.  So with real-time scheduling on a single CPU
+ * few of the posted values will actually be delivered.
+ */
+
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "db_field_log.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define MAXPOSTERS 8
+
+typedef struct {
+    xRecord *prec;
+    dbChannel *chan;
+    dbEventSubscription sub;
+    epicsEventId done;
+
+    /* posting thread */
+    unsigned long nposted;
+
+    /* event task */
+    epicsInt32 lastval;
+    unsigned long ndelivered;
+    unsigned long nbackward;
+} poster;
+
+static poster posters[MAXPOSTERS];
+static int running;
+
+static
+void monitor(void *user_arg, struct dbChannel *chan,
+             int eventsRemaining, struct db_field_log *pfl)
+{
+    poster *p = (poster*)user_arg;
+    epicsInt32 val = pfl->u.v.field.dbf_long;
+
+    if(val <= p->lastval)
+        p->nbackward++;
+    p->lastval = val;
+    p->ndelivered++;
+}
+
+static
+void postThread(void *raw)
+{
+    poster *p = (poster*)raw;
+    dbCommon *prec = (dbCommon*)p->prec;
+
+    while(epicsAtomicGetIntT(&running)) {
+        dbScanLock(prec);
+        p->prec->val++;
+        db_post_events(prec, &p->prec->val, DBE_VALUE);
+        dbScanUnlock(prec);
+        p->nposted++;
+    }
+    epicsEventMustTrigger(p->done);
+}
+
+static
+void runBench(unsigned nthreads, double duration)
+{
+    unsigned i;
+    unsigned long nposted = 0, ndelivered = 0, nbackward = 0, nstale = 0;
+    epicsTimeStamp start, stop;
+    double elapsed;
+
+    for(i=0; i<nthreads; i++) {
+        posters[i].nposted = 0;
+        posters[i].ndelivered = 0;
+        posters[i].nbackward = 0;
+        posters[i].lastval = posters[i].prec->val;
+    }
+
+    epicsAtomicSetIntT(&running, 1);
+    epicsTimeGetCurrent(&start);
+
+    for(i=0; i<nthreads; i++) {
+        epicsThreadMustCreate("poster", epicsThreadPriorityMedium,
+                              epicsThreadGetStackSize(epicsThreadStackSmall),
+                              &postThread, &posters[i]);
+    }
+
+    epicsThreadSleep(duration);
+    epicsAtomicSetIntT(&running, 0);
+
+    for(i=0; i<nthreads; i++)
+        epicsEventMustWait(posters[i].done);
+
+    epicsTimeGetCurrent(&stop);
+    elapsed = epicsTimeDiffInSeconds(&stop, &start);
+
+    /* let the event task drain */
+    epicsThreadSleep(0.5);
+
+    for(i=0; i<nthreads; i++) {
+        nposted += posters[i].nposted;
+        ndelivered += posters[i].ndelivered;
+        nbackward += posters[i].nbackward;
+        if(posters[i].lastval != posters[i].prec->val)
+            nstale++;
+    }
+
+    testDiag("%u thread%s: %.0f posts/s, %.0f delivered/s (%.1f%% delivered)",
+             nthreads, nthreads==1 ? "" : "s",
+             nposted/elapsed, ndelivered/elapsed,
+             nposted ? 100.0*ndelivered/nposted : 0.0);
+
+    testOk(nbackward==0, "%u thread%s: values delivered in order (%lu out of order)",
+           nthreads, nthreads==1 ? "" : "s", nbackward);
+    testOk(nstale==0, "%u thread%s: last values delivered (%lu not)",
+           nthreads, nthreads==1 ? "" : "s", nstale);
+}
+
+MAIN(benchdbEvent)
+{
+    dbEventCtx evctx;
+    unsigned i;
+
+    testPlan(0);
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbStressLock.db", NULL, NULL);
+
+    testIocInitOk();
+
+    evctx = db_init_events();
+    if(!evctx)
+        testAbort("db_init_events fails");
+    if(db_start_events(evctx, "benchEvent", NULL, NULL, epicsThreadPriorityLow))
+        testAbort("db_start_events fails");
+
+    for(i=0; i<MAXPOSTERS; i++) {
+        char name[20];
+        poster *p = &posters[i];
+
+        epicsSnprintf(name, sizeof(name), "rec%02u.VAL", i+1);
+        p->chan = dbChannelCreate(name);
+        if(!p->chan || dbChannelOpen(p->chan))
+            testAbort("can't open %s", name);
+        p->prec = (xRecord*)dbChannelRecord(p->chan);
+        p->done = epicsEventMustCreate(epicsEventEmpty);
+        p->sub = db_add_event(evctx, p->chan, &monitor, p, DBE_VALUE);
+        if(!p->sub)
+            testAbort("db_add_event fails");
+        db_event_enable(p->sub);
+    }
+
+    runBench(1, 1.0);
+    runBench(2, 1.0);
+    runBench(4, 1.0);
+    runBench(8, 1.0);
+
+    for(i=0; i<MAXPOSTERS; i++) {
+        db_cancel_event(posters[i].sub);
+        dbChannelDelete(posters[i].chan);
+        epicsEventDestroy(posters[i].done);
+    }
+    db_close_events(evctx);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+
+    return testDone();
+}
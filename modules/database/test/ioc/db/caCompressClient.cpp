@@ -0,0 +1,188 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of caCompressTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <epicsEvent.h>
+#include <epicsMutex.h>
+#include <epicsGuard.h>
+#include <epicsTime.h>
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+#define NELM 100000
+
+namespace {
+
+struct ca_client_context *contexts[2];
+
+struct arrayPV {
+    const char *name;
+    chtype type;
+    unsigned elemSize;
+};
+
+const arrayPV arrays[] = {
+    {"cmp:char", DBR_CHAR, 1},
+    {"cmp:short", DBR_SHORT, 2},
+    {"cmp:long", DBR_LONG, 4},
+    {"cmp:double", DBR_DOUBLE, 8},
+};
+
+// slowly varying values compress well after the byte shuffle
+template<typename T>
+void fill(void *pbuf, size_t count, int seed)
+{
+    T *p = static_cast<T*>(pbuf);
+    for(size_t i=0; i<count; i++)
+        p[i] = static_cast<T>((i / 16 + seed) % 100);
+}
+
+void fillArray(chtype type, std::vector<char>& buf, size_t count, int seed)
+{
+    switch(type) {
+    case DBR_CHAR: fill<dbr_char_t>(&buf[0], count, seed); break;
+    case DBR_SHORT: fill<dbr_short_t>(&buf[0], count, seed); break;
+    case DBR_LONG: fill<dbr_long_t>(&buf[0], count, seed); break;
+    case DBR_DOUBLE: fill<dbr_double_t>(&buf[0], count, seed); break;
+    }
+}
+
+// Put a whole array, then read it back with an element count which
+// may leave the payload short of a multiple of eight bytes.
+void testPutGet(const arrayPV& pv, chid chan, unsigned long count)
+{
+    std::vector<char> buf(NELM * pv.elemSize), buf2(NELM * pv.elemSize, 0x5a);
+
+    fillArray(pv.type, buf, NELM, 1);
+    testECA(ca_array_put(pv.type, NELM, chan, &buf[0]));
+    testECA(ca_array_get(pv.type, count, chan, &buf2[0]));
+    testECA(ca_pend_io(10.0));
+    testOk(memcmp(&buf[0], &buf2[0], count * pv.elemSize) == 0,
+           "%s read %lu elements", pv.name, count);
+}
+
+struct monitorPvt {
+    epicsMutex lock;
+    epicsEvent event;
+    std::vector<char> last;
+    unsigned count;
+    monitorPvt() : count(0u) {}
+
+    bool waitFor(unsigned n, double timeout)
+    {
+        epicsTime deadline(epicsTime::getCurrent() + timeout);
+        epicsGuard<epicsMutex> G(lock);
+        while(count < n) {
+            double left = deadline - epicsTime::getCurrent();
+            if(left <= 0.0)
+                return false;
+            epicsGuardRelease<epicsMutex> U(G);
+            event.wait(left);
+        }
+        return true;
+    }
+};
+
+extern "C"
+void monitorUpdate(struct event_handler_args args)
+{
+    monitorPvt *pvt = static_cast<monitorPvt*>(args.usr);
+    if(args.status != ECA_NORMAL)
+        return;
+    {
+        epicsGuard<epicsMutex> G(pvt->lock);
+        const char *p = static_cast<const char*>(args.dbr);
+        pvt->last.assign(p, p + args.count);
+        pvt->count++;
+    }
+    pvt->event.signal();
+}
+
+// Large enough for the server to send the update straight from the event
+// queue, unless the client wants it compressed.  The arr record doesn't
+// post monitors, so only the initial update is seen.
+void testSubscription(chid chan)
+{
+    std::vector<char> buf(NELM);
+    monitorPvt pvt;
+    evid sub;
+
+    fillArray(DBR_CHAR, buf, NELM, 1);
+    testECA(ca_create_subscription(DBR_CHAR, NELM, chan, DBE_VALUE,
+                                   monitorUpdate, &pvt, &sub));
+    testECA(ca_flush_io());
+    testOk(pvt.waitFor(1, 5.0), "Initial update");
+    {
+        epicsGuard<epicsMutex> G(pvt.lock);
+        testOk(pvt.last == buf, "Update has the array value");
+    }
+    testECA(ca_clear_subscription(sub));
+}
+
+} // namespace
+
+extern "C"
+void caCompressTest_contextCreate(int idx)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+    contexts[idx] = ca_current_context();
+    ca_detach_context();
+}
+
+extern "C"
+void caCompressTest_contextDestroy(int idx)
+{
+    ca_context_destroy();
+    contexts[idx] = NULL;
+}
+
+extern "C"
+void caCompressTest_client(int idx, int compressing)
+{
+    const size_t narrays = sizeof(arrays) / sizeof(arrays[0]);
+    chid chans[narrays];
+
+    if(ca_attach_context(contexts[idx]) != ECA_NORMAL)
+        testAbort("Failed to attach CA context");
+
+    for(size_t i=0; i<narrays; i++)
+        if(ca_create_channel(arrays[i].name, NULL, NULL, 0, &chans[i]) != ECA_NORMAL)
+            testAbort("Can't create channel %s", arrays[i].name);
+    testECA(ca_pend_io(5.0));
+
+    testPutGet(arrays[0], chans[0], NELM - 1);
+    testPutGet(arrays[1], chans[1], NELM - 3);
+    testPutGet(arrays[2], chans[2], NELM);
+    testPutGet(arrays[3], chans[3], NELM);
+
+    // below any compression threshold
+    {
+        std::vector<dbr_double_t> small(10, -1.0);
+        testECA(ca_array_get(DBR_DOUBLE, 10, chans[3], &small[0]));
+        testECA(ca_pend_io(5.0));
+        testOk(small[0] == 1.0 && small[9] == 1.0,
+               "Short read %g ... %g", small[0], small[9]);
+    }
+
+    testSubscription(chans[0]);
+
+    testDiag("%s client done", compressing ? "compressing" : "plain");
+
+    for(size_t i=0; i<narrays; i++)
+        ca_clear_channel(chans[i]);
+}
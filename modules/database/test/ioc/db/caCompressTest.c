@@ -0,0 +1,217 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of the compression of large CA array responses.
+ *
+ * Checks the byte shuffle and LZ4 codec directly, then starts an IOC
+ * with its CA server listening on the loopback interface and reads
+ * arrays through client contexts with and without compression (see
+ * EPICS_CA_COMPRESSION_THRESHOLD).  The client side is in
+ * caCompressClient.cpp.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "osiSock.h"
+
+#include "caCompress.h"
+
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "rsrv.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+void caCompressTest_contextCreate(int idx);
+void caCompressTest_contextDestroy(int idx);
+void caCompressTest_client(int idx, int compressing);
+
+/* Compress and expand nbytes of elemSize byte elements, expect compressed
+ * if the data must shrink.
+ */
+static
+void testRoundTrip(unsigned elemSize, unsigned nbytes, int compressible)
+{
+    unsigned char *src = malloc(nbytes);
+    unsigned char *dest = malloc(nbytes);
+    unsigned char *out = malloc(nbytes + 1);
+    void *work = malloc(caCompressWorkSize(nbytes));
+    unsigned i, csize;
+
+    if(!src || !dest || !out || !work)
+        testAbort("Out of memory");
+
+    srand(nbytes);
+    for(i=0; i<nbytes; i++) {
+        if(compressible)
+            /* slowly varying values, low bytes first as on little endian */
+            src[i] = i % elemSize ? 0 : (unsigned char)(i / elemSize / 16);
+        else
+            src[i] = (unsigned char)(rand() >> 4);
+    }
+
+    csize = caCompress(src, nbytes, dest, nbytes, elemSize, work);
+    if(compressible) {
+        testOk(csize > 0 && csize < nbytes / 2,
+               "elemSize %u, %u bytes compress to %u",
+               elemSize, nbytes, csize);
+    }
+    else {
+        testOk(csize == 0 || csize <= nbytes,
+               "elemSize %u, %u random bytes compress to %u",
+               elemSize, nbytes, csize);
+    }
+    if(csize) {
+        memset(out, 0xa5, nbytes + 1);
+        testOk(caExpand(dest, csize, out, nbytes, elemSize, work) == 0 &&
+               memcmp(src, out, nbytes) == 0 && out[nbytes] == 0xa5,
+               "round trip of %u bytes", nbytes);
+        /* expanding into the wrong size fails */
+        testOk(caExpand(dest, csize, out, nbytes + 1, elemSize, work) == -1,
+               "expect %u bytes fails", nbytes + 1);
+        testOk(caExpand(dest, csize - 1, out, nbytes, elemSize, work) == -1,
+               "truncated input fails");
+    }
+    else {
+        testSkip(3, "not compressed");
+    }
+
+    free(work);
+    free(out);
+    free(dest);
+    free(src);
+}
+
+static
+void testCodec(void)
+{
+    static const unsigned elemSizes[] = {1, 2, 4, 8};
+    /* multiples of all element sizes, and sizes which leave a remainder */
+    static const unsigned sizes[] = {4096, 100000, 4099, 65543};
+    unsigned i, j;
+
+    testDiag("Byte shuffle and LZ4 round trips");
+
+    for(i=0; i<NELEMENTS(elemSizes); i++) {
+        for(j=0; j<NELEMENTS(sizes); j++)
+            testRoundTrip(elemSizes[i], sizes[j], 1);
+        testRoundTrip(elemSizes[i], 10007, 0);
+    }
+}
+
+static
+void testCorrupt(void)
+{
+    /* 1 literal 'a' then a 4 byte match, offset in the next two bytes */
+    unsigned char badOffset[] = {0x10, 'a', 0x00, 0x00};
+    /* 15 or more literals, but the extra length byte is missing */
+    unsigned char noLength[] = {0xf0};
+    /* 4 literals, but only 2 are present */
+    unsigned char shortLiterals[] = {0x40, 'a', 'b'};
+    /* 15 literals plus 255 + 255 + ..., longer than the output */
+    unsigned char longLength[] = {0xf0, 0xff, 0xff, 0xff, 0x00};
+    /* a valid stream, 5 literals */
+    unsigned char good[] = {0x50, 'a', 'b', 'c', 'd', 'e'};
+    unsigned char out[64], work[64];
+
+    testDiag("Corrupted input is rejected");
+
+    testOk1(caExpand(good, sizeof(good), out, 5, 1, work) == 0 &&
+            memcmp(out, "abcde", 5) == 0);
+    testOk1(caExpand(badOffset, sizeof(badOffset), out, 5, 1, work) == -1);
+    badOffset[2] = 2; /* before the start of the output */
+    testOk1(caExpand(badOffset, sizeof(badOffset), out, 5, 1, work) == -1);
+    badOffset[2] = 1;
+    testOk1(caExpand(badOffset, sizeof(badOffset), out, 5, 1, work) == 0 &&
+            memcmp(out, "aaaaa", 5) == 0);
+    testOk1(caExpand(badOffset, sizeof(badOffset) - 1, out, 5, 1, work) == -1);
+    testOk1(caExpand(noLength, sizeof(noLength), out, 20, 1, work) == -1);
+    testOk1(caExpand(shortLiterals, sizeof(shortLiterals), out, 4, 1, work) == -1);
+    testOk1(caExpand(longLength, sizeof(longLength), out, sizeof(out), 1, work) == -1);
+    testOk1(caExpand(good, sizeof(good), out, 6, 2, work) == -1);
+}
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    epicsSocketDestroy(s);
+    return ntohs(addr.ia.sin_port);
+}
+
+MAIN(caCompressTest)
+{
+    unsigned short serverPort;
+    char port[16], addr[32];
+
+    testPlan(4*5*4 + 9 + 2*25);
+
+    testCodec();
+    testCorrupt();
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsSnprintf(addr, sizeof(addr), "127.0.0.1:%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addr);
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "4000000");
+    testDiag("CA server on %s", addr);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("caCompressTest.db", NULL, NULL);
+    rsrv_register_server();
+
+    /* Once the IOC is running, new client contexts are attached to its
+     * database directly, so these must be created first.  The first
+     * asks for everything larger than 1 KiB to be compressed, the second
+     * for nothing which is sent in this test, so its large subscription
+     * update may still bypass the server's send buffer.
+     */
+    epicsEnvSet("EPICS_CA_COMPRESSION_THRESHOLD", "1024");
+    caCompressTest_contextCreate(0);
+    epicsEnvSet("EPICS_CA_COMPRESSION_THRESHOLD", "100000000");
+    caCompressTest_contextCreate(1);
+
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    testDiag("Compressing client");
+    caCompressTest_client(0, 1);
+    caCompressTest_contextDestroy(0);
+    testDiag("Client with a threshold above the array sizes");
+    caCompressTest_client(1, 0);
+    caCompressTest_contextDestroy(1);
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
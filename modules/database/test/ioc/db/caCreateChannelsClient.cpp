@@ -0,0 +1,181 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of caCreateChannelsTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <epicsAtomic.h>
+#include <epicsThread.h>
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+// more than one chunk of channels created under one lock
+#define NCHAN 600
+#define NBAD 300
+#define NRECORDS 10
+
+namespace {
+
+int nConnected;
+int nWrongUser;
+
+extern "C"
+void connectionChange(struct connection_handler_args args)
+{
+    // the user private is the index of the channel's name
+    const char *name = ca_name(args.chid);
+    unsigned long index = (unsigned long) ca_puser(args.chid);
+    char expect[16];
+
+    if(args.op != CA_OP_CONN_UP)
+        return;
+    sprintf(expect, "cc:%lu", index % NRECORDS);
+    if(strcmp(name, expect) != 0)
+        epicsAtomicIncrIntT(&nWrongUser);
+    epicsAtomicIncrIntT(&nConnected);
+}
+
+void makeNames(std::vector<std::string>& names,
+               std::vector<const char *>& pnames,
+               std::vector<void *>& pusers)
+{
+    char name[16];
+
+    for(size_t i=0; i<names.size(); i++) {
+        sprintf(name, "cc:%u", unsigned(i % NRECORDS));
+        names[i] = name;
+        pnames[i] = names[i].c_str();
+        pusers[i] = (void *) i;
+    }
+}
+
+unsigned clearAll(std::vector<chid>& ids)
+{
+    unsigned nfail = 0;
+
+    for(size_t i=0; i<ids.size(); i++) {
+        if(ids[i] && ca_clear_channel(ids[i]) != ECA_NORMAL)
+            nfail++;
+    }
+    return nfail;
+}
+
+void testArguments(void)
+{
+    const char *name = "cc:0";
+    chid id;
+
+    testDiag("Invalid arguments");
+
+    testOk(ca_create_channels(0, NULL, NULL, NULL, 0, NULL) == ECA_NORMAL,
+           "No channels");
+    testOk(ca_create_channels(1, NULL, NULL, NULL, 0, &id) == ECA_BADSTR,
+           "No names");
+    testOk(ca_create_channels(1, &name, NULL, NULL, 0, NULL) == ECA_BADCHID,
+           "No channel ids");
+}
+
+// without a connection callback ca_pend_io() waits for them
+void testPendIO(void)
+{
+    std::vector<std::string> names(NCHAN);
+    std::vector<const char *> pnames(NCHAN);
+    std::vector<void *> pusers(NCHAN);
+    std::vector<chid> ids(NCHAN, (chid) 0);
+    unsigned nnull = 0, nconn = 0, nuser = 0;
+
+    testDiag("Create %u channels, one with an empty name", NCHAN);
+
+    makeNames(names, pnames, pusers);
+    pnames[NBAD] = "";
+
+    testOk1(ca_create_channels(NCHAN, &pnames[0], NULL, &pusers[0],
+                               CA_PRIORITY_DEFAULT, &ids[0]) == ECA_BADSTR);
+    for(size_t i=0; i<NCHAN; i++)
+        if(!ids[i])
+            nnull++;
+    testOk(nnull == 1 && !ids[NBAD], "Only the bad channel is NULL (%u)",
+           nnull);
+
+    testECA(ca_pend_io(10.0));
+    for(size_t i=0; i<NCHAN; i++) {
+        if(!ids[i])
+            continue;
+        if(ca_state(ids[i]) == cs_conn)
+            nconn++;
+        if(ca_puser(ids[i]) != pusers[i])
+            nuser++;
+    }
+    testOk(nconn == NCHAN - 1, "%u of %u connected", nconn, NCHAN - 1);
+    testOk(nuser == 0, "%u have the wrong user private", nuser);
+
+    dbr_long_t first = -1, last = -1;
+    testECA(ca_get(DBR_LONG, ids[7], &first));
+    testECA(ca_get(DBR_LONG, ids[NCHAN - 1], &last));
+    testECA(ca_pend_io(5.0));
+    testOk(first == 70 && last == 90, "Read %ld and %ld",
+           (long) first, (long) last);
+
+    testOk(clearAll(ids) == 0, "Channels cleared");
+}
+
+void testCallbacks(void)
+{
+    std::vector<std::string> names(NCHAN);
+    std::vector<const char *> pnames(NCHAN);
+    std::vector<void *> pusers(NCHAN);
+    std::vector<chid> ids(NCHAN, (chid) 0);
+
+    testDiag("Create %u channels with a connection callback", NCHAN);
+
+    makeNames(names, pnames, pusers);
+
+    testOk1(ca_create_channels(NCHAN, &pnames[0], connectionChange,
+                               &pusers[0], 10, &ids[0]) == ECA_NORMAL);
+    testECA(ca_flush_io());
+    for(unsigned i=0; i<100 && epicsAtomicGetIntT(&nConnected) < NCHAN; i++)
+        epicsThreadSleep(0.1);
+    testOk(epicsAtomicGetIntT(&nConnected) == NCHAN, "%d of %u connected",
+           epicsAtomicGetIntT(&nConnected), NCHAN);
+    testOk(epicsAtomicGetIntT(&nWrongUser) == 0,
+           "%d have the wrong user private", epicsAtomicGetIntT(&nWrongUser));
+
+    testOk(clearAll(ids) == 0, "Channels cleared");
+}
+
+} // namespace
+
+extern "C"
+void caCreateChannelsTest_contextCreate(void)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+}
+
+extern "C"
+void caCreateChannelsTest_contextDestroy(void)
+{
+    ca_context_destroy();
+}
+
+extern "C"
+void caCreateChannelsTest_client(void)
+{
+    testArguments();
+    testPendIO();
+    testCallbacks();
+}
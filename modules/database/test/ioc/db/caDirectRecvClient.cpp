@@ -0,0 +1,220 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of caDirectRecvTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <epicsEvent.h>
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+// several times the size of a receive buffer
+#define NELM 100000
+// guard elements after the requested count
+#define NGUARD 8
+
+namespace {
+
+struct arrayPV {
+    const char *name;
+    chtype type;
+    unsigned elemSize;
+};
+
+const arrayPV arrays[] = {
+    {"dr:char", DBR_CHAR, 1},
+    {"dr:short", DBR_SHORT, 2},
+    {"dr:long", DBR_LONG, 4},
+    {"dr:float", DBR_FLOAT, 4},
+    {"dr:double", DBR_DOUBLE, 8},
+};
+const size_t narrays = sizeof(arrays) / sizeof(arrays[0]);
+
+// every element differs from its neighbours, so misplaced or
+// unswapped bytes show up
+template<typename T>
+void fill(void *pbuf, size_t count, int seed)
+{
+    T *p = static_cast<T*>(pbuf);
+    for(size_t i=0; i<count; i++)
+        p[i] = static_cast<T>((i * 7 + seed) % 120 + 1);
+}
+
+void fillArray(chtype type, std::vector<char>& buf, size_t count, int seed)
+{
+    switch(type) {
+    case DBR_CHAR: fill<dbr_char_t>(&buf[0], count, seed); break;
+    case DBR_SHORT: fill<dbr_short_t>(&buf[0], count, seed); break;
+    case DBR_LONG: fill<dbr_long_t>(&buf[0], count, seed); break;
+    case DBR_FLOAT: fill<dbr_float_t>(&buf[0], count, seed); break;
+    case DBR_DOUBLE: fill<dbr_double_t>(&buf[0], count, seed); break;
+    }
+}
+
+bool untouched(const std::vector<char>& buf, size_t from)
+{
+    for(size_t i=from; i<buf.size(); i++)
+        if(buf[i] != 0x5a)
+            return false;
+    return true;
+}
+
+// An odd element count leaves the payload padded, and the padding must
+// not be written past the end of the requested elements.
+void testGet(const arrayPV& pv, chid chan, int seed)
+{
+    const size_t count = NELM - 1;
+    std::vector<char> buf(NELM * pv.elemSize);
+    std::vector<char> buf2((NELM + NGUARD) * pv.elemSize, 0x5a);
+
+    fillArray(pv.type, buf, NELM, seed);
+    testECA(ca_array_put(pv.type, NELM, chan, &buf[0]));
+    testECA(ca_array_get(pv.type, count, chan, &buf2[0]));
+    testECA(ca_pend_io(10.0));
+    testOk(memcmp(&buf[0], &buf2[0], count * pv.elemSize) == 0 &&
+           untouched(buf2, count * pv.elemSize),
+           "%s read %u elements", pv.name, unsigned(count));
+}
+
+// a structure with a header ahead of the converted values
+void testTimeGet(chid chan)
+{
+    std::vector<char> buf(NELM * sizeof(dbr_double_t));
+    std::vector<char> buf2(dbr_size_n(DBR_TIME_DOUBLE, NELM), 0x5a);
+    const dbr_double_t *expect = (const dbr_double_t *) &buf[0];
+    const struct dbr_time_double *ptd =
+        (const struct dbr_time_double *) &buf2[0];
+
+    testDiag("Time stamped array");
+
+    fillArray(DBR_DOUBLE, buf, NELM, 5);
+    testECA(ca_array_get(DBR_TIME_DOUBLE, NELM, chan, &buf2[0]));
+    testECA(ca_pend_io(10.0));
+    testOk(memcmp(expect, &ptd->value, buf.size()) == 0 &&
+           ptd->stamp.secPastEpoch != 0u,
+           "values %g ... %g", (&ptd->value)[0], (&ptd->value)[NELM - 1]);
+}
+
+void testSyncGroup(chid *chans)
+{
+    std::vector<char> expect2(NELM * 4), expect4(NELM * 8);
+    std::vector<char> buf2(NELM * 4, 0x5a), buf4(NELM * 8, 0x5a);
+    CA_SYNC_GID gid;
+
+    testDiag("Synchronous group");
+
+    fillArray(DBR_LONG, expect2, NELM, 3);
+    fillArray(DBR_DOUBLE, expect4, NELM, 5);
+    testECA(ca_sg_create(&gid));
+    testECA(ca_sg_array_get(gid, DBR_LONG, NELM, chans[2], &buf2[0]));
+    testECA(ca_sg_array_get(gid, DBR_DOUBLE, NELM, chans[4], &buf4[0]));
+    testECA(ca_sg_block(gid, 10.0));
+    testOk(buf2 == expect2 && buf4 == expect4, "Group read both arrays");
+    testECA(ca_sg_delete(gid));
+}
+
+struct getPvt {
+    epicsEvent done;
+    std::vector<char> value;
+};
+
+extern "C"
+void getDone(struct event_handler_args args)
+{
+    getPvt *pvt = static_cast<getPvt*>(args.usr);
+    if(args.status == ECA_NORMAL) {
+        const char *p = static_cast<const char*>(args.dbr);
+        pvt->value.assign(p, p + dbr_size_n(args.type, args.count));
+    }
+    pvt->done.signal();
+}
+
+// no requester's buffer, so received into the library's
+void testCallbackGet(chid chan)
+{
+    std::vector<char> expect(NELM * 8);
+    getPvt pvt;
+
+    testDiag("Get with a callback");
+
+    fillArray(DBR_DOUBLE, expect, NELM, 5);
+    testECA(ca_array_get_callback(DBR_DOUBLE, NELM, chan, getDone, &pvt));
+    testECA(ca_flush_io());
+    testOk(pvt.done.wait(10.0) && pvt.value == expect, "Callback value");
+}
+
+// The response to a request canceled while it is received is discarded,
+// and the responses after it are still read correctly.
+void testCancel(chid *chans)
+{
+    std::vector<char> expect(NELM * 4);
+    std::vector<char> buf(NELM * 4, 0x5a);
+    std::vector<std::vector<char> > discarded(4,
+        std::vector<char>(NELM * 8, 0x5a));
+    chid chan;
+
+    testDiag("Cancel requests while their responses arrive");
+
+    fillArray(DBR_LONG, expect, NELM, 3);
+    testECA(ca_create_channel("dr:double", NULL, NULL, 0, &chan));
+    testECA(ca_pend_io(5.0));
+    for(size_t i=0; i<discarded.size(); i++) {
+        if(ca_array_get(DBR_DOUBLE, NELM, chan, &discarded[i][0]) != ECA_NORMAL)
+            testAbort("ca_array_get() fails");
+    }
+    testECA(ca_flush_io());
+    testECA(ca_clear_channel(chan));
+    testECA(ca_array_get(DBR_LONG, NELM, chans[2], &buf[0]));
+    testECA(ca_pend_io(10.0));
+    testOk(buf == expect, "Following read intact");
+}
+
+} // namespace
+
+extern "C"
+void caDirectRecvTest_contextCreate(void)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+}
+
+extern "C"
+void caDirectRecvTest_contextDestroy(void)
+{
+    ca_context_destroy();
+}
+
+extern "C"
+void caDirectRecvTest_client(void)
+{
+    chid chans[narrays];
+
+    for(size_t i=0; i<narrays; i++)
+        if(ca_create_channel(arrays[i].name, NULL, NULL, 0, &chans[i]) != ECA_NORMAL)
+            testAbort("Can't create channel %s", arrays[i].name);
+    testECA(ca_pend_io(5.0));
+
+    testDiag("Arrays read into the caller's buffer");
+    for(size_t i=0; i<narrays; i++)
+        testGet(arrays[i], chans[i], int(i) + 1);
+
+    testTimeGet(chans[4]);
+    testSyncGroup(chans);
+    testCallbackGet(chans[4]);
+    testCancel(chans);
+
+    for(size_t i=0; i<narrays; i++)
+        ca_clear_channel(chans[i]);
+}
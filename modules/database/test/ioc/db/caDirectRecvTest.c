@@ -0,0 +1,96 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of the CA client receiving large read responses directly into
+ * the buffer given to ca_array_get() or ca_sg_array_get().
+ *
+ * Starts an IOC with its CA server listening on the loopback interface,
+ * and reads arrays larger than a receive buffer through a client context.
+ * The client side is in caDirectRecvClient.cpp.
+ */
+
+#include <string.h>
+
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "osiSock.h"
+
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "rsrv.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+void caDirectRecvTest_contextCreate(void);
+void caDirectRecvTest_contextDestroy(void);
+void caDirectRecvTest_client(void);
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    epicsSocketDestroy(s);
+    return ntohs(addr.ia.sin_port);
+}
+
+MAIN(caDirectRecvTest)
+{
+    unsigned short serverPort;
+    char port[16], addr[32];
+
+    testPlan(40);
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsSnprintf(addr, sizeof(addr), "127.0.0.1:%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addr);
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "4000000");
+    testDiag("CA server on %s", addr);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("caDirectRecvTest.db", NULL, NULL);
+    rsrv_register_server();
+
+    /* Once the IOC is running, new client contexts are attached to its
+     * database directly, so this one must be created first.
+     */
+    caDirectRecvTest_contextCreate();
+
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    caDirectRecvTest_client();
+
+    caDirectRecvTest_contextDestroy();
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
@@ -0,0 +1,152 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * caNetConvert() converts whole arrays of numeric values in loops
+ * which the compiler may vectorize.  Compare those with converting the
+ * same values one element at a time, for odd lengths, in place, and for
+ * buffers which are not aligned for the element type.
+ */
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsEndian.h"
+#include "db_access.h"
+#include "net_convert.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define MAX_ELEM 260
+#define MAX_SIZE 8
+#define GUARD 16
+#define BUF_SIZE (MAX_ELEM * MAX_SIZE + 2 * GUARD)
+
+static const struct {
+    const char *name;
+    unsigned type;
+    size_t size;
+} cases[] = {
+    {"SHORT", DBR_SHORT, 2},
+    {"ENUM", DBR_ENUM, 2},
+    {"LONG", DBR_LONG, 4},
+    {"FLOAT", DBR_FLOAT, 4},
+    {"DOUBLE", DBR_DOUBLE, 8},
+};
+
+static const unsigned long lengths[] = {
+    1, 2, 3, 5, 7, 15, 16, 17, 31, 33, 63, 65, 127, 255, 257
+};
+
+/* Where caNetConvert() swaps bytes it copies each element with
+ * memcpy(), so the buffers need not be aligned.  Elsewhere it accesses
+ * them as their own type, so only aligned buffers are tested.
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+#  define MAX_OFFSET 8
+#else
+#  define MAX_OFFSET 1
+#endif
+
+static union {
+    double align;
+    unsigned char bytes[BUF_SIZE];
+} src, dst, expect;
+
+/* Distinct bytes, so misplaced ones show up */
+static void fillBytes(unsigned char *p, size_t n, unsigned seed)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        p[i] = (unsigned char) (i * 13 + seed);
+}
+
+static int convertOne(unsigned type, size_t size, int hton,
+                      unsigned long num, size_t soff, size_t doff,
+                      int inPlace)
+{
+    unsigned char *out = inPlace ? src.bytes : dst.bytes;
+    unsigned char *psrc = src.bytes + GUARD + soff;
+    unsigned char *pdst = inPlace ? psrc : dst.bytes + GUARD + doff;
+    unsigned char *pexp = expect.bytes + (pdst - out);
+    unsigned long i;
+
+    fillBytes(src.bytes, BUF_SIZE, (unsigned) (num + soff));
+    fillBytes(dst.bytes, BUF_SIZE, 0x5a);
+
+    /* one element at a time, through aligned buffers */
+    memcpy(expect.bytes, out, BUF_SIZE);
+    for (i = 0; i < num; i++) {
+        union {
+            double align;
+            unsigned char bytes[MAX_SIZE];
+        } in, res;
+
+        memcpy(in.bytes, psrc + i * size, size);
+        caNetConvert(type, in.bytes, res.bytes, hton, 1);
+        memcpy(pexp + i * size, res.bytes, size);
+    }
+
+    caNetConvert(type, psrc, pdst, hton, num);
+
+    return memcmp(out, expect.bytes, BUF_SIZE) != 0;
+}
+
+static void testConvert(size_t c)
+{
+    size_t l, soff, doff;
+    int hton, nbad = 0, ntried = 0;
+
+    for (l = 0; l < NELEMENTS(lengths); l++) {
+        for (hton = 0; hton <= 1; hton++) {
+            for (soff = 0; soff < MAX_OFFSET; soff++) {
+                for (doff = 0; doff < MAX_OFFSET; doff++) {
+                    nbad += convertOne(cases[c].type, cases[c].size, hton,
+                                       lengths[l], soff, doff, 0);
+                    ntried++;
+                }
+                nbad += convertOne(cases[c].type, cases[c].size, hton,
+                                   lengths[l], soff, 0, 1);
+                ntried++;
+            }
+        }
+    }
+    testOk(nbad == 0, "%s arrays, %d of %d conversions differ",
+           cases[c].name, nbad, ntried);
+}
+
+/* Host to network and back again gives the original values */
+static void testRoundTrip(void)
+{
+    size_t c;
+    int nbad = 0;
+
+    for (c = 0; c < NELEMENTS(cases); c++) {
+        unsigned char *p = src.bytes + GUARD + MAX_OFFSET - 1;
+        size_t n = MAX_ELEM * cases[c].size;
+
+        fillBytes(expect.bytes, n, (unsigned) c);
+        memcpy(p, expect.bytes, n);
+        caNetConvert(cases[c].type, p, p, 1, MAX_ELEM);
+        caNetConvert(cases[c].type, p, p, 0, MAX_ELEM);
+        if (memcmp(p, expect.bytes, n))
+            nbad++;
+    }
+    testOk(nbad == 0, "Round trip of all types, %d errors", nbad);
+}
+
+MAIN(caNetConvertTest)
+{
+    size_t c;
+
+    testPlan(6);
+    testDiag("Element offsets 0 to %d", MAX_OFFSET - 1);
+    for (c = 0; c < NELEMENTS(cases); c++)
+        testConvert(c);
+    testRoundTrip();
+    return testDone();
+}
@@ -0,0 +1,95 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of caSearchCacheTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+namespace {
+
+struct ca_client_context *contexts[2];
+
+void attach(int idx)
+{
+    if(ca_attach_context(contexts[idx]) != ECA_NORMAL)
+        testAbort("Failed to attach CA context");
+}
+
+chid create(const char *name)
+{
+    chid chan;
+    if(ca_create_channel(name, NULL, NULL, 0, &chan) != ECA_NORMAL)
+        testAbort("Can't create channel %s", name);
+    return chan;
+}
+
+} // namespace
+
+extern "C"
+void caSearchCacheTest_contextCreate(int idx)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+    contexts[idx] = ca_current_context();
+    ca_detach_context();
+}
+
+// also writes the cache file
+extern "C"
+void caSearchCacheTest_contextDestroy(int idx)
+{
+    attach(idx);
+    ca_context_destroy();
+    contexts[idx] = NULL;
+}
+
+// A hit, an entry at a server without the channel, an entry at an
+// unreachable server, and a miss.  All are found on the IOC.
+extern "C"
+void caSearchCacheTest_stale(void)
+{
+    static const char *names[] = {"sc:a", "sc:b", "sc:c", "sc:d"};
+    const size_t nchans = sizeof(names) / sizeof(names[0]);
+    chid chans[nchans];
+    dbr_long_t val = 0;
+
+    attach(0);
+    for(size_t i=0; i<nchans; i++)
+        chans[i] = create(names[i]);
+    testECA(ca_pend_io(10.0));
+    for(size_t i=0; i<nchans; i++)
+        testOk(ca_state(chans[i]) == cs_conn, "%s connected", names[i]);
+
+    // moved from the fake server's circuit to the IOC's
+    testECA(ca_get(DBR_LONG, chans[1], &val));
+    testECA(ca_pend_io(5.0));
+    testOk(val == 2, "sc:b read %ld", (long) val);
+
+    for(size_t i=0; i<nchans; i++)
+        ca_clear_channel(chans[i]);
+    ca_detach_context();
+}
+
+// Nothing answers the searches, so only the cached channel connects.
+extern "C"
+void caSearchCacheTest_hit(void)
+{
+    attach(1);
+    chid hit = create("sc:a");
+    chid miss = create("sc:d");
+    testOk1(ca_pend_io(2.0) == ECA_TIMEOUT);
+    testOk(ca_state(hit) == cs_conn, "Cached channel connected");
+    testOk(ca_state(miss) == cs_never_conn, "Channel not in the cache isn't");
+    ca_clear_channel(hit);
+    ca_clear_channel(miss);
+    ca_detach_context();
+}
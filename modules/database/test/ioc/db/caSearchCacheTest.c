@@ -0,0 +1,304 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of the CA client's search cache (EPICS_CA_SEARCH_CACHE).
+ *
+ * Starts an IOC with its CA server listening on the loopback interface.
+ * The first client context's cache has one good entry, one at a fake
+ * server which answers CA_PROTO_CREATE_CH_FAIL, and one at a port where
+ * nothing listens.  The second context only has the good entry, and
+ * searches at a UDP socket of this test which never answers.
+ * The client side is in caSearchCacheClient.cpp.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "envDefs.h"
+#include "epicsAtomic.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "osiSock.h"
+
+#include "caProto.h"
+
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "rsrv.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+void caSearchCacheTest_contextCreate(int idx);
+void caSearchCacheTest_contextDestroy(int idx);
+void caSearchCacheTest_stale(void);
+void caSearchCacheTest_hit(void);
+
+static const char *cacheFiles[] = {
+    "caSearchCacheTest0.cache",
+    "caSearchCacheTest1.cache",
+};
+
+/* Bind a socket to an unused loopback port */
+static
+SOCKET bindLoopback(int type, unsigned short *pport)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, type, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    *pport = ntohs(addr.ia.sin_port);
+    return s;
+}
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    unsigned short port;
+
+    epicsSocketDestroy(bindLoopback(SOCK_DGRAM, &port));
+    return port;
+}
+
+static
+int recvAll(SOCKET s, void *pbuf, size_t len)
+{
+    char *p = pbuf;
+
+    while(len) {
+        int n = recv(s, p, (int) len, 0);
+        if(n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* A CA server which has no channels */
+static SOCKET fakeListener;
+static int fakeCreates;
+static int fakeCreatesOther;
+
+static
+void fakeServer(void *unused)
+{
+    SOCKET s = epicsSocketAccept(fakeListener, NULL, NULL);
+    caHdr hdr;
+    char name[64];
+
+    if(s == INVALID_SOCKET)
+        return;
+    while(!recvAll(s, &hdr, sizeof(hdr))) {
+        unsigned postsize = ntohs(hdr.m_postsize);
+
+        /* the client sends no large headers */
+        if(postsize >= sizeof(name) || recvAll(s, name, postsize))
+            break;
+        name[postsize] = '\0';
+        if(ntohs(hdr.m_cmmd) == CA_PROTO_CREATE_CHAN) {
+            caHdr reply;
+
+            memset(&reply, 0, sizeof(reply));
+            reply.m_cmmd = htons(CA_PROTO_CREATE_CH_FAIL);
+            reply.m_cid = hdr.m_cid;
+            if(strcmp(name, "sc:b") == 0)
+                epicsAtomicIncrIntT(&fakeCreates);
+            else
+                epicsAtomicIncrIntT(&fakeCreatesOther);
+            send(s, (char *) &reply, sizeof(reply), 0);
+        }
+    }
+    epicsSocketDestroy(s);
+}
+
+static
+void writeCache(const char *file, const char *contents)
+{
+    FILE *fp = fopen(file, "w");
+
+    if(!fp || fputs(contents, fp) < 0 || fclose(fp))
+        testAbort("Can't write %s", file);
+}
+
+/* Is the channel cached at this address? */
+static
+int cachedAt(const char *file, const char *name, const char *addr)
+{
+    FILE *fp = fopen(file, "r");
+    char line[128], expect[128];
+    int found = 0;
+
+    if(!fp)
+        return 0;
+    epicsSnprintf(expect, sizeof(expect), "%s %s\n", name, addr);
+    while(fgets(line, sizeof(line), fp))
+        if(strcmp(line, expect) == 0)
+            found = 1;
+    fclose(fp);
+    return found;
+}
+
+static
+int cached(const char *file, const char *name)
+{
+    FILE *fp = fopen(file, "r");
+    char line[128];
+    size_t len = strlen(name);
+    int found = 0;
+
+    if(!fp)
+        return 0;
+    while(fgets(line, sizeof(line), fp))
+        if(strncmp(line, name, len) == 0 && line[len] == ' ')
+            found = 1;
+    fclose(fp);
+    return found;
+}
+
+/* Read the search requests sent to the socket until it's quiet */
+static
+void readSearches(SOCKET s, int *pfoundA, int *pfoundD)
+{
+    while(1) {
+        char buf[MAX_UDP_RECV];
+        struct timeval timeout;
+        fd_set fds;
+        int n, off = 0;
+
+        timeout.tv_sec = 1;
+        timeout.tv_usec = 0;
+        FD_ZERO(&fds);
+        FD_SET(s, &fds);
+        if(select((int) s + 1, &fds, NULL, NULL, &timeout) <= 0)
+            break;
+        n = recv(s, buf, sizeof(buf), 0);
+        if(n <= 0)
+            break;
+        while(off + (int) sizeof(caHdr) <= n) {
+            const caHdr *phdr = (const caHdr *) &buf[off];
+            unsigned postsize = ntohs(phdr->m_postsize);
+            const char *name = (const char *) (phdr + 1);
+
+            if(off + (int) sizeof(caHdr) + (int) postsize > n)
+                break;
+            if(ntohs(phdr->m_cmmd) == CA_PROTO_SEARCH && postsize) {
+                if(strcmp(name, "sc:a") == 0)
+                    *pfoundA = 1;
+                else if(strcmp(name, "sc:d") == 0)
+                    *pfoundD = 1;
+            }
+            off += sizeof(caHdr) + postsize;
+        }
+    }
+}
+
+MAIN(caSearchCacheTest)
+{
+    unsigned short serverPort, fakePort, deadPort;
+    char port[16], addr[32], server[32], cache[256];
+    SOCKET searchSock;
+    int foundA = 0, foundD = 0;
+
+    testPlan(20);
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsSnprintf(addr, sizeof(addr), "127.0.0.1:%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addr);
+    testDiag("CA server on %s", addr);
+    epicsSnprintf(server, sizeof(server), "127.0.0.1:%u", serverPort);
+
+    fakeListener = bindLoopback(SOCK_STREAM, &fakePort);
+    if(listen(fakeListener, 2))
+        testAbort("Can't listen");
+    epicsThreadMustCreate("fakeServer", epicsThreadPriorityMedium,
+                          epicsThreadGetStackSize(epicsThreadStackSmall),
+                          fakeServer, NULL);
+
+    /* nothing accepts TCP connections on this port, and search
+     * requests sent to it are read, but never answered */
+    searchSock = bindLoopback(SOCK_DGRAM, &deadPort);
+
+    epicsSnprintf(cache, sizeof(cache),
+                  "# EPICS CA search cache, channel server\n"
+                  "sc:a 127.0.0.1:%u\n"
+                  "sc:b 127.0.0.1:%u\n"
+                  "sc:c 127.0.0.1:%u\n",
+                  serverPort, fakePort, deadPort);
+    writeCache(cacheFiles[0], cache);
+    epicsSnprintf(cache, sizeof(cache),
+                  "sc:a 127.0.0.1:%u\n", serverPort);
+    writeCache(cacheFiles[1], cache);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("caSearchCacheTest.db", NULL, NULL);
+    rsrv_register_server();
+
+    /* Once the IOC is running, new client contexts are attached to its
+     * database directly, so these must be created first.  The cache is
+     * loaded when a context is created.
+     */
+    epicsEnvSet("EPICS_CA_SEARCH_CACHE", cacheFiles[0]);
+    caSearchCacheTest_contextCreate(0);
+    epicsEnvSet("EPICS_CA_SEARCH_CACHE", cacheFiles[1]);
+    caSearchCacheTest_contextCreate(1);
+
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    testDiag("Stale entries are searched for");
+    caSearchCacheTest_stale();
+    testOk(epicsAtomicGetIntT(&fakeCreates) == 1 &&
+           epicsAtomicGetIntT(&fakeCreatesOther) == 0,
+           "Fake server asked for sc:b once");
+    caSearchCacheTest_contextDestroy(0);
+    testOk1(cachedAt(cacheFiles[0], "sc:a", server));
+    testOk1(cachedAt(cacheFiles[0], "sc:b", server));
+    testOk1(cachedAt(cacheFiles[0], "sc:c", server));
+    testOk1(cachedAt(cacheFiles[0], "sc:d", server));
+
+    /* the search address list is read when the first channel is created */
+    epicsSnprintf(addr, sizeof(addr), "127.0.0.1:%u", deadPort);
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addr);
+
+    testDiag("Cached channels connect without a search reply");
+    caSearchCacheTest_hit();
+    readSearches(searchSock, &foundA, &foundD);
+    testOk(foundA, "Cached channel was searched for all the same");
+    testOk(foundD, "Channel not in the cache was searched for");
+    caSearchCacheTest_contextDestroy(1);
+    testOk1(cachedAt(cacheFiles[1], "sc:a", server));
+    testOk1(!cached(cacheFiles[1], "sc:d"));
+
+    epicsSocketDestroy(searchSock);
+    remove(cacheFiles[0]);
+    remove(cacheFiles[1]);
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
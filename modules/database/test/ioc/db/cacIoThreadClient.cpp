@@ -0,0 +1,191 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of cacIoThreadTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include <stdio.h>
+
+#include <vector>
+
+#include <epicsEvent.h>
+#include <epicsMutex.h>
+#include <epicsGuard.h>
+#include <epicsThread.h>
+#include <epicsTime.h>
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+#define NCIRCUITS 4
+#define NWAVE 200000
+#define NPUTS 2000
+
+namespace {
+
+struct monitorPvt {
+    epicsMutex lock;
+    epicsEvent event;
+    double delay;
+    unsigned count;
+    long last;
+    monitorPvt() : delay(0.0), count(0u), last(-1) {}
+
+    // wait for the update with this value
+    bool waitFor(long value, double timeout)
+    {
+        epicsTime deadline(epicsTime::getCurrent() + timeout);
+        epicsGuard<epicsMutex> G(lock);
+        while(last != value) {
+            double left = deadline - epicsTime::getCurrent();
+            if(left <= 0.0)
+                return false;
+            epicsGuardRelease<epicsMutex> U(G);
+            event.wait(left);
+        }
+        return true;
+    }
+};
+
+extern "C"
+void monitorUpdate(struct event_handler_args args)
+{
+    monitorPvt *pvt = static_cast<monitorPvt*>(args.usr);
+    if(args.status != ECA_NORMAL)
+        return;
+    {
+        epicsGuard<epicsMutex> G(pvt->lock);
+        pvt->last = *static_cast<const dbr_long_t*>(args.dbr);
+        pvt->count++;
+    }
+    pvt->event.signal();
+    if(pvt->delay > 0.0)
+        epicsThreadSleep(pvt->delay);
+}
+
+// The subscription request is queued before the circuit connects, so
+// it is sent only if the dispatch thread asks the I/O thread to do so.
+void testSubscribeBeforeConnect(chid *pchan)
+{
+    monitorPvt pvt;
+    evid sub;
+
+    testDiag("Subscribe before the channel connects");
+
+    testECA(ca_create_channel("io:val", NULL, NULL, 0, pchan));
+    testECA(ca_create_subscription(DBR_LONG, 1, *pchan, DBE_VALUE,
+                                   monitorUpdate, &pvt, &sub));
+    testECA(ca_flush_io());
+    testOk(pvt.waitFor(42, 5.0), "Initial update received");
+    testECA(ca_clear_subscription(sub));
+}
+
+// channels of different priorities have their own circuits
+void testCircuits(chid *chans)
+{
+    testDiag("Circuits spread over the I/O threads");
+
+    for(unsigned i=1; i<NCIRCUITS; i++)
+        testECA(ca_create_channel("io:val", NULL, NULL, i*10, &chans[i]));
+    testECA(ca_pend_io(5.0));
+    testOk(ca_get_ioc_connection_count() == NCIRCUITS,
+           "%u circuits (expect %u)", ca_get_ioc_connection_count(),
+           NCIRCUITS);
+
+    std::vector<dbr_long_t> vals(NCIRCUITS, 0);
+    for(unsigned i=0; i<NCIRCUITS; i++)
+        testECA(ca_get(DBR_LONG, chans[i], &vals[i]));
+    testECA(ca_pend_io(5.0));
+    for(unsigned i=0; i<NCIRCUITS; i++)
+        testOk(vals[i] == 42, "Circuit %u read %ld", i, (long)vals[i]);
+}
+
+// larger than the socket buffers, so the sends are resumed later
+void testLargeArray(void)
+{
+    chid wave;
+
+    testDiag("Large array put and get");
+
+    testECA(ca_create_channel("io:wave", NULL, NULL, 0, &wave));
+    testECA(ca_pend_io(5.0));
+
+    std::vector<dbr_double_t> buf(NWAVE), buf2(NWAVE, -1.0);
+    for(size_t i=0; i<NWAVE; i++)
+        buf[i] = i * 0.5;
+
+    testECA(ca_array_put(DBR_DOUBLE, NWAVE, wave, &buf[0]));
+    testECA(ca_array_get(DBR_DOUBLE, NWAVE, wave, &buf2[0]));
+    testECA(ca_pend_io(10.0));
+
+    size_t bad = 0;
+    for(size_t i=0; i<NWAVE; i++)
+        if(buf[i] != buf2[i])
+            bad++;
+    testOk(bad == 0, "%u of %u elements differ", (unsigned)bad, NWAVE);
+
+    testECA(ca_clear_channel(wave));
+}
+
+// A slow subscriber falls behind, so the client switches the server's
+// event flow control on, and must switch it off again to see the end.
+void testFlowControl(chid *chans)
+{
+    monitorPvt pvt;
+    evid sub;
+
+    testDiag("Flow control of a slow subscriber");
+
+    pvt.delay = 0.001;
+    testECA(ca_create_subscription(DBR_LONG, 1, chans[1], DBE_VALUE,
+                                   monitorUpdate, &pvt, &sub));
+    testECA(ca_flush_io());
+    testOk(pvt.waitFor(42, 5.0), "Initial update received");
+
+    for(dbr_long_t i=1; i<=NPUTS; i++) {
+        if(ca_put(DBR_LONG, chans[2], &i) != ECA_NORMAL)
+            break;
+    }
+    testECA(ca_flush_io());
+
+    bool ok = pvt.waitFor(NPUTS, 20.0);
+    testOk(ok, "Last update received (%u updates, last %ld)",
+           pvt.count, pvt.last);
+    testECA(ca_clear_subscription(sub));
+}
+
+} // namespace
+
+extern "C"
+void cacIoThreadTest_contextCreate(void)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+}
+
+extern "C"
+void cacIoThreadTest_contextDestroy(void)
+{
+    ca_context_destroy();
+}
+
+extern "C"
+void cacIoThreadTest_client(void)
+{
+    chid chans[NCIRCUITS];
+
+    testSubscribeBeforeConnect(&chans[0]);
+    testCircuits(chans);
+    testLargeArray();
+    testFlowControl(chans);
+
+    for(unsigned i=0; i<NCIRCUITS; i++)
+        testECA(ca_clear_channel(chans[i]));
+}
@@ -20,6 +20,7 @@
 
 #include "callback.h"
 #include "cantProceed.h"
+#include "epicsAtomic.h"
 #include "epicsThread.h"
 #include "epicsEvent.h"
 #include "epicsTime.h"
@@ -37,6 +38,10 @@
  * the immediate callbacks, and the actual delay of the delayed callback.
  *
  * Slow callbacks no longer fail the test, they just emit a diagnostic.
+ *
+ * A second test blocks all callback threads of one priority, queues a
+ * burst of requests larger than the queue size, and checks that the
+ * queues grew to hold them instead of overflowing.
  */
 
 #define NCALLBACKS 169
@@ -96,6 +101,98 @@ static void printStats(double *stats, const char* tag) {
             sqrt(stats[4]*stats[3]-pow(stats[2], 2.0))/stats[4]);
 }
 
+#define NBURSTTHREADS 4
+#define NBURST 20000
+#define NBURSTQUEUE 1000
+
+static epicsEventId burstRelease;
+static int nBlocked, nBurstRun;
+
+static void blockCallback(epicsCallback *pCallback)
+{
+    epicsAtomicIncrIntT(&nBlocked);
+    epicsEventMustWait(burstRelease);
+    /* pass the release on to the next blocked thread */
+    epicsEventMustTrigger(burstRelease);
+}
+
+static void burstCallback(epicsCallback *pCallback)
+{
+    epicsAtomicIncrIntT(&nBurstRun);
+}
+
+static void testBurst(void)
+{
+    epicsCallback blockers[NBURSTTHREADS];
+    epicsCallback counter;
+    callbackQueueStats stats;
+    callbackWorkerStats wstats[NBURSTTHREADS];
+    unsigned long nrun = 0;
+    int i, nthreads, nfail = 0, ngrown = 0, total = 0;
+    double waited;
+
+    testDiag("Burst of %d requests to %d blocked threads",
+        NBURST, NBURSTTHREADS);
+
+    callbackParallelThreads(NBURSTTHREADS, "");
+    callbackSetQueueSize(NBURSTQUEUE);
+    callbackInit();
+    burstRelease = epicsEventMustCreate(epicsEventEmpty);
+
+    /* the threads share the queue size */
+    nthreads = callbackQueueWorkerStatus(priorityHigh, 0, wstats, NBURSTTHREADS);
+    for (i = 0; i < nthreads && i < NBURSTTHREADS; i++)
+        total += wstats[i].size;
+    testOk(total >= NBURSTQUEUE && total < 2 * NBURSTQUEUE,
+        "%d threads have queues for %d requests in total", nthreads, total);
+
+    for (i = 0; i < NBURSTTHREADS; i++) {
+        callbackSetCallback(blockCallback, &blockers[i]);
+        callbackSetPriority(priorityHigh, &blockers[i]);
+        callbackRequest(&blockers[i]);
+    }
+    for (waited = 0.0; epicsAtomicGetIntT(&nBlocked) < NBURSTTHREADS &&
+            waited < 10.0; waited += 0.01)
+        epicsThreadSleep(0.01);
+
+    callbackSetCallback(burstCallback, &counter);
+    callbackSetPriority(priorityHigh, &counter);
+    for (i = 0; i < NBURST; i++) {
+        if (callbackRequest(&counter))
+            nfail++;
+    }
+    testOk(nfail == 0, "%d burst requests failed", nfail);
+
+    testOk1(callbackQueueStatus(0, &stats) == 0 &&
+        stats.numOverflow[priorityHigh] == 0 &&
+        stats.numUsed[priorityHigh] == NBURST);
+    testOk(stats.maxUsed[priorityHigh] >= NBURST / NBURSTTHREADS,
+        "a queue held %d requests", stats.maxUsed[priorityHigh]);
+
+    epicsEventMustTrigger(burstRelease);
+    for (waited = 0.0; epicsAtomicGetIntT(&nBurstRun) < NBURST &&
+            waited < 10.0; waited += 0.01)
+        epicsThreadSleep(0.01);
+    testOk(epicsAtomicGetIntT(&nBurstRun) == NBURST,
+        "%d of %d burst callbacks run", epicsAtomicGetIntT(&nBurstRun), NBURST);
+
+    nthreads = callbackQueueWorkerStatus(priorityHigh, 0, wstats, NBURSTTHREADS);
+    testOk(nthreads == NBURSTTHREADS, "%d high priority threads", nthreads);
+    for (i = 0; i < nthreads && i < NBURSTTHREADS; i++) {
+        testDiag("cbHigh-%d: size %d, grown %d, run %lu, stolen %lu", i,
+            wstats[i].size, wstats[i].numGrown, wstats[i].numRun,
+            wstats[i].numStolen);
+        ngrown += wstats[i].numGrown;
+        nrun += wstats[i].numRun;
+    }
+    testOk(ngrown > 0, "queues grown %d times", ngrown);
+    testOk(nrun == NBURST + NBURSTTHREADS, "%lu callbacks run", nrun);
+
+    callbackStop();
+    callbackCleanup();
+    epicsEventDestroy(burstRelease);
+}
+
 MAIN(callbackParallelTest)
 {
     myPvt *pcbt[NCALLBACKS];
@@ -111,7 +208,7 @@ MAIN(callbackParallelTest)
         for (j = 0; j < 5; j++)
             setupError[i][j] = timeError[i][j] = defaultError[j];
 
-    testPlan(2);
+    testPlan(10);
 
     testDiag("Starting %d parallel callback threads", noCpus);
 
@@ -206,5 +303,7 @@ MAIN(callbackParallelTest)
     callbackStop();
     callbackCleanup();
 
+    testBurst();
+
     return testDone();
 }
@@ -0,0 +1,395 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of the CA server's TCP circuits when they are multiplexed over
+ * a pool of I/O threads (EPICS_CAS_IO_THREADS).
+ *
+ * Starts an IOC with its CA server listening on the loopback interface
+ * and two I/O threads.  One client asks for much more data than it is
+ * willing to read and then stops reading.  Several other clients, some
+ * of which share its I/O thread, must still get their replies.
+ */
+
+#include <string.h>
+
+#include "dbDefs.h"
+#include "envDefs.h"
+#include "epicsEvent.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "osiSock.h"
+
+#define CA_MINOR_PROTOCOL_REVISION 13
+#include "caProto.h"
+#include "caerr.h"
+
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "rsrv.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NCLIENTS 4
+#define NREADS 200
+#define NWAVE 200000
+
+/* CA (not database) request types */
+#define CA_DBR_LONG 5
+#define CA_DBR_DOUBLE 6
+
+static unsigned short serverPort;
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    epicsSocketDestroy(s);
+    return ntohs(addr.ia.sin_port);
+}
+
+static
+SOCKET caConnect(int rcvbuf)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_STREAM, 0);
+    osiSockAddr addr;
+    /* a circuit with replies which take longer than this is stuck */
+#ifdef _WIN32
+    DWORD timeout = 10000;
+#else
+    struct timeval timeout = {10, 0};
+#endif
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    if(rcvbuf)
+        setsockopt(s, SOL_SOCKET, SO_RCVBUF, (char*)&rcvbuf, sizeof(rcvbuf));
+    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (char*)&timeout, sizeof(timeout));
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.ia.sin_port = htons(serverPort);
+    if(connect(s, &addr.sa, sizeof(addr.ia)))
+        testAbort("Can't connect to the CA server");
+    return s;
+}
+
+static
+int sendAll(SOCKET s, const void *buf, unsigned len)
+{
+    const char *pos = buf;
+
+    while(len) {
+        int ret = send(s, pos, len, 0);
+        if(ret <= 0)
+            return -1;
+        pos += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+static
+int recvAll(SOCKET s, void *buf, unsigned len)
+{
+    char *pos = buf;
+
+    while(len) {
+        int ret = recv(s, pos, len, 0);
+        if(ret <= 0)
+            return -1;
+        pos += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+/* Send one message, with a large array header if needed */
+static
+int sendMsg(SOCKET s, unsigned cmmd, unsigned dataType, unsigned count,
+            unsigned cid, unsigned available,
+            const void *payload, unsigned size)
+{
+    char buf[sizeof(caHdr) + 2*sizeof(ca_uint32_t) + 64];
+    caHdr *pmsg = (caHdr*)buf;
+    unsigned len = sizeof(caHdr);
+
+    if(size > 64)
+        testAbort("sendMsg() payload too large");
+    pmsg->m_cmmd = htons(cmmd);
+    pmsg->m_dataType = htons(dataType);
+    pmsg->m_cid = htonl(cid);
+    pmsg->m_available = htonl(available);
+    if(count >= 0xffff) {
+        ca_uint32_t *pLW = (ca_uint32_t*)(pmsg+1);
+        pmsg->m_postsize = htons(0xffff);
+        pmsg->m_count = htons(0);
+        pLW[0] = htonl(size);
+        pLW[1] = htonl(count);
+        len += 2*sizeof(ca_uint32_t);
+    } else {
+        pmsg->m_postsize = htons(size);
+        pmsg->m_count = htons(count);
+    }
+    memcpy(&buf[len], payload, size);
+    return sendAll(s, buf, len + size);
+}
+
+typedef struct {
+    unsigned cmmd, dataType, count, cid, available, size;
+} msgInfo;
+
+/* Receive one message, and as much of its payload as fits in buf */
+static
+int recvMsg(SOCKET s, msgInfo *pinfo, void *buf, unsigned bufSize)
+{
+    caHdr hdr;
+    char discard[4096];
+    unsigned left;
+
+    if(recvAll(s, &hdr, sizeof(hdr)))
+        return -1;
+    pinfo->cmmd = ntohs(hdr.m_cmmd);
+    pinfo->dataType = ntohs(hdr.m_dataType);
+    pinfo->cid = ntohl(hdr.m_cid);
+    pinfo->available = ntohl(hdr.m_available);
+    pinfo->size = ntohs(hdr.m_postsize);
+    pinfo->count = ntohs(hdr.m_count);
+    if(pinfo->size == 0xffff) {
+        ca_uint32_t lw[2];
+        if(recvAll(s, lw, sizeof(lw)))
+            return -1;
+        pinfo->size = ntohl(lw[0]);
+        pinfo->count = ntohl(lw[1]);
+    }
+    left = pinfo->size;
+    if(bufSize > left)
+        bufSize = left;
+    if(recvAll(s, buf, bufSize))
+        return -1;
+    left -= bufSize;
+    while(left) {
+        unsigned n = left < sizeof(discard) ? left : sizeof(discard);
+        if(recvAll(s, discard, n))
+            return -1;
+        left -= n;
+    }
+    return 0;
+}
+
+/* Returns the server's id of the new channel, or -1 */
+static
+long createChannel(SOCKET s, const char *name, unsigned cid)
+{
+    char pname[32];
+    unsigned size = CA_MESSAGE_ALIGN(strlen(name) + 1);
+    msgInfo info;
+
+    memset(pname, 0, sizeof(pname));
+    strcpy(pname, name);
+    if(sendMsg(s, CA_PROTO_VERSION, 0, CA_MINOR_PROTOCOL_REVISION, 0, 0, NULL, 0) ||
+       sendMsg(s, CA_PROTO_CREATE_CHAN, 0, 0, cid, CA_MINOR_PROTOCOL_REVISION,
+               pname, size))
+        return -1;
+    do {
+        if(recvMsg(s, &info, NULL, 0))
+            return -1;
+    } while(info.cmmd != CA_PROTO_CREATE_CHAN);
+    return info.cid == cid ? (long)info.available : -1;
+}
+
+typedef struct {
+    SOCKET s;
+    int ok;
+    unsigned nreads;
+    epicsEventId done;
+} clientPvt;
+
+/* Read io:val repeatedly, and io:wave a few times */
+static
+void clientThread(void *raw)
+{
+    clientPvt *pvt = raw;
+    long sid, wsid;
+    unsigned i;
+
+    sid = createChannel(pvt->s, "io:val", 1);
+    wsid = createChannel(pvt->s, "io:wave", 2);
+    pvt->ok = sid >= 0 && wsid >= 0;
+
+    for(i=0; pvt->ok && i<NREADS; i++) {
+        int wave = i % (NREADS / 4) == 0;
+        epicsInt32 val = 0;
+        msgInfo info;
+
+        if(sendMsg(pvt->s, CA_PROTO_READ_NOTIFY, wave ? CA_DBR_DOUBLE : CA_DBR_LONG,
+                   wave ? NWAVE : 1, wave ? wsid : sid, i, NULL, 0) ||
+           recvMsg(pvt->s, &info, &val, sizeof(val))) {
+            testDiag("Client read %u timed out", i);
+            pvt->ok = 0;
+        }
+        else if(info.cmmd != CA_PROTO_READ_NOTIFY || info.available != i ||
+                info.cid != ECA_NORMAL ||
+                (!wave && ntohl(val) != 42) ||
+                (wave && info.count != NWAVE)) {
+            testDiag("Client read %u has the wrong reply", i);
+            pvt->ok = 0;
+        }
+        else {
+            pvt->nreads++;
+        }
+    }
+
+    epicsEventMustTrigger(pvt->done);
+}
+
+static
+void waitChannels(unsigned expect)
+{
+    unsigned nchan = -1, ncirc, i;
+
+    for(i=0; i<100; i++) {
+        casStatsFetch(&nchan, &ncirc);
+        if(nchan == expect)
+            break;
+        epicsThreadSleep(0.1);
+    }
+    testOk(nchan == expect, "%u channels left (expect %u)", nchan, expect);
+}
+
+static
+void testStalledClient(void)
+{
+    clientPvt clients[NCLIENTS];
+    struct {
+        float lval, hval, toval;
+        ca_uint16_t mask, pad;
+    } mon;
+    SOCKET stalled;
+    long sid;
+    unsigned i;
+
+    testDiag("One client stops reading its replies");
+
+    /* the smallest receive buffer, so that its replies back up soon */
+    stalled = caConnect(1);
+    sid = createChannel(stalled, "io:wave", 1);
+    testOk(sid >= 0, "Stalled client created its channel");
+
+    memset(&mon, 0, sizeof(mon));
+    mon.mask = htons(DBE_VALUE);
+    sendMsg(stalled, CA_PROTO_EVENT_ADD, CA_DBR_DOUBLE, NWAVE, sid, 1000,
+            &mon, sizeof(mon));
+    for(i=0; i<20; i++)
+        sendMsg(stalled, CA_PROTO_READ_NOTIFY, CA_DBR_DOUBLE, NWAVE, sid, i, NULL, 0);
+    /* let the server fill the socket */
+    epicsThreadSleep(0.5);
+
+    for(i=0; i<NCLIENTS; i++) {
+        memset(&clients[i], 0, sizeof(clients[i]));
+        clients[i].s = caConnect(0);
+        clients[i].done = epicsEventMustCreate(epicsEventEmpty);
+        epicsThreadMustCreate("client", epicsThreadPriorityMedium,
+                              epicsThreadGetStackSize(epicsThreadStackSmall),
+                              &clientThread, &clients[i]);
+    }
+
+    /* subscription updates for the stalled client back up too */
+    for(i=0; i<4; i++) {
+        static epicsFloat64 wave[NWAVE];
+        wave[0] = i;
+        testdbPutArrFieldOk("io:wave", DBF_DOUBLE, NWAVE, wave);
+        epicsThreadSleep(0.1);
+    }
+
+    for(i=0; i<NCLIENTS; i++) {
+        epicsEventMustWait(clients[i].done);
+        testOk(clients[i].ok, "Client %u completed %u of %u reads",
+               i, clients[i].nreads, NREADS);
+        epicsEventDestroy(clients[i].done);
+        epicsSocketDestroy(clients[i].s);
+    }
+
+    epicsSocketDestroy(stalled);
+
+    /* all circuits are torn down */
+    waitChannels(0u);
+}
+
+static
+void testIoThreadsShared(void)
+{
+    clientPvt clients[NCLIENTS];
+    unsigned i;
+
+    testDiag("Clients sharing I/O threads");
+
+    for(i=0; i<NCLIENTS; i++) {
+        memset(&clients[i], 0, sizeof(clients[i]));
+        clients[i].s = caConnect(0);
+        clients[i].done = epicsEventMustCreate(epicsEventEmpty);
+    }
+    for(i=0; i<NCLIENTS; i++)
+        epicsThreadMustCreate("client", epicsThreadPriorityMedium,
+                              epicsThreadGetStackSize(epicsThreadStackSmall),
+                              &clientThread, &clients[i]);
+    for(i=0; i<NCLIENTS; i++) {
+        epicsEventMustWait(clients[i].done);
+        testOk(clients[i].ok, "Client %u completed %u of %u reads",
+               i, clients[i].nreads, NREADS);
+        epicsEventDestroy(clients[i].done);
+        epicsSocketDestroy(clients[i].s);
+    }
+    waitChannels(0u);
+}
+
+MAIN(casIoThreadTest)
+{
+    char port[16];
+
+    testPlan(7 + 2*NCLIENTS);
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_IO_THREADS", "2");
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "4000000");
+    testDiag("CA server on 127.0.0.1:%s", port);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("casIoThreadTest.db", NULL, NULL);
+    rsrv_register_server();
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    testIoThreadsShared();
+    testStalledClient();
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
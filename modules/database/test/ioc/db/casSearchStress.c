@@ -0,0 +1,286 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * CA UDP name search stress test.
+ *
+ * Starts an IOC with its CA server listening on the loopback interface,
+ * then replays bursts of search datagrams like those sent by many
+ * clients reconnecting at once.  Most of the names searched for are not
+ * on this IOC.  Reports how many of the searches for names which are on
+ * the IOC were answered, and how fast.
+ */
+
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "envDefs.h"
+#include "epicsEvent.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+
+#define CA_MINOR_PROTOCOL_REVISION 13
+#include "caProto.h"
+
+#include "dbAccess.h"
+#include "dbStaticLib.h"
+#include "iocInit.h"
+#include "rsrv.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NRECORDS 1000
+/* one name in HOSTED is on the IOC */
+#define HOSTED 10
+/* search messages per datagram, as many as fit in MAX_UDP_SEND */
+#define NSEARCH 20
+#define BATCH 64
+
+static unsigned short serverPort;
+
+static
+void createRecords(void)
+{
+    DBENTRY entry;
+    char name[20];
+    unsigned i;
+
+    dbInitEntry(pdbbase, &entry);
+    if(dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for(i=0; i<NRECORDS; i++) {
+        epicsSnprintf(name, sizeof(name), "search%04u", i);
+        if(dbCreateRecord(&entry, name))
+            testAbort("Can't create %s", name);
+    }
+    dbFinishEntry(&entry);
+}
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    epicsSocketDestroy(s);
+    return ntohs(addr.ia.sin_port);
+}
+
+static
+void putHeader(caHdr *pmsg, unsigned cmmd, unsigned postsize,
+               unsigned dataType, unsigned count, unsigned cid,
+               unsigned available)
+{
+    pmsg->m_cmmd = htons(cmmd);
+    pmsg->m_postsize = htons(postsize);
+    pmsg->m_dataType = htons(dataType);
+    pmsg->m_count = htons(count);
+    pmsg->m_cid = htonl(cid);
+    pmsg->m_available = htonl(available);
+}
+
+/* Fill in a datagram of searches for cids first to first+NSEARCH-1.
+ * cid i is for a name on the IOC if i % HOSTED == 0
+ */
+static
+unsigned buildSearch(char *buf, unsigned first)
+{
+    unsigned len = sizeof(caHdr), i;
+
+    putHeader((caHdr*)buf, CA_PROTO_VERSION, 0, 0,
+              CA_MINOR_PROTOCOL_REVISION, first, 0);
+    for(i=first; i<first+NSEARCH; i++) {
+        caHdr *pmsg = (caHdr*)&buf[len];
+        char *pname = (char*)(pmsg+1);
+
+        if(i % HOSTED == 0)
+            epicsSnprintf(pname, 16, "search%04u", (i / HOSTED) % NRECORDS);
+        else
+            epicsSnprintf(pname, 16, "other%07u", i);
+        putHeader(pmsg, CA_PROTO_SEARCH, 16, DONTREPLY,
+                  CA_MINOR_PROTOCOL_REVISION, i, i);
+        len += sizeof(caHdr) + 16;
+    }
+    return len;
+}
+
+/* Returns the number of search replies for hosted names */
+static
+unsigned countReplies(const char *buf, unsigned len, unsigned *pnbad)
+{
+    unsigned pos = 0, nfound = 0;
+
+    while(pos + sizeof(caHdr) <= len) {
+        const caHdr *pmsg = (const caHdr*)&buf[pos];
+
+        if(ntohs(pmsg->m_cmmd) == CA_PROTO_SEARCH) {
+            if(ntohl(pmsg->m_available) % HOSTED == 0)
+                nfound++;
+            else
+                (*pnbad)++;
+        }
+        pos += sizeof(caHdr) + ntohs(pmsg->m_postsize);
+    }
+    return nfound;
+}
+
+typedef struct {
+    SOCKET s;
+    unsigned expect;
+    unsigned nfound, nbad, nrecv;
+    epicsTimeStamp last;
+    epicsEventId done;
+} replyCounter;
+
+/* Count replies until all have arrived, or none arrive for a while */
+static
+void replyThread(void *raw)
+{
+    replyCounter *pctr = raw;
+    epicsSocketDatagram rdgs[BATCH];
+    char (*rbufs)[ETHERNET_MAX_UDP] = mallocMustSucceed(BATCH * ETHERNET_MAX_UDP,
+                                                       "replyThread");
+    unsigned i;
+
+    memset(rdgs, 0, sizeof(rdgs));
+    for(i=0; i<BATCH; i++) {
+        rdgs[i].buf = rbufs[i];
+        rdgs[i].bufSize = sizeof(rbufs[i]);
+    }
+
+    /* the socket has a receive timeout */
+    while(pctr->nfound < pctr->expect) {
+        int ret = epicsSocketRecvMany(pctr->s, rdgs, BATCH);
+
+        if(ret <= 0)
+            break;
+        for(i=0; i<(unsigned)ret; i++)
+            pctr->nfound += countReplies(rdgs[i].buf, rdgs[i].len, &pctr->nbad);
+        pctr->nrecv += ret;
+        epicsTimeGetCurrent(&pctr->last);
+    }
+
+    free(rbufs);
+    epicsEventMustTrigger(pctr->done);
+}
+
+static
+void runBurst(SOCKET s, unsigned ndgs, int checkAll)
+{
+    epicsSocketDatagram *dgs = callocMustSucceed(ndgs, sizeof(*dgs), "runBurst");
+    char *bufs = mallocMustSucceed((size_t)ndgs * MAX_UDP_SEND, "runBurst");
+    replyCounter ctr;
+    unsigned i, sent = 0;
+    epicsTimeStamp start;
+
+    for(i=0; i<ndgs; i++) {
+        dgs[i].buf = &bufs[(size_t)i * MAX_UDP_SEND];
+        dgs[i].len = buildSearch(dgs[i].buf, i * NSEARCH);
+        dgs[i].addr.ia.sin_family = AF_INET;
+        dgs[i].addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        dgs[i].addr.ia.sin_port = htons(serverPort);
+    }
+    memset(&ctr, 0, sizeof(ctr));
+    ctr.s = s;
+    ctr.expect = ndgs * NSEARCH / HOSTED;
+    ctr.done = epicsEventMustCreate(epicsEventEmpty);
+
+    epicsTimeGetCurrent(&start);
+    ctr.last = start;
+    epicsThreadMustCreate("replies", epicsThreadPriorityHigh,
+                          epicsThreadGetStackSize(epicsThreadStackSmall),
+                          &replyThread, &ctr);
+    while(sent < ndgs) {
+        unsigned n = ndgs - sent;
+        int ret = epicsSocketSendMany(s, &dgs[sent], n < BATCH ? n : BATCH);
+
+        if(ret <= 0)
+            testAbort("epicsSocketSendMany() fails");
+        sent += ret;
+    }
+
+    epicsEventMustWait(ctr.done);
+    epicsEventDestroy(ctr.done);
+
+    testDiag("%u datagrams, %u searches: %u of %u hosted names found "
+             "in %u replies, %.0f searches/s",
+             ndgs, ndgs * NSEARCH, ctr.nfound, ctr.expect, ctr.nrecv,
+             ndgs * NSEARCH / epicsTimeDiffInSeconds(&ctr.last, &start));
+    testOk(ctr.nbad == 0, "%u replies for names not on the IOC", ctr.nbad);
+    if(checkAll)
+        testOk(ctr.nfound == ctr.expect, "All hosted names found");
+
+    free(bufs);
+    free(dgs);
+}
+
+MAIN(casSearchStress)
+{
+    char port[16];
+    SOCKET s;
+    osiSockAddr addr;
+#ifdef _WIN32
+    DWORD timeout = 1000;
+#else
+    struct timeval timeout = {1, 0};
+#endif
+
+    testPlan(4);
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    testDiag("CA server on 127.0.0.1:%s", port);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    createRecords();
+    rsrv_register_server();
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)))
+        testAbort("Can't bind socket");
+    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (char*)&timeout, sizeof(timeout));
+
+    /* small enough not to overflow the server's socket buffer */
+    runBurst(s, 10, 1);
+    runBurst(s, 1000, 0);
+    runBurst(s, 10000, 0);
+
+    epicsSocketDestroy(s);
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
@@ -301,6 +301,92 @@ static void testCP(void)
     waitEvent = NULL;
 }
 
+#define NPAIRS 8
+
+static void testWorkers(void)
+{
+    xRecord *psrc[NPAIRS], *ptarg[NPAIRS];
+    dbCaWorker *pworker = NULL;
+    int i, nused = 0;
+
+    testDiag("Links shared between several workers");
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    for (i = 0; i < NPAIRS; i++) {
+        char macros[80];
+
+        epicsSnprintf(macros, sizeof(macros),
+            "source=source%d,target=target%d,TARGET=target%d CA", i, i, i);
+        testdbReadDatabase("dbCaLinkTest4.db", NULL, macros);
+    }
+
+    dbCaLinkThreads = 3;
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    dbCaLinkThreads = 1;
+
+    testOk(dbCaNWorkers == 3, "%d workers", dbCaNWorkers);
+
+    for (i = 0; i < NPAIRS; i++) {
+        char name[20];
+        caLink *pca;
+
+        epicsSnprintf(name, sizeof(name), "source%d", i);
+        psrc[i] = (xRecord*)testdbRecordPtr(name);
+        epicsSnprintf(name, sizeof(name), "target%d", i);
+        ptarg[i] = (xRecord*)testdbRecordPtr(name);
+
+        pca = (caLink *)psrc[i]->lnk.value.pv_link.pvt;
+        if (pca->worker != pworker)
+            nused++;
+        pworker = pca->worker;
+        testdbCaWaitForUpdateCount(&psrc[i]->lnk, 1);
+    }
+    testOk(nused > 1, "Links serviced by more than one worker");
+
+    for (i = 0; i < NPAIRS; i++) {
+        dbScanLock((dbCommon*)ptarg[i]);
+        ptarg[i]->val = 100 + i;
+        db_post_events(ptarg[i], &ptarg[i]->val, DBE_VALUE|DBE_ALARM|DBE_ARCHIVE);
+        dbScanUnlock((dbCommon*)ptarg[i]);
+    }
+
+    for (i = 0; i < NPAIRS; i++) {
+        epicsInt32 temp = 0;
+
+        testdbCaWaitForUpdateCount(&psrc[i]->lnk, 2);
+
+        dbScanLock((dbCommon*)psrc[i]);
+        dbGetLink(&psrc[i]->lnk, DBR_LONG, &temp, NULL, NULL);
+        testOp("%d",temp,==,100 + i);
+        dbScanUnlock((dbCommon*)psrc[i]);
+    }
+
+    for (i = 0; i < NPAIRS; i++) {
+        epicsInt32 temp = 200 + i;
+
+        dbScanLock((dbCommon*)psrc[i]);
+        dbPutLink(&psrc[i]->lnk, DBR_LONG, &temp, 1);
+        dbScanUnlock((dbCommon*)psrc[i]);
+    }
+    dbCaSync();
+
+    for (i = 0; i < NPAIRS; i++) {
+        dbScanLock((dbCommon*)ptarg[i]);
+        testOp("%d",ptarg[i]->val,==,200 + i);
+        dbScanUnlock((dbCommon*)ptarg[i]);
+    }
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 static void fillArray(epicsInt32 *buf, unsigned count, epicsInt32 first)
 {
     for(;count;count--,first++)
@@ -612,10 +698,11 @@ static void testCAC(void)
 
 MAIN(dbCaLinkTest)
 {
-    testPlan(101);
+    testPlan(119);
     testNativeLink();
     testStringLink();
     testCP();
+    testWorkers();
     testArrayLink(1,1);
     testArrayLink(10,1);
     testArrayLink(1,10);
@@ -0,0 +1,300 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of db_post_events_many(), which posts several fields of a record
+ * with one walk of its subscriptions.
+ */
+
+#include <string.h>
+
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+#include "epicsEvent.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NLOG 1024
+#define NBURST 200
+
+enum {subVal, subValAlarm, subI32, subF64, subSync, nSubs};
+
+static const char *subFields[nSubs] = {"ev.VAL", "ev.VAL", "ev.I32", "ev.F64",
+                                       "ev.U8"};
+static const unsigned subMasks[nSubs] = {DBE_VALUE, DBE_ALARM,
+                                         DBE_VALUE | DBE_LOG, DBE_VALUE,
+                                         DBE_VALUE};
+
+static struct {
+    int sub;
+    double value;
+} evLog[NLOG];
+static unsigned nLog;
+static epicsMutexId logLock;
+static epicsEventId synced;
+
+static xRecord *prec;
+
+static void monitorEvent(void *user_arg, struct dbChannel *chan,
+                         int eventsRemaining, struct db_field_log *pfl)
+{
+    int sub = (int)(size_t) user_arg;
+    double value = 0.0;
+
+    if (sub == subSync) {
+        epicsEventMustTrigger(synced);
+        return;
+    }
+    dbChannelGet(chan, DBR_DOUBLE, &value, NULL, NULL, pfl);
+    epicsMutexMustLock(logLock);
+    if (nLog < NLOG) {
+        evLog[nLog].sub = sub;
+        evLog[nLog].value = value;
+    }
+    nLog++;
+    epicsMutexUnlock(logLock);
+}
+
+/* Events of one queue are delivered in order, so once an event
+ * posted last has arrived, all those before it have too.
+ */
+static void syncEvents(void)
+{
+    dbScanLock((dbCommon*)prec);
+    prec->u8++;
+    db_post_events(prec, &prec->u8, DBE_VALUE);
+    dbScanUnlock((dbCommon*)prec);
+    if (epicsEventWaitWithTimeout(synced, 10.0) != epicsEventOK)
+        testAbort("Timeout waiting for events");
+}
+
+static void resetLog(void)
+{
+    epicsMutexMustLock(logLock);
+    nLog = 0;
+    epicsMutexUnlock(logLock);
+}
+
+/* How often was sub called, with its last value */
+static unsigned countEvents(int sub, double *plast)
+{
+    unsigned i, n = 0;
+
+    epicsMutexMustLock(logLock);
+    for (i = 0; i < nLog && i < NLOG; i++) {
+        if (evLog[i].sub == sub) {
+            n++;
+            *plast = evLog[i].value;
+        }
+    }
+    epicsMutexUnlock(logLock);
+    return n;
+}
+
+/* Are the values delivered to sub increasing? */
+static int increasing(int sub)
+{
+    unsigned i;
+    double last = -1.0;
+    int ok = 1;
+
+    epicsMutexMustLock(logLock);
+    for (i = 0; i < nLog && i < NLOG; i++) {
+        if (evLog[i].sub != sub)
+            continue;
+        if (evLog[i].value <= last)
+            ok = 0;
+        last = evLog[i].value;
+    }
+    epicsMutexUnlock(logLock);
+    return ok;
+}
+
+static void testDelivery(void)
+{
+    void *fields[3];
+    unsigned masks[3];
+    double last = 0.0;
+    unsigned n;
+
+    testDiag("Each field goes to its own subscriptions");
+
+    resetLog();
+    dbScanLock((dbCommon*)prec);
+    prec->val = 1;
+    prec->i32 = 101;
+    prec->f64 = 1.5;
+    fields[0] = &prec->val;
+    fields[1] = &prec->i32;
+    fields[2] = &prec->f64;
+    masks[0] = masks[1] = masks[2] = DBE_VALUE;
+    db_post_events_many(prec, fields, masks, 3);
+    dbScanUnlock((dbCommon*)prec);
+    syncEvents();
+
+    testOk(nLog == 3, "3 events (got %u)", nLog);
+    n = countEvents(subVal, &last);
+    testOk(n == 1 && last == 1.0, "VAL posted %u times, %g", n, last);
+    n = countEvents(subI32, &last);
+    testOk(n == 1 && last == 101.0, "I32 posted %u times, %g", n, last);
+    n = countEvents(subF64, &last);
+    testOk(n == 1 && last == 1.5, "F64 posted %u times, %g", n, last);
+}
+
+static void testMasks(void)
+{
+    void *fields[3];
+    unsigned masks[3];
+    double last = 0.0;
+    unsigned n;
+
+    testDiag("Masks are matched for each field");
+
+    resetLog();
+    dbScanLock((dbCommon*)prec);
+    fields[0] = &prec->val;
+    fields[1] = &prec->i32;
+    fields[2] = &prec->u16; /* no subscriptions */
+    masks[0] = DBE_ALARM;
+    masks[1] = DBE_ALARM;
+    masks[2] = DBE_VALUE;
+    db_post_events_many(prec, fields, masks, 3);
+    dbScanUnlock((dbCommon*)prec);
+    syncEvents();
+
+    testOk(nLog == 1, "1 event (got %u)", nLog);
+    n = countEvents(subValAlarm, &last);
+    testOk(n == 1 && last == 1.0,
+           "VAL alarm subscription posted %u times, %g", n, last);
+
+    testDiag("A field listed twice with different masks");
+
+    resetLog();
+    dbScanLock((dbCommon*)prec);
+    fields[0] = &prec->val;
+    fields[1] = &prec->val;
+    masks[0] = DBE_VALUE;
+    masks[1] = DBE_ALARM;
+    db_post_events_many(prec, fields, masks, 2);
+    dbScanUnlock((dbCommon*)prec);
+    syncEvents();
+
+    testOk(nLog == 2 && countEvents(subVal, &last) == 1 &&
+           countEvents(subValAlarm, &last) == 1,
+           "Each VAL subscription posted once (%u events)", nLog);
+
+    testDiag("No fields");
+
+    resetLog();
+    dbScanLock((dbCommon*)prec);
+    testOk1(db_post_events_many(prec, NULL, NULL, 0) == 0);
+    dbScanUnlock((dbCommon*)prec);
+    syncEvents();
+    testOk(nLog == 0, "No events (got %u)", nLog);
+}
+
+/* Faster than the event task reads them, so some events of a
+ * subscription are replaced by later ones, but never reordered.
+ */
+static void testOrdering(void)
+{
+    void *fields[3];
+    unsigned masks[3];
+    double last = 0.0;
+    unsigned k, n;
+
+    testDiag("Bursts keep the order of each subscription's events");
+
+    resetLog();
+    fields[0] = &prec->val;
+    fields[1] = &prec->i32;
+    fields[2] = &prec->f64;
+    masks[0] = masks[1] = masks[2] = DBE_VALUE;
+    for (k = 1; k <= NBURST; k++) {
+        dbScanLock((dbCommon*)prec);
+        prec->val = k;
+        prec->i32 = 1000 + k;
+        prec->f64 = k / 2.0;
+        db_post_events_many(prec, fields, masks, 3);
+        dbScanUnlock((dbCommon*)prec);
+    }
+    syncEvents();
+
+    n = countEvents(subVal, &last);
+    testOk(n > 0 && last == NBURST && increasing(subVal),
+           "VAL %u events in order, last %g", n, last);
+    n = countEvents(subI32, &last);
+    testOk(n > 0 && last == 1000 + NBURST && increasing(subI32),
+           "I32 %u events in order, last %g", n, last);
+    n = countEvents(subF64, &last);
+    testOk(n > 0 && last == NBURST / 2.0 && increasing(subF64),
+           "F64 %u events in order, last %g", n, last);
+}
+
+MAIN(dbEventTest)
+{
+    dbEventCtx evctx;
+    struct dbChannel *chans[nSubs];
+    dbEventSubscription subs[nSubs];
+    int i;
+
+    testPlan(12);
+
+    logLock = epicsMutexMustCreate();
+    synced = epicsEventMustCreate(epicsEventEmpty);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbEventTest.db", NULL, NULL);
+
+    testIocInitOk();
+
+    prec = (xRecord*)testdbRecordPtr("ev");
+
+    evctx = db_init_events();
+    if (!evctx || db_start_events(evctx, "dbEventTest", NULL, NULL,
+                                  epicsThreadPriorityLow))
+        testAbort("Failed to start event task");
+
+    for (i = 0; i < nSubs; i++) {
+        chans[i] = dbChannelCreate(subFields[i]);
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Failed to open channel to %s", subFields[i]);
+        subs[i] = db_add_event(evctx, chans[i], &monitorEvent,
+                               (void*)(size_t) i, subMasks[i]);
+        if (!subs[i])
+            testAbort("db_add_event fails");
+        db_event_enable(subs[i]);
+    }
+
+    testDelivery();
+    testMasks();
+    testOrdering();
+
+    for (i = 0; i < nSubs; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(evctx);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    epicsEventDestroy(synced);
+    epicsMutexDestroy(logLock);
+
+    return testDone();
+}
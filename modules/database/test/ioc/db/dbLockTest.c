@@ -11,6 +11,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "epicsSpin.h"
 #include "epicsMutex.h"
@@ -240,6 +241,17 @@ static void testMultiLock(void)
     testPtrOk1(testdbRecordPtr("recg")->lset->plockSet->owner,==,NULL);
 #endif
 
+    testDiag("Locker re-used");
+    {
+        lockRecordRef refs[8];
+
+        memcpy(refs, &plockA->refs[0], sizeof(refs));
+        dbScanLockMany(plockA);
+        dbScanUnlockMany(plockA);
+        testOk(memcmp(refs, &plockA->refs[0], sizeof(refs))==0,
+               "cached lockSet order unchanged");
+    }
+
     dbLockerFree(plockA);
 
     testDiag("After locker free'd");
@@ -414,12 +426,117 @@ static void testLinkNOP(void)
     testdbCleanup();
 }
 
+/* Are the locker's cached lockSets current, and in locking order? */
+static
+int refsCurrent(const dbLocker *locker)
+{
+    size_t i;
+
+    for(i=0; i<locker->maxrefs; i++) {
+        const lockRecordRef *ref = &locker->refs[i];
+
+        if(ref->plockSet!=ref->plr->plockSet)
+            return 0;
+        if(i>0 && ref->plockSet<locker->refs[i-1].plockSet)
+            return 0;
+    }
+    return 1;
+}
+
+/* The lockSet the locker has cached for a record, in any order */
+static
+lockSet* lockerSet(const dbLocker *locker, dbCommon *prec)
+{
+    size_t i;
+
+    for(i=0; i<locker->maxrefs; i++) {
+        if(locker->refs[i].plr==prec->lset)
+            return locker->refs[i].plockSet;
+    }
+    return NULL;
+}
+
+/* Lock and unlock, returning the generation seen by the locker */
+static
+size_t lockerGeneration(dbLocker *locker)
+{
+    dbScanLockMany(locker);
+    dbScanUnlockMany(locker);
+    return locker->recomp;
+}
+
+static void testGeneration(void)
+{
+    dbCommon *prec[3];
+    dbLocker *plock;
+    size_t gen, prev;
+
+    testDiag("Test lockSet generation count");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec[0] = testdbRecordPtr("reca");
+    prec[1] = testdbRecordPtr("recd");
+    prec[2] = testdbRecordPtr("recg");
+
+    plock = dbLockerAlloc(prec, 3, 0);
+    if(!plock)
+        testAbort("dbLockerAlloc() fails");
+
+    prev = lockerGeneration(plock);
+    gen = lockerGeneration(plock);
+    testOk(gen==prev, "No change, generation %u", (unsigned)gen);
+
+    /* merges reca into the lockSet of recd, rece and recf */
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "recd");
+    gen = lockerGeneration(plock);
+    testOk(gen==prev+1, "Merge, generation %u -> %u", (unsigned)prev, (unsigned)gen);
+    testOk(refsCurrent(plock) && lockerSet(plock, prec[0]) &&
+           lockerSet(plock, prec[0])==lockerSet(plock, prec[1]),
+           "Locker refs refreshed after merge");
+    prev = gen;
+
+    /* moves rece and recf to a new lockSet */
+    testdbPutFieldOk("recd.SDIS", DBR_STRING, "");
+    gen = lockerGeneration(plock);
+    testOk(gen==prev+1, "Split, generation %u -> %u", (unsigned)prev, (unsigned)gen);
+    testOk1(refsCurrent(plock));
+    prev = gen;
+
+    /* moves reca to a new lockSet */
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "");
+    gen = lockerGeneration(plock);
+    testOk(gen==prev+1, "Split, generation %u -> %u", (unsigned)prev, (unsigned)gen);
+    testOk(refsCurrent(plock) && lockerSet(plock, prec[0])!=lockerSet(plock, prec[1]),
+           "Locker refs refreshed after split");
+    prev = gen;
+
+    /* nothing to split */
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "");
+    gen = lockerGeneration(plock);
+    testOk(gen==prev, "No change, generation %u", (unsigned)gen);
+
+    dbLockerFree(plock);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(dbLockTest)
 {
 #ifdef LOCKSET_DEBUG
-    testPlan(100);
+    testPlan(113);
 #else
-    testPlan(88);
+    testPlan(101);
 #endif
     testSets();
     testSingleLock();
@@ -428,5 +545,6 @@ MAIN(dbLockTest)
     testLinkMake();
     testLinkChange();
     testLinkNOP();
+    testGeneration();
     return testDone();
 }
@@ -0,0 +1,138 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <string.h>
+
+#include "epicsThread.h"
+
+#include "dbAccess.h"
+#include "dbProcStats.h"
+#include "dbScan.h"
+#include "dbStaticLib.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static void testHist(void)
+{
+    dbProcHist hist;
+
+    testDiag("check histogram buckets");
+
+    memset(&hist, 0, sizeof(hist));
+    dbProcHistAdd(&hist, 500);
+    dbProcHistAdd(&hist, 1500);
+    dbProcHistAdd(&hist, 3000);
+    dbProcHistAdd(&hist, 1000000);
+
+    testOk(hist.count == 4, "count %u", hist.count);
+    testOk(hist.bucket[0] == 1 && hist.bucket[1] == 1 && hist.bucket[2] == 1 &&
+           hist.bucket[10] == 1, "buckets %u %u %u %u", hist.bucket[0],
+           hist.bucket[1], hist.bucket[2], hist.bucket[10]);
+    testOk(hist.maxNs == 1000000, "max %llu ns",
+           (unsigned long long)hist.maxNs);
+    testOk(dbProcHistPercentile(&hist, 0.5) == 2000, "50%% below %llu ns",
+           (unsigned long long)dbProcHistPercentile(&hist, 0.5));
+    testOk(dbProcHistPercentile(&hist, 1.0) == 1000000, "100%% below %llu ns",
+           (unsigned long long)dbProcHistPercentile(&hist, 1.0));
+
+    dbProcHistAdd(&hist, (epicsUInt64)1000000000u * 3600);
+    testOk1(hist.bucket[DB_PROC_HIST_BUCKETS - 1] == 1);
+}
+
+static void slowHook(xRecord *prec)
+{
+    epicsThreadSleep(0.02);
+}
+
+static long getStats(xRecord *prec, dbProcHist *phist, epicsUInt64 *plastNs)
+{
+    long status;
+
+    dbScanLock((dbCommon *)prec);
+    status = dbProcStatsGet((dbCommon *)prec, phist, plastNs);
+    dbScanUnlock((dbCommon *)prec);
+    return status;
+}
+
+static void testRecords(void)
+{
+    DBENTRY entry;
+    xRecord *pslow, *pfast;
+    dbProcHist slow, fast;
+    epicsUInt64 lastNs = 0;
+    int i;
+
+    testDiag("check record processing times");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x") || dbCreateRecord(&entry, "slow"))
+        testAbort("Can't create record");
+    dbFinishEntry(&entry);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    pslow = (xRecord *)testdbRecordPtr("slow");
+    pfast = (xRecord *)testdbRecordPtr("x");
+    dbScanLock((dbCommon *)pslow);
+    pslow->clbk = slowHook;
+    dbScanUnlock((dbCommon *)pslow);
+
+    testdbPutFieldOk("slow.PROC", DBF_LONG, 1);
+    testOk(getStats(pslow, &slow, NULL) == -1,
+           "Nothing allocated while inactive");
+
+    testOk1(dbProcStatsEnable(1) == 0);
+    testOk1(dbProcStatsActive);
+    testOk(getStats(pfast, &fast, NULL) == 0 && fast.count == 0,
+           "Allocated when enabled");
+    for (i = 0; i < 3; i++) {
+        testdbPutFieldOk("slow.PROC", DBF_LONG, 1);
+        testdbPutFieldOk("x.PROC", DBF_LONG, 1);
+    }
+    testOk1(dbProcStatsEnable(0) == 0);
+    testdbPutFieldOk("slow.PROC", DBF_LONG, 1);
+
+    testOk1(getStats(pslow, &slow, &lastNs) == 0);
+    testOk(slow.count == 3, "slow timed %u times", slow.count);
+    testOk(lastNs >= 15000000u, "slow last %llu ns",
+           (unsigned long long)lastNs);
+    testOk(slow.maxNs >= lastNs, "slow max %llu ns",
+           (unsigned long long)slow.maxNs);
+    testOk1(getStats(pfast, &fast, NULL) == 0);
+    testOk(fast.maxNs < lastNs, "x max %llu ns",
+           (unsigned long long)fast.maxNs);
+
+    testOk1(dbProcStatsRecord("slow", 0) == 0);
+    testOk1(dbProcStats(5, 1) == 0);
+    testOk1(getStats(pslow, &slow, NULL) == 0);
+    testOk(slow.count == 0 && slow.maxNs == 0, "Statistics cleared");
+
+    testOk1(scanJitter(0) == 0);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+MAIN(dbProcStatsTest)
+{
+    testPlan(30);
+    testHist();
+    testRecords();
+    return testDone();
+}
@@ -0,0 +1,179 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Record name lookup benchmark.
+ *
+ * Creates a database of N records and times dbFindRecord() for names
+ * which exist and for names which don't, the latter being what most
+ * CA name searches received by an IOC look for.  The lookups are also
+ * run from several threads at once, as by the CA server during a
+ * search storm.
+ */
+
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsEvent.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+#include "dbAccess.h"
+#include "dbStaticLib.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NAMELEN 16
+#define NLOOKUPS 2000000
+#define MAXTHREADS 4
+
+typedef struct {
+    const char *names;
+    unsigned nnames;
+    unsigned nlookups;
+    unsigned long nfound;
+    epicsEventId done;
+} lookupJob;
+
+static
+const char *nameOf(const char *names, unsigned i)
+{
+    return &names[(size_t)i * NAMELEN];
+}
+
+static
+char *makeNames(const char *prefix, unsigned n)
+{
+    char *names = mallocMustSucceed((size_t)n * NAMELEN, "makeNames");
+    unsigned i;
+
+    for(i=0; i<n; i++)
+        epicsSnprintf(&names[(size_t)i * NAMELEN], NAMELEN, "%s%07u", prefix, i);
+    return names;
+}
+
+static
+void lookup(lookupJob *job)
+{
+    DBENTRY entry;
+    unsigned i, j = 0;
+
+    dbInitEntry(pdbbase, &entry);
+    for(i=0; i<job->nlookups; i++) {
+        /* stride through the names so that lookups don't hit the cache */
+        j += 7919;
+        if(j >= job->nnames)
+            j %= job->nnames;
+        if(!dbFindRecord(&entry, nameOf(job->names, j)))
+            job->nfound++;
+    }
+    dbFinishEntry(&entry);
+}
+
+static
+void lookupThread(void *raw)
+{
+    lookupJob *job = (lookupJob*)raw;
+
+    lookup(job);
+    epicsEventMustTrigger(job->done);
+}
+
+static
+void timeLookups(const char *what, const char *names, unsigned nnames,
+                 unsigned nthreads, int exist)
+{
+    lookupJob jobs[MAXTHREADS];
+    unsigned long nfound = 0, total = (NLOOKUPS / nthreads) * nthreads;
+    epicsTimeStamp start, stop;
+    double elapsed;
+    unsigned i;
+
+    for(i=0; i<nthreads; i++) {
+        jobs[i].names = names;
+        jobs[i].nnames = nnames;
+        jobs[i].nlookups = NLOOKUPS / nthreads;
+        jobs[i].nfound = 0;
+        jobs[i].done = epicsEventMustCreate(epicsEventEmpty);
+    }
+
+    epicsTimeGetCurrent(&start);
+    if(nthreads == 1) {
+        lookup(&jobs[0]);
+    } else {
+        for(i=0; i<nthreads; i++)
+            epicsThreadMustCreate("lookup", epicsThreadPriorityMedium,
+                                  epicsThreadGetStackSize(epicsThreadStackSmall),
+                                  &lookupThread, &jobs[i]);
+        for(i=0; i<nthreads; i++)
+            epicsEventMustWait(jobs[i].done);
+    }
+    epicsTimeGetCurrent(&stop);
+    elapsed = epicsTimeDiffInSeconds(&stop, &start);
+
+    for(i=0; i<nthreads; i++) {
+        nfound += jobs[i].nfound;
+        epicsEventDestroy(jobs[i].done);
+    }
+
+    testDiag("%u records, %s, %u thread%s: %.0f lookups/s",
+             nnames, what, nthreads, nthreads==1 ? "" : "s",
+             total / elapsed);
+    testOk(nfound == (exist ? total : 0), "%lu of %lu found", nfound, total);
+}
+
+static
+void runBench(unsigned nrec)
+{
+    char *names = makeNames("pvd", nrec);
+    char *missing = makeNames("none", nrec);
+    DBENTRY entry;
+    epicsTimeStamp start, stop;
+    unsigned i, nfail = 0;
+
+    testDiag("Creating %u records", nrec);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    dbInitEntry(pdbbase, &entry);
+    if(dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+
+    epicsTimeGetCurrent(&start);
+    for(i=0; i<nrec; i++) {
+        if(dbCreateRecord(&entry, nameOf(names, i)))
+            nfail++;
+    }
+    epicsTimeGetCurrent(&stop);
+    dbFinishEntry(&entry);
+
+    testOk(nfail == 0, "%u records created in %.2f s, %u failed",
+           nrec, epicsTimeDiffInSeconds(&stop, &start), nfail);
+
+    timeLookups("existing", names, nrec, 1, 1);
+    timeLookups("missing", missing, nrec, 1, 0);
+    timeLookups("existing", names, nrec, MAXTHREADS, 1);
+    timeLookups("missing", missing, nrec, MAXTHREADS, 0);
+
+    testdbCleanup();
+    free(names);
+    free(missing);
+}
+
+MAIN(dbPvdBench)
+{
+    testPlan(0);
+    runBench(100000);
+    runBench(2000000);
+    return testDone();
+}
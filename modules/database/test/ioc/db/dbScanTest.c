@@ -11,15 +11,24 @@
  */
 
 #include <string.h>
+#include <limits.h>
 
 #include "dbScan.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
+#include "dbLock.h"
+#include "dbStaticLib.h"
 #include "errlog.h"
+#include "menuScan.h"
+
+#include "xRecord.h"
 
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
@@ -66,9 +75,197 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+#define NGROUPS 10
+#define GROUPSIZE 3
+
+/* what each record saw when it was last processed */
+static struct {
+    epicsThreadId tid;
+    int seq;
+    int count;
+} processed[NGROUPS][GROUPSIZE];
+static int processSeq;
+
+static void processHook(xRecord *prec)
+{
+    int i = prec->i32;
+
+    processed[i / GROUPSIZE][i % GROUPSIZE].tid = epicsThreadGetIdSelf();
+    processed[i / GROUPSIZE][i % GROUPSIZE].seq = epicsAtomicIncrIntT(&processSeq);
+    processed[i / GROUPSIZE][i % GROUPSIZE].count++;
+}
+
+static void testThreads(void)
+{
+    DBENTRY entry;
+    char name[20], link[20];
+    epicsThreadId tid0 = NULL;
+    int i, j, nmin = INT_MAX, nsplit = 0, nordered = 0, ndiff = 0;
+
+    testDiag("check scanThreads() splits a periodic list by lock set");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    /* groups of records linked into one lock set, in phase order */
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < NGROUPS * GROUPSIZE; i++) {
+        epicsSnprintf(name, sizeof(name), "thr%02d", i);
+        epicsSnprintf(link, sizeof(link), "thr%02d", i - 1);
+        if (dbCreateRecord(&entry, name) ||
+            dbFindField(&entry, "SCAN") ||
+            dbPutString(&entry, ".1 second") ||
+            dbFindField(&entry, "PHAS") ||
+            dbPutString(&entry, i % GROUPSIZE ? "1" : "0") ||
+            (i % GROUPSIZE && (dbFindField(&entry, "INP") ||
+                               dbPutString(&entry, link))))
+            testAbort("Can't create %s", name);
+    }
+    dbFinishEntry(&entry);
+
+    testOk1(scanThreads("no such rate", 2) != 0);
+    testOk1(scanThreads(".1 second", 3) == 0);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk1(scanThreads(".1 second", 3) != 0);
+
+    for (i = 0; i < NGROUPS * GROUPSIZE; i++) {
+        xRecord *prec;
+
+        epicsSnprintf(name, sizeof(name), "thr%02d", i);
+        prec = (xRecord *)testdbRecordPtr(name);
+        dbScanLock((dbCommon *)prec);
+        prec->i32 = i;
+        prec->clbk = processHook;
+        dbScanUnlock((dbCommon *)prec);
+    }
+
+    epicsThreadSleep(0.55);
+    testIocShutdownOk();
+
+    for (i = 0; i < NGROUPS; i++) {
+        int ordered = 1;
+
+        for (j = 0; j < GROUPSIZE; j++) {
+            if (processed[i][j].count < nmin)
+                nmin = processed[i][j].count;
+            if (processed[i][j].tid != processed[i][0].tid)
+                nsplit++;
+            if (j && processed[i][j].seq <= processed[i][j-1].seq)
+                ordered = 0;
+        }
+        nordered += ordered;
+        if (!tid0)
+            tid0 = processed[i][0].tid;
+        else if (processed[i][0].tid != tid0)
+            ndiff++;
+    }
+    testOk(nmin >= 2, "Each record processed at least %d times", nmin);
+    testOk(nsplit == 0, "%d records processed by another thread than their lock set",
+           nsplit);
+    testOk(nordered == NGROUPS, "%d of %d lock sets processed in order",
+           nordered, NGROUPS);
+    testOk(ndiff > 0, "%d lock sets processed by other threads than the first",
+           ndiff);
+
+    testdbCleanup();
+}
+
+#define NEDIT 4
+static int editCount[NEDIT];
+
+/* The first record takes itself and the next one off the scan list */
+static void editHook(xRecord *prec)
+{
+    int i;
+
+    if (prec->i32 == 0) {
+        for (i = 0; i < 2; i++) {
+            char name[20];
+            dbCommon *pother;
+
+            epicsSnprintf(name, sizeof(name), "edt%d", i);
+            pother = testdbRecordPtr(name);
+            dbScanLock(pother);
+            scanDelete(pother);
+            pother->scan = menuScanPassive;
+            dbScanUnlock(pother);
+        }
+    }
+    editCount[prec->i32]++;
+}
+
+static void testEdit(void)
+{
+    DBENTRY entry;
+    char name[20], phas[4];
+    int i;
+
+    testDiag("check a scan pass continues when records leave the list");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < NEDIT; i++) {
+        epicsSnprintf(name, sizeof(name), "edt%d", i);
+        epicsSnprintf(phas, sizeof(phas), "%d", i);
+        if (dbCreateRecord(&entry, name) ||
+            dbFindField(&entry, "SCAN") ||
+            dbPutString(&entry, "Event") ||
+            dbFindField(&entry, "EVNT") ||
+            dbPutString(&entry, "edit") ||
+            dbFindField(&entry, "PHAS") ||
+            dbPutString(&entry, phas))
+            testAbort("Can't create %s", name);
+    }
+    dbFinishEntry(&entry);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    for (i = 0; i < NEDIT; i++) {
+        xRecord *prec;
+
+        epicsSnprintf(name, sizeof(name), "edt%d", i);
+        prec = (xRecord *)testdbRecordPtr(name);
+        dbScanLock((dbCommon *)prec);
+        prec->i32 = i;
+        prec->clbk = editHook;
+        dbScanUnlock((dbCommon *)prec);
+    }
+
+    postEvent(eventNameToHandle("edit"));
+    testSyncCallback();
+
+    testOk(editCount[0] == 1 && editCount[1] == 0,
+           "Removed records processed %d and %d times", editCount[0],
+           editCount[1]);
+    testOk(editCount[2] == 1 && editCount[3] == 1,
+           "Remaining records processed %d and %d times", editCount[2],
+           editCount[3]);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(12);
     testOnce();
+    testThreads();
+    testEdit();
     return testDone();
 }
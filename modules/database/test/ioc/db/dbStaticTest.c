@@ -6,6 +6,10 @@
 
 #include <string.h>
 
+#include <epicsAtomic.h>
+#include <epicsEvent.h>
+#include <epicsStdio.h>
+#include <epicsThread.h>
 #include <errlog.h>
 #include <osiFileName.h>
 #include <dbAccess.h>
@@ -303,6 +307,184 @@ static void testWrongAliasRecord(const char *filename)
            "Wrong alias record in %s is expected to fail", filename);
 }
 
+/* Add and delete enough records to resize the process variable
+ * directory, with deletions made while entries are being moved.
+ */
+static void testPvdGrowth(void)
+{
+    DBENTRY entry;
+    char name[20];
+    int i, nbad = 0;
+    const int n = 3000;
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < n; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdGrowth%d", i);
+        if (dbCreateRecord(&entry, name))
+            nbad++;
+        if (i % 3 == 2) {
+            epicsSnprintf(name, sizeof(name), "pvdGrowth%d", i - 1);
+            if (dbFindRecord(&entry, name) || dbDeleteRecord(&entry))
+                nbad++;
+        }
+    }
+    testOk(nbad == 0, "Created %d records, %d failures", n, nbad);
+
+    for (i = 0; i < n; i++) {
+        int present = i % 3 != 1;
+
+        epicsSnprintf(name, sizeof(name), "pvdGrowth%d", i);
+        if ((dbFindRecord(&entry, name) == 0) != present)
+            nbad++;
+        else if (present && dbDeleteRecord(&entry))
+            nbad++;
+    }
+    testOk(nbad == 0, "Found and deleted remaining records, %d failures", nbad);
+    dbFinishEntry(&entry);
+}
+
+/* The name filter must pass every name in the directory, including
+ * while the table is being replaced, and reject most others.
+ */
+static void testPvdFilter(void)
+{
+    DBENTRY entry;
+    char name[20];
+    int i, nbad = 0, npassed = 0;
+    const int n = 2000, nmiss = 20000;
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < n; i++) {
+        int j;
+
+        epicsSnprintf(name, sizeof(name), "pvdFilter%d", i);
+        if (dbCreateRecord(&entry, name))
+            nbad++;
+        /* a few of the earlier names, which may not have been moved */
+        for (j = i; j >= 0 && j > i - 8; j--) {
+            epicsSnprintf(name, sizeof(name), "pvdFilter%d", j);
+            if (!dbPvdFilterMayHold(pdbbase, name, strlen(name)))
+                nbad++;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdFilter%d", i);
+        if (!dbPvdFilterMayHold(pdbbase, name, strlen(name)))
+            nbad++;
+    }
+    testOk(nbad == 0, "Filter passed all %d names, %d failures", n, nbad);
+
+    for (i = 0; i < nmiss; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdMissing%d", i);
+        if (dbPvdFilterMayHold(pdbbase, name, strlen(name)))
+            npassed++;
+    }
+    /* about 1% with the table at most half full */
+    testOk(npassed < nmiss / 20, "Filter passed %d of %d missing names",
+           npassed, nmiss);
+
+    nbad = 0;
+    for (i = 0; i < n; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdFilter%d", i);
+        if (dbFindRecord(&entry, name) || dbDeleteRecord(&entry))
+            nbad++;
+        else if (dbFindRecord(&entry, name) == 0)
+            nbad++;
+    }
+    testOk(nbad == 0, "Deleted names aren't found, %d failures", nbad);
+    dbFinishEntry(&entry);
+}
+
+#define PVD_STABLE 100
+#define PVD_READERS 2
+
+static int pvdStop;
+static int pvdMisses;
+static int pvdLookups;
+
+/* Looks up names which are always present */
+static void pvdReader(void *arg)
+{
+    epicsEventId done = arg;
+    DBENTRY entry;
+    char name[20];
+    int i = 0;
+
+    dbInitEntry(pdbbase, &entry);
+    while (!epicsAtomicGetIntT(&pvdStop)) {
+        epicsSnprintf(name, sizeof(name), "pvdStable%d", i++ % PVD_STABLE);
+        if (dbFindRecord(&entry, name))
+            epicsAtomicIncrIntT(&pvdMisses);
+        epicsAtomicIncrIntT(&pvdLookups);
+        if (i % 64 == 0)
+            epicsThreadSleep(0.0);
+    }
+    dbFinishEntry(&entry);
+    epicsEventMustTrigger(done);
+}
+
+/* Lookups while other records are added and deleted, so that tables
+ * are replaced and freed under the readers.
+ */
+static void testPvdConcurrent(void)
+{
+    epicsEventId done[PVD_READERS];
+    DBENTRY entry;
+    char name[20];
+    int i, round, nbad = 0;
+    const int n = 1500;
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < PVD_STABLE; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdStable%d", i);
+        if (dbCreateRecord(&entry, name))
+            nbad++;
+    }
+
+    for (i = 0; i < PVD_READERS; i++) {
+        done[i] = epicsEventMustCreate(epicsEventEmpty);
+        epicsThreadMustCreate("pvdReader", epicsThreadPriorityLow,
+            epicsThreadGetStackSize(epicsThreadStackSmall),
+            pvdReader, done[i]);
+    }
+
+    for (round = 0; round < 4; round++) {
+        for (i = 0; i < n; i++) {
+            epicsSnprintf(name, sizeof(name), "pvdChurn%d", i);
+            if (dbFindRecordType(&entry, "x") || dbCreateRecord(&entry, name))
+                nbad++;
+        }
+        for (i = 0; i < n; i++) {
+            epicsSnprintf(name, sizeof(name), "pvdChurn%d", i);
+            if (dbFindRecord(&entry, name) || dbDeleteRecord(&entry))
+                nbad++;
+        }
+    }
+
+    epicsAtomicSetIntT(&pvdStop, 1);
+    for (i = 0; i < PVD_READERS; i++) {
+        epicsEventMustWait(done[i]);
+        epicsEventDestroy(done[i]);
+    }
+
+    for (i = 0; i < PVD_STABLE; i++) {
+        epicsSnprintf(name, sizeof(name), "pvdStable%d", i);
+        if (dbFindRecord(&entry, name) || dbDeleteRecord(&entry))
+            nbad++;
+    }
+    dbFinishEntry(&entry);
+
+    testOk(nbad == 0 && pvdMisses == 0,
+           "%d lookups during resizes, %d missed, %d failures",
+           pvdLookups, pvdMisses, nbad);
+}
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 MAIN(dbStaticTest)
@@ -310,7 +492,7 @@ MAIN(dbStaticTest)
     const char *ldir;
     FILE *fp = NULL;
 
-    testPlan(312);
+    testPlan(318);
     testdbPrepare();
 
     testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
@@ -341,6 +523,10 @@ MAIN(dbStaticTest)
     testRec2Entry("testalias2");
     testRec2Entry("testalias3");
 
+    testPvdGrowth();
+    testPvdFilter();
+    testPvdConcurrent();
+
     eltc(0);
     testIocInitOk();
     eltc(1);
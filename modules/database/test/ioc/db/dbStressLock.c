@@ -15,6 +15,9 @@
  * 2) Lock several records.
  * 3) Retarget the TSEL link of a record
  *
+ * Afterwards the throughput of dbScanLock()/dbScanUnlock() is measured,
+ * first by one thread, then by all workers each locking its own record.
+ *
  *  Author: Michael Davidsaver <mdavidsaver@bnl.gov>
  */
 
@@ -154,6 +157,68 @@ void doreTarget(workerPriv *p)
         testAbort("put fails with %ld", ret);
 }
 
+typedef struct {
+    dbCommon *prec;
+    unsigned long count;
+    unsigned int done;
+    epicsEventId donevent;
+} lockerPriv;
+
+static
+void lockLoop(void *raw)
+{
+    lockerPriv *priv = raw;
+
+    while(!priv->done) {
+        unsigned i;
+        for(i=0; i<1000; i++) {
+            dbScanLock(priv->prec);
+            dbScanUnlock(priv->prec);
+        }
+        priv->count += i;
+    }
+    epicsEventMustTrigger(priv->donevent);
+}
+
+/* Lock and unlock with nthreads threads for a second, and return the
+ * total rate.
+ */
+static
+double lockRate(unsigned int nthreads)
+{
+    lockerPriv *priv = callocMustSucceed(nthreads, sizeof(*priv), "no memory");
+    epicsUInt64 before, after;
+    unsigned long total = 0;
+    unsigned int i;
+
+    for(i=0; i<nthreads; i++) {
+        priv[i].prec = precords[(i*nrecords)/nthreads];
+        priv[i].donevent = epicsEventMustCreate(epicsEventEmpty);
+    }
+
+    before = epicsMonotonicGet();
+    for(i=0; i<nthreads; i++) {
+        epicsThreadMustCreate("locker", epicsThreadPriorityMedium,
+                              epicsThreadGetStackSize(epicsThreadStackSmall),
+                              &lockLoop, &priv[i]);
+    }
+
+    epicsThreadSleep(1.0);
+
+    for(i=0; i<nthreads; i++) {
+        priv[i].done = 1;
+    }
+    for(i=0; i<nthreads; i++) {
+        epicsEventMustWait(priv[i].donevent);
+        epicsEventDestroy(priv[i].donevent);
+        total += priv[i].count;
+    }
+    after = epicsMonotonicGet();
+
+    free(priv);
+    return total/((after-before)*1e-9);
+}
+
 static
 void worker(void *raw)
 {
@@ -218,10 +283,10 @@ MAIN(dbStressTest)
             nworkers = val;
     }
 
-    testPlan(80+nworkers*3);
+    testPlan(82+nworkers*3);
 
 #if defined(__rtems__)
-    testSkip(80+nworkers*3, "Test assumes time sliced preempting scheduling");
+    testSkip(82+nworkers*3, "Test assumes time sliced preempting scheduling");
     return testDone();
 #endif
 
@@ -305,6 +370,15 @@ MAIN(dbStressTest)
 
     testDiag("All stopped");
 
+    testDiag("dbScanLock()/dbScanUnlock() throughput");
+    {
+        double rate = lockRate(1);
+
+        testOk(rate>0, "1 thread: %.3g per second", rate);
+        rate = lockRate(nworkers);
+        testOk(rate>0, "%u threads: %.3g per second", nworkers, rate);
+    }
+
     testDiag("Validate lockSet ref counts");
     dbInitEntry(pdbbase, &ent);
     for(status = dbFirstRecordType(&ent);
@@ -18,6 +18,7 @@
 #include "dbmf.h"
 
 int testdbConvert(void);
+int caNetConvertTest(void);
 int callbackTest(void);
 int callbackParallelTest(void);
 int dbStateTest(void);
@@ -25,7 +26,9 @@ int dbServerTest(void);
 int dbCaStatsTest(void);
 int dbShutdownTest(void);
 int dbScanTest(void);
+int dbProcStatsTest(void);
 int scanIoTest(void);
+int dbEventTest(void);
 int dbLockTest(void);
 int dbPutLinkTest(void);
 int dbStaticTest(void);
@@ -41,6 +44,7 @@ void epicsRunDbTests(void)
     testHarness();
 
     runTest(testdbConvert);
+    runTest(caNetConvertTest);
     runTest(callbackTest);
     runTest(callbackParallelTest);
     runTest(dbStateTest);
@@ -48,7 +52,9 @@ void epicsRunDbTests(void)
     runTest(dbCaStatsTest);
     runTest(dbShutdownTest);
     runTest(dbScanTest);
+    runTest(dbProcStatsTest);
     runTest(scanIoTest);
+    runTest(dbEventTest);
     runTest(dbLockTest);
     runTest(dbPutLinkTest);
     runTest(dbStaticTest);
@@ -18,15 +18,18 @@
 
 #include "epicsEvent.h"
 #include "epicsMessageQueue.h"
+#include "epicsThread.h"
 #include "epicsPrint.h"
 #include "epicsMath.h"
 #include "alarm.h"
+#include "caeventmask.h"
 #include "menuPriority.h"
 #include "dbChannel.h"
 #include "dbStaticLib.h"
 #include "dbAccessDefs.h"
 #include "dbScan.h"
 #include "dbLock.h"
+#include "dbEvent.h"
 #include "dbUnitTest.h"
 #include "dbCommon.h"
 #include "recSup.h"
@@ -296,14 +299,227 @@ static void testMultiThreading(void)
     }
 }
 
+typedef struct {
+    int count[NUM_CALLBACK_PRIORITIES];
+    int batched[NUM_CALLBACK_PRIORITIES];   /* scans run as a batch */
+    int batchedAt[NUM_CALLBACK_PRIORITIES]; /* count when the last was */
+    epicsEventId wait[NUM_CALLBACK_PRIORITIES];
+    epicsEventId wake[NUM_CALLBACK_PRIORITIES];
+} testcoal;
+
+static void testcbcoal(xpriv *priv, void *raw)
+{
+    testcoal *td = raw;
+    int prio = priv->prec->prio;
+    dbEventBatch probe;
+
+    /* a nested batch reveals the one the scan runs in */
+    db_event_batch_begin(&probe);
+    if(probe.prev) {
+        td->batched[prio]++;
+        td->batchedAt[prio] = td->count[prio];
+    }
+    db_event_batch_end(&probe);
+
+    td->count[prio]++;
+}
+
+static void testcompblock(void *raw, IOSCANPVT scan, int prio)
+{
+    testcoal *td = raw;
+
+    epicsEventMustTrigger(td->wait[prio]);
+    epicsEventMustWait(td->wake[prio]);
+}
+
+/* Queue a scan of the blocking list behind everything already queued,
+ * and wait until it has stopped all callback threads.
+ */
+static void blockCallbacks(xdrv *drv, testcoal *td)
+{
+    int i;
+
+    testOk1(scanIoRequest(drv->scan)==0x7);
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++)
+        epicsEventMustWait(td->wait[i]);
+}
+
+static void releaseCallbacks(testcoal *td)
+{
+    int i;
+
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++)
+        epicsEventMustTrigger(td->wake[i]);
+}
+
+typedef struct {
+    dbEventCtx evctx;
+    epicsEventId done;
+} testclose;
+
+static void closeEvents(void *raw)
+{
+    testclose *tc = raw;
+
+    db_close_events(tc->evctx);
+    epicsEventMustTrigger(tc->done);
+}
+
+static void dummyEvent(void *user_arg, struct dbChannel *chan,
+                       int eventsRemaining, struct db_field_log *pfl)
+{
+}
+
+/* db_close_events() must wait for a batch holding a wake of its user */
+static void testBatchClose(void)
+{
+    testclose tc;
+    dbChannel *chan;
+    dbEventSubscription sub;
+    dbEventBatch batch;
+    dbCommon *prec = testdbRecordPtr("g1m0");
+
+    testDiag("Closing an event user waits for the end of a batch");
+
+    tc.done = epicsEventMustCreate(epicsEventEmpty);
+    tc.evctx = db_init_events();
+    chan = dbChannelCreate("g1m0");
+    if(!tc.evctx || !chan || dbChannelOpen(chan) ||
+            db_start_events(tc.evctx, "batchClose", NULL, NULL,
+                            epicsThreadPriorityLow))
+        testAbort("Failed to set up event user");
+    sub = db_add_event(tc.evctx, chan, &dummyEvent, NULL, DBE_VALUE);
+    if(!sub)
+        testAbort("db_add_event fails");
+    db_event_enable(sub);
+    /* let the event task go idle after the initial update */
+    epicsThreadSleep(0.1);
+
+    db_event_batch_begin(&batch);
+    dbScanLock(prec);
+    db_post_events(prec, &((xRecord*)prec)->val, DBE_VALUE);
+    dbScanUnlock(prec);
+    /* the test monitor of g1m0 may be held as well */
+    testOk((batch.count>0 && batch.evUsers[0]==tc.evctx) ||
+           (batch.count>1 && batch.evUsers[1]==tc.evctx),
+           "the wake is held by the batch");
+
+    db_cancel_event(sub);
+    epicsThreadMustCreate("closeEvents", epicsThreadPriorityMedium,
+        epicsThreadGetStackSize(epicsThreadStackSmall), &closeEvents, &tc);
+    testOk(epicsEventWaitWithTimeout(tc.done, 0.5)==epicsEventWaitTimeout,
+           "db_close_events() waits");
+    db_event_batch_end(&batch);
+    testOk(epicsEventWaitWithTimeout(tc.done, 10.0)==epicsEventOK,
+           "db_close_events() returns after the batch ends");
+
+    dbChannelDelete(chan);
+    epicsEventDestroy(tc.done);
+}
+
+static void testCoalesce(void)
+{
+    int i;
+    testcoal data[2];
+    xdrv *drvs[2];
+    testMonitor *mon;
+
+    memset(data, 0, sizeof(data));
+
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++) {
+        data[0].wake[i] = epicsEventMustCreate(epicsEventEmpty);
+        data[0].wait[i] = epicsEventMustCreate(epicsEventEmpty);
+    }
+
+    testDiag("Test coalesced and batched I/O Intr scanning");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    /* group#, member#, priority */
+    loadRecord(0, 0, "LOW");
+    loadRecord(1, 0, "LOW");
+    loadRecord(0, 1, "MEDIUM");
+    loadRecord(1, 1, "MEDIUM");
+    loadRecord(0, 2, "HIGH");
+    loadRecord(1, 2, "HIGH");
+
+    /* scans of the first list hold the callback threads */
+    drvs[0] = xdrv_add(0, &testcbcoal, &data[0]);
+    drvs[1] = xdrv_add(1, &testcbcoal, &data[1]);
+    scanIoSetComplete(drvs[0]->scan, &testcompblock, &data[0]);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    mon = testMonitorCreate("g1m0", DBE_VALUE, 0);
+
+    blockCallbacks(drvs[0], &data[0]);
+
+    testDiag("Plain requests are all queued");
+    for(i=0; i<3; i++)
+        testOk1(scanIoRequest(drvs[1]->scan)==0x7);
+
+    testDiag("Batch requests are merged");
+    for(i=0; i<3; i++)
+        testOk1(scanIoRequestBatch(drvs[1]->scan)==0x7);
+
+    releaseCallbacks(&data[0]);
+    blockCallbacks(drvs[0], &data[0]);
+
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++)
+        testOk(data[1].count[i]==4, "count[%d]==4 (%d)", i, data[1].count[i]);
+
+    /* the plain scans queued first don't take the batch */
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++)
+        testOk(data[1].batched[i]==1 && data[1].batchedAt[i]==3,
+               "only the last scan of priority %d was a batch (%d, at %d)",
+               i, data[1].batched[i], data[1].batchedAt[i]);
+
+    testDiag("Monitor posted from a batch is delivered");
+    testMonitorWait(mon);
+    testOk1(testMonitorCount(mon, 1)>0);
+
+    testDiag("Requests are merged once coalescing is enabled");
+    scanIoSetCoalesce(drvs[1]->scan, 1);
+    for(i=0; i<3; i++)
+        testOk1(scanIoRequest(drvs[1]->scan)==0x7);
+
+    releaseCallbacks(&data[0]);
+    blockCallbacks(drvs[0], &data[0]);
+
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++)
+        testOk(data[1].count[i]==5, "count[%d]==5 (%d)", i, data[1].count[i]);
+
+    releaseCallbacks(&data[0]);
+
+    testBatchClose();
+
+    testMonitorDestroy(mon);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+
+    xdrv_reset();
+
+    for(i=0; i<NUM_CALLBACK_PRIORITIES; i++) {
+        epicsEventDestroy(data[0].wake[i]);
+        epicsEventDestroy(data[0].wait[i]);
+    }
+}
+
 MAIN(scanIoTest)
 {
-    testPlan(152);
+    testPlan(177);
     testSingleThreading();
     testDiag("run a second time to verify shutdown and restart works");
     testSingleThreading();
     testMultiThreading();
     testDiag("run a second time to verify shutdown and restart works");
     testMultiThreading();
+    testCoalesce();
     return testDone();
 }
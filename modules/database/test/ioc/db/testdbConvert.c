@@ -11,6 +11,7 @@
 #include "dbConvert.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsTypes.h"
 
 #include "epicsUnitTest.h"
 #include "testMain.h"
@@ -149,10 +150,135 @@ static void testBasicPut(void)
     free(scratch);
 }
 
+/* Array conversions are done in runs up to the end of the field's
+ * circular buffer, which the compiler may vectorize.  Compare them
+ * with converting one element at a time, for all request sizes and
+ * offsets into a field of odd length.
+ */
+#define RUN_NELEM 37
+#define RUN_GUARD 4
+
+static const struct {
+    const char *name;
+    short fieldType;
+    short requestType;
+} runCases[] = {
+    {"SHORT -> DOUBLE", DBF_SHORT, DBF_DOUBLE},
+    {"LONG -> DOUBLE", DBF_LONG, DBF_DOUBLE},
+    {"FLOAT -> DOUBLE", DBF_FLOAT, DBF_DOUBLE},
+    {"DOUBLE -> FLOAT", DBF_DOUBLE, DBF_FLOAT},
+    {"UCHAR -> INT64", DBF_UCHAR, DBF_INT64},
+};
+
+/* Large enough for any element, so every type is aligned */
+typedef union {
+    epicsInt8 i8;
+    epicsUInt8 u8;
+    epicsInt16 i16;
+    epicsInt32 i32;
+    epicsInt64 i64;
+    epicsFloat32 f32;
+    epicsFloat64 f64;
+} runElement;
+
+static void runSet(short type, runElement *buf, long i, double value)
+{
+    switch (type) {
+    case DBF_UCHAR: ((epicsUInt8 *) buf)[i] = (epicsUInt8) value; break;
+    case DBF_SHORT: ((epicsInt16 *) buf)[i] = (epicsInt16) value; break;
+    case DBF_LONG: ((epicsInt32 *) buf)[i] = (epicsInt32) value; break;
+    case DBF_INT64: ((epicsInt64 *) buf)[i] = (epicsInt64) value; break;
+    case DBF_FLOAT: ((epicsFloat32 *) buf)[i] = (epicsFloat32) value; break;
+    case DBF_DOUBLE: ((epicsFloat64 *) buf)[i] = value; break;
+    default: testAbort("runSet: type %d", type);
+    }
+}
+
+static double runGet(short type, const runElement *buf, long i)
+{
+    switch (type) {
+    case DBF_UCHAR: return ((const epicsUInt8 *) buf)[i];
+    case DBF_SHORT: return ((const epicsInt16 *) buf)[i];
+    case DBF_LONG: return ((const epicsInt32 *) buf)[i];
+    case DBF_INT64: return (double) ((const epicsInt64 *) buf)[i];
+    case DBF_FLOAT: return ((const epicsFloat32 *) buf)[i];
+    case DBF_DOUBLE: return ((const epicsFloat64 *) buf)[i];
+    default: testAbort("runGet: type %d", type);
+    }
+    return 0.0;
+}
+
+/* Fill buf with distinct values, or with a marker if seed is negative */
+static void runFill(short type, runElement *buf, long n, int seed)
+{
+    long i;
+
+    for (i = 0; i < n; i++)
+        runSet(type, buf, i, seed < 0 ? 99 : (i * 7 + seed) % 90);
+}
+
+static void testConvertRuns(void)
+{
+    runElement field[RUN_NELEM], buf[RUN_NELEM + RUN_GUARD];
+    DBADDR addr;
+    size_t c;
+
+    testDiag("Test array conversions against single elements");
+
+    memset(&addr, 0, sizeof(addr));
+    addr.no_elements = RUN_NELEM;
+    addr.pfield = field;
+
+    for (c = 0; c < NELEMENTS(runCases); c++) {
+        short ftype = runCases[c].fieldType, rtype = runCases[c].requestType;
+        GETCONVERTFUNC getter = dbGetConvertRoutine[ftype][rtype];
+        PUTCONVERTFUNC putter = dbPutConvertRoutine[rtype][ftype];
+        long nreq, off, i;
+        int nbad = 0;
+
+        addr.field_type = ftype;
+        for (nreq = 1; nreq <= RUN_NELEM; nreq++) {
+            for (off = 0; off < RUN_NELEM; off++) {
+                runFill(ftype, field, RUN_NELEM, 1);
+                runFill(rtype, buf, RUN_NELEM + RUN_GUARD, -1);
+                getter(&addr, buf, nreq, RUN_NELEM, off);
+                for (i = 0; i < nreq; i++) {
+                    if (runGet(rtype, buf, i) !=
+                        runGet(ftype, field, (off + i) % RUN_NELEM))
+                        nbad++;
+                }
+                for (; i < RUN_NELEM + RUN_GUARD; i++) {
+                    if (runGet(rtype, buf, i) != 99)
+                        nbad++;
+                }
+            }
+        }
+        testOk(nbad == 0, "Get %s, %d errors", runCases[c].name, nbad);
+
+        nbad = 0;
+        for (nreq = 1; nreq <= RUN_NELEM; nreq++) {
+            for (off = 0; off < RUN_NELEM; off++) {
+                runFill(rtype, buf, nreq, 2);
+                runFill(ftype, field, RUN_NELEM, -1);
+                putter(&addr, buf, nreq, RUN_NELEM, off);
+                for (i = 0; i < RUN_NELEM; i++) {
+                    long j = (i - off + RUN_NELEM) % RUN_NELEM;
+                    double expect = j < nreq ? runGet(rtype, buf, j) : 99;
+
+                    if (runGet(ftype, field, i) != expect)
+                        nbad++;
+                }
+            }
+        }
+        testOk(nbad == 0, "Put %s, %d errors", runCases[c].name, nbad);
+    }
+}
+
 MAIN(testdbConvert)
 {
-    testPlan(15);
+    testPlan(25);
     testBasicGet();
     testBasicPut();
+    testConvertRuns();
     return testDone();
 }
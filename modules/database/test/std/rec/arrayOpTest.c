@@ -6,10 +6,17 @@
 * in file LICENSE that is included with this distribution.
  \*************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 
+#include "cantProceed.h"
 #include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
 #include "dbTest.h"
+#include "db_field_log.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "errlog.h"
@@ -159,9 +166,139 @@ static void testGetPutArray(void)
     testdbCleanup();
 }
 
+typedef struct {
+    dbChannel *chan;
+    dbEventSubscription sub;
+    epicsEventId seen;
+    void *pfield;
+    long nelem;
+    int hasCopy;
+    epicsInt32 data[4];
+} arrayMonitor;
+
+static void arrayEvent(void *user_arg, struct dbChannel *chan,
+                       int eventsRemaining, struct db_field_log *pfl)
+{
+    arrayMonitor *mon = user_arg;
+
+    mon->pfield = pfl->u.r.field;
+    mon->nelem = pfl->no_elements;
+    mon->hasCopy = dbfl_has_copy(pfl);
+    if (mon->nelem <= NELEMENTS(mon->data))
+        memcpy(mon->data, mon->pfield, mon->nelem * sizeof(epicsInt32));
+    epicsEventMustTrigger(mon->seen);
+}
+
+static void testSharedSnapshot(void)
+{
+    epicsInt32 data[4] = {4, 5, 6, 7};
+    arrayMonitor mon[2];
+    waveformRecord *prec;
+    dbEventCtx evctx;
+    DBADDR addr;
+    unsigned i;
+
+    testdbPrepare();
+
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    testdbReadDatabase("arrayOpTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testDiag("Test monitors of an array share one snapshot");
+
+    prec = (waveformRecord*)testdbRecordPtr("wfrec");
+    if(!prec || dbNameToAddr("wfrec", &addr))
+        testAbort("Failed to find record wfrec");
+
+    evctx = db_init_events();
+    if(!evctx || db_start_events(evctx, "arrayEvent", NULL, NULL,
+                                 epicsThreadPriorityLow))
+        testAbort("Failed to start event task");
+
+    memset(mon, 0, sizeof(mon));
+    for(i=0; i<NELEMENTS(mon); i++) {
+        mon[i].chan = dbChannelCreate("wfrec");
+        if(!mon[i].chan || dbChannelOpen(mon[i].chan))
+            testAbort("Failed to open channel to wfrec");
+        mon[i].seen = epicsEventMustCreate(epicsEventEmpty);
+        mon[i].sub = db_add_event(evctx, mon[i].chan, &arrayEvent, &mon[i],
+                                  DBE_VALUE);
+        if(!mon[i].sub)
+            testAbort("db_add_event fails");
+        db_event_enable(mon[i].sub);
+    }
+
+    testOk1(dbPutField(&addr, DBR_LONG, data, NELEMENTS(data))==0);
+
+    for(i=0; i<NELEMENTS(mon); i++) {
+        if(epicsEventWaitWithTimeout(mon[i].seen, 10.0)!=epicsEventOK)
+            testAbort("Timeout waiting for monitor %u", i);
+        testOk(mon[i].nelem==4 && mon[i].hasCopy &&
+               memcmp(mon[i].data, data, sizeof(data))==0,
+               "monitor %u has a copy of the 4 elements posted (got %ld)",
+               i, mon[i].nelem);
+    }
+    testOk1(mon[0].pfield==mon[1].pfield);
+    testOk1(mon[0].pfield!=prec->bptr);
+
+    testDiag("A single monitor references the record");
+
+    db_cancel_event(mon[1].sub);
+    testOk1(dbPutField(&addr, DBR_LONG, data, NELEMENTS(data))==0);
+    if(epicsEventWaitWithTimeout(mon[0].seen, 10.0)!=epicsEventOK)
+        testAbort("Timeout waiting for monitor 0");
+    testOk(!mon[0].hasCopy && mon[0].pfield==dbChannelField(mon[0].chan),
+           "monitor 0 references the field");
+
+    testDiag("A single monitor of a large array has a copy");
+
+    dbChannelDelete(mon[1].chan);
+    mon[1].chan = dbChannelCreate("wfbig");
+    if(!mon[1].chan || dbChannelOpen(mon[1].chan))
+        testAbort("Failed to open channel to wfbig");
+    mon[1].sub = db_add_event(evctx, mon[1].chan, &arrayEvent, &mon[1],
+                              DBE_VALUE);
+    if(!mon[1].sub)
+        testAbort("db_add_event fails");
+    db_event_enable(mon[1].sub);
+    {
+        const long nbig = DB_EVENT_ARRAY_COPY_BYTES / sizeof(epicsInt32);
+        epicsInt32 *big = callocMustSucceed(nbig, sizeof(epicsInt32),
+                                            "arrayOpTest");
+
+        testdbPutArrFieldOk("wfbig", DBF_LONG, nbig, big);
+        if(epicsEventWaitWithTimeout(mon[1].seen, 10.0)!=epicsEventOK)
+            testAbort("Timeout waiting for monitor 1");
+        testOk(mon[1].nelem==nbig && mon[1].hasCopy &&
+               mon[1].pfield!=dbChannelField(mon[1].chan),
+               "monitor 1 has a copy of the %ld elements posted (got %ld)",
+               nbig, mon[1].nelem);
+        free(big);
+    }
+
+    db_cancel_event(mon[0].sub);
+    db_cancel_event(mon[1].sub);
+    for(i=0; i<NELEMENTS(mon); i++) {
+        dbChannelDelete(mon[i].chan);
+        epicsEventDestroy(mon[i].seen);
+    }
+    db_close_events(evctx);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(arrayOpTest)
 {
-    testPlan(21);
+    testPlan(30);
     testGetPutArray();
+    testSharedSnapshot();
     return testDone();
 }
@@ -0,0 +1,170 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Part of caDirectSendTest, compiled separately to avoid
+ * dbAccess.h vs. db_access.h conflicts
+ */
+
+#include <vector>
+
+#include <epicsEvent.h>
+#include <epicsMutex.h>
+#include <epicsGuard.h>
+#include <epicsTime.h>
+
+#include "epicsUnitTest.h"
+
+#include "cadef.h"
+
+#define testECA(OP) if((OP)!=ECA_NORMAL) {testAbort("%s", #OP);} else {testPass("%s", #OP);}
+
+#define NELM 100000
+
+namespace {
+
+struct monitorPvt {
+    const char *name;
+    chtype type;
+    unsigned long count;
+    chid chan;
+    evid sub;
+    epicsMutex lock;
+    epicsEvent event;
+    std::vector<double> last;
+    epicsTimeStamp stamp;
+    unsigned updates;
+    monitorPvt() : name(0), type(0), count(0), chan(0), sub(0), updates(0u) {}
+
+    bool waitFor(unsigned n, double timeout)
+    {
+        epicsTime deadline(epicsTime::getCurrent() + timeout);
+        epicsGuard<epicsMutex> G(lock);
+        while(updates < n) {
+            double left = deadline - epicsTime::getCurrent();
+            if(left <= 0.0)
+                return false;
+            epicsGuardRelease<epicsMutex> U(G);
+            event.wait(left);
+        }
+        return true;
+    }
+};
+
+template<typename T>
+void copyOut(std::vector<double>& dest, const void *pvalue, long count)
+{
+    const T *p = static_cast<const T*>(pvalue);
+    dest.assign(p, p + count);
+}
+
+extern "C"
+void monitorUpdate(struct event_handler_args args)
+{
+    monitorPvt *pvt = static_cast<monitorPvt*>(args.usr);
+    const void *pvalue = dbr_value_ptr(args.dbr, args.type);
+
+    if(args.status != ECA_NORMAL)
+        return;
+    {
+        epicsGuard<epicsMutex> G(pvt->lock);
+        switch(args.type % (LAST_TYPE + 1)) {
+        case DBR_CHAR: copyOut<dbr_char_t>(pvt->last, pvalue, args.count); break;
+        case DBR_SHORT: copyOut<dbr_short_t>(pvt->last, pvalue, args.count); break;
+        case DBR_LONG: copyOut<dbr_long_t>(pvt->last, pvalue, args.count); break;
+        case DBR_FLOAT: copyOut<dbr_float_t>(pvt->last, pvalue, args.count); break;
+        case DBR_DOUBLE: copyOut<dbr_double_t>(pvt->last, pvalue, args.count); break;
+        }
+        if(dbr_type_is_TIME(args.type))
+            pvt->stamp = static_cast<const struct dbr_time_double*>(args.dbr)->stamp;
+        pvt->updates++;
+    }
+    pvt->event.signal();
+}
+
+} // namespace
+
+extern "C"
+void caDirectSendTest_contextCreate(void)
+{
+    if(ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Failed to create CA context");
+}
+
+extern "C"
+void caDirectSendTest_contextDestroy(void)
+{
+    ca_context_destroy();
+}
+
+extern "C"
+void caDirectSendTest_client(void)
+{
+    // The native types are sent from the snapshots, with and without
+    // meta-data, and with a count which leaves pad bytes.  The last one
+    // is converted, so takes the copying path.
+    static const struct {
+        const char *name;
+        chtype type;
+        unsigned long count;
+    } subs[] = {
+        {"ds:char", DBR_CHAR, NELM},
+        {"ds:short", DBR_TIME_SHORT, NELM - 1},
+        {"ds:long", DBR_LONG, NELM},
+        {"ds:float", DBR_FLOAT, NELM},
+        {"ds:double", DBR_TIME_DOUBLE, NELM},
+        {"ds:short", DBR_DOUBLE, NELM},
+    };
+    const size_t nsubs = sizeof(subs) / sizeof(subs[0]);
+    const size_t nrecords = nsubs - 1;
+    monitorPvt pvt[nsubs];
+
+    for(size_t i=0; i<nsubs; i++) {
+        pvt[i].name = subs[i].name;
+        pvt[i].type = subs[i].type;
+        pvt[i].count = subs[i].count;
+        if(ca_create_channel(subs[i].name, NULL, NULL, 0, &pvt[i].chan) != ECA_NORMAL)
+            testAbort("Can't create channel %s", subs[i].name);
+    }
+    testECA(ca_pend_io(5.0));
+
+    for(size_t i=0; i<nsubs; i++)
+        testECA(ca_create_subscription(pvt[i].type, pvt[i].count, pvt[i].chan,
+                                       DBE_VALUE, monitorUpdate, &pvt[i],
+                                       &pvt[i].sub));
+    testECA(ca_flush_io());
+    for(size_t i=0; i<nsubs; i++)
+        testOk(pvt[i].waitFor(1, 5.0), "%s %s initial update", pvt[i].name,
+               dbr_type_to_text(pvt[i].type));
+
+    std::vector<dbr_double_t> buf(NELM);
+    for(size_t i=0; i<NELM; i++)
+        buf[i] = (i / 16 + 1) % 100;
+    for(size_t i=0; i<nrecords; i++)
+        testECA(ca_array_put(DBR_DOUBLE, NELM, pvt[i].chan, &buf[0]));
+    testECA(ca_flush_io());
+
+    for(size_t i=0; i<nsubs; i++) {
+        bool ok = pvt[i].waitFor(2, 10.0);
+        testOk(ok, "%s %s update after put", pvt[i].name,
+               dbr_type_to_text(pvt[i].type));
+
+        epicsGuard<epicsMutex> G(pvt[i].lock);
+        size_t bad = pvt[i].last.size() == pvt[i].count ? 0 : pvt[i].count;
+        for(size_t j=0; !bad && j<pvt[i].count; j++)
+            if(pvt[i].last[j] != buf[j])
+                bad++;
+        testOk(bad == 0, "%s %s has %u elements, %u differ", pvt[i].name,
+               dbr_type_to_text(pvt[i].type), (unsigned)pvt[i].last.size(),
+               (unsigned)bad);
+    }
+    testOk(pvt[1].stamp.secPastEpoch != 0 && pvt[4].stamp.secPastEpoch != 0,
+           "Time stamps sent with the arrays");
+
+    for(size_t i=0; i<nsubs; i++)
+        testECA(ca_clear_subscription(pvt[i].sub));
+    for(size_t i=0; i<nsubs; i++)
+        ca_clear_channel(pvt[i].chan);
+}
@@ -0,0 +1,96 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test of large array subscription updates which the CA server sends
+ * straight from the waveform record's array snapshots, byte swapping
+ * them as they go out where necessary.
+ *
+ * Starts an IOC with its CA server listening on the loopback interface,
+ * and subscribes to waveforms of each numeric type through a client
+ * context.  The client side is in caDirectSendClient.cpp.
+ */
+
+#include <string.h>
+
+#include "envDefs.h"
+#include "epicsStdio.h"
+#include "osiSock.h"
+
+#include "dbAccess.h"
+#include "iocInit.h"
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+void caDirectSendTest_contextCreate(void);
+void caDirectSendTest_contextDestroy(void);
+void caDirectSendTest_client(void);
+
+/* Pick an unused port for the server */
+static
+unsigned short freePort(void)
+{
+    SOCKET s = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t slen = sizeof(addr);
+
+    if(s == INVALID_SOCKET)
+        testAbort("Can't create socket");
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(bind(s, &addr.sa, sizeof(addr.ia)) || getsockname(s, &addr.sa, &slen))
+        testAbort("Can't bind socket");
+    epicsSocketDestroy(s);
+    return ntohs(addr.ia.sin_port);
+}
+
+MAIN(caDirectSendTest)
+{
+    unsigned short serverPort;
+    char port[16], addr[32];
+
+    testPlan(39);
+
+    osiSockAttach();
+    serverPort = freePort();
+    epicsSnprintf(port, sizeof(port), "%u", serverPort);
+    epicsSnprintf(addr, sizeof(addr), "127.0.0.1:%u", serverPort);
+    epicsEnvSet("EPICS_CAS_SERVER_PORT", port);
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addr);
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "4000000");
+    testDiag("CA server on %s", addr);
+
+    /* rsrv.dbd, in recTestIoc.dbd, registers the server */
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("caDirectSendTest.db", NULL, NULL);
+
+    /* Once the IOC is running, new client contexts are attached to its
+     * database directly, so this one must be created first.
+     */
+    caDirectSendTest_contextCreate();
+
+    /* not testIocInitOk(), which doesn't start servers */
+    if(iocInit())
+        testAbort("iocInit() fails");
+
+    caDirectSendTest_client();
+
+    caDirectSendTest_contextDestroy();
+
+    /* the CA server can't be stopped, so just exit */
+
+    return testDone();
+}
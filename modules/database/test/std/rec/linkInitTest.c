@@ -94,6 +94,25 @@ static void testCalcInit()
     testdbGetFieldEqual("emptylink1.VAL", DBR_DOUBLE, 1.0);
     testdbGetFieldEqual("emptylink1.SEVR", DBR_LONG, 0);
 
+    testDiag("calc link with array args");
+    {
+        epicsFloat64 wf1[] = {12, 24, 36, 48, 60};
+        epicsInt32 wf2[] = {-1, -1, 3};
+        epicsInt32 wf2b[] = {-2, -2, 3};
+
+        testdbPutFieldOk("calcwf1.PROC", DBF_LONG, 1);
+        testdbGetFieldEqual("calcwf1.NORD", DBR_LONG, 5);
+        testdbGetArrFieldEqual("calcwf1.VAL", DBF_DOUBLE, 10, 5, wf1);
+
+        testdbPutFieldOk("calcwf2.PROC", DBF_LONG, 1);
+        testdbGetArrFieldEqual("calcwf2.VAL", DBF_LONG, 3, 3, wf2);
+        testdbPutFieldOk("calcwf2.PROC", DBF_LONG, 1);
+        testdbGetArrFieldEqual("calcwf2.VAL", DBF_LONG, 3, 3, wf2b);
+
+        testdbPutFieldOk("calcwf3.PROC", DBF_LONG, 1);
+        testdbGetFieldEqual("calcwf3.VAL", DBR_DOUBLE, 12.0);
+    }
+
     testIocShutdownOk();
 
     testdbCleanup();
@@ -246,7 +265,7 @@ void testInt64Inputs(void)
 
 MAIN(linkInitTest)
 {
-    testPlan(79);
+    testPlan(88);
 
     testLongStringInit();
     testCalcInit();
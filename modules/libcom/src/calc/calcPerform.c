@@ -403,10 +403,906 @@ LIBCOM_API long
     return 0;
 }
 
+/* Compiled expressions
+ *
+ * calcCompile() translates the postfix byte code into an array of aligned
+ * instructions.  Literal values are decoded and the jump targets of the
+ * conditional operators are found when compiling rather than each time the
+ * expression is evaluated.  An argument fetch or a literal that is followed
+ * by one of the common binary operators is fused with it into a single
+ * instruction, which takes its right-hand operand from the instruction
+ * instead of pushing it onto the stack first.
+ *
+ * Each instruction does exactly the same arithmetic as its opcode does in
+ * calcPerform(), so the results are identical.
+ */
+
+/* Opcodes used only in compiled instructions */
+enum {
+    PUSH_CONST = NOT_GENERATED + 1,
+    PUSH_ARG,
+    STORE_ARG,
+    JUMP_IF_ZERO,
+    JUMP,
+    FAIL,
+    /* right-hand operand is parg[arg] */
+    ADD_ARG, SUB_ARG, MULT_ARG, DIV_ARG,
+    NOT_EQ_ARG, LESS_THAN_ARG, LESS_OR_EQ_ARG,
+    EQUAL_ARG, GR_OR_EQ_ARG, GR_THAN_ARG,
+    /* right-hand operand is value */
+    ADD_CONST, SUB_CONST, MULT_CONST, DIV_CONST,
+    NOT_EQ_CONST, LESS_THAN_CONST, LESS_OR_EQ_CONST,
+    EQUAL_CONST, GR_OR_EQ_CONST, GR_THAN_CONST
+};
+
+typedef struct calcInst {
+    unsigned char op;
+    unsigned char arg;      /* argument index, or number of var-args */
+    epicsInt32 jump;        /* index of the jump target */
+    double value;           /* constant operand */
+} calcInst;
+
+struct calcCompiled {
+    int ninst;
+    int block;              /* can be evaluated by blockPerform() */
+    calcInst inst[1];
+};
+
+/* The binary operators that can be fused, in the order of their fused
+ * opcodes above
+ */
+static const unsigned char fusable[] = {
+    ADD, SUB, MULT, DIV,
+    NOT_EQ, LESS_THAN, LESS_OR_EQ, EQUAL, GR_OR_EQ, GR_THAN
+};
+
+/* Fused form of a binary operator with the given operand, 0 if none */
+static int fuseOp(int op, int operand)
+{
+    unsigned i;
+
+    for (i = 0; i < NELEMENTS(fusable); i++) {
+        if (op == fusable[i])
+            return (operand == PUSH_ARG ? ADD_ARG : ADD_CONST) + i;
+    }
+    return 0;
+}
+
+/* Array evaluation
+ *
+ * calcCompiledPerformArray() evaluates most expressions a block of elements
+ * at a time, doing each instruction for all elements of the block in a
+ * simple loop that the compiler can vectorize.  The stack holds a block of
+ * values in each entry.  Expressions that use conditionals, assignments,
+ * random numbers or the integer and bitwise operators are evaluated one
+ * element at a time instead.
+ */
+#define CALC_BLOCK_SIZE 64
+#define CALC_BLOCK_DEPTH 8
+
+enum {
+    BLOCK_NONE,     /* can't be done blockwise */
+    BLOCK_PUSH,
+    BLOCK_FUSED,
+    BLOCK_UNARY,
+    BLOCK_BINARY,
+    BLOCK_NARY,
+    BLOCK_END
+};
+
+static int blockKind(int op)
+{
+    if (op >= ADD_ARG && op <= GR_THAN_CONST)
+        return BLOCK_FUSED;
+
+    switch (op) {
+    case END_EXPRESSION:
+        return BLOCK_END;
+
+    case PUSH_CONST:
+    case PUSH_ARG:
+    case FETCH_VAL:
+        return BLOCK_PUSH;
+
+    case UNARY_NEG:
+    case ABS_VAL:
+    case EXP:
+    case LOG_10:
+    case LOG_E:
+    case SQU_RT:
+    case ACOS:
+    case ASIN:
+    case ATAN:
+    case COS:
+    case SIN:
+    case TAN:
+    case COSH:
+    case SINH:
+    case TANH:
+    case CEIL:
+    case FLOOR:
+    case ISINF:
+    case NINT:
+    case REL_NOT:
+        return BLOCK_UNARY;
+
+    case ADD:
+    case SUB:
+    case MULT:
+    case DIV:
+    case POWER:
+    case ATAN2:
+    case FMOD:
+    case REL_OR:
+    case REL_AND:
+    case NOT_EQ:
+    case LESS_THAN:
+    case LESS_OR_EQ:
+    case EQUAL:
+    case GR_OR_EQ:
+    case GR_THAN:
+        return BLOCK_BINARY;
+
+    case MAX:
+    case MIN:
+        return BLOCK_NARY;
+
+    default:
+        return BLOCK_NONE;
+    }
+}
+
+/* Check that a compiled expression only uses operators that can be done
+ * blockwise and fits in the block stack
+ */
+static int blockCheck(const calcCompiled *pcomp)
+{
+    const calcInst *pi;
+    int depth = 0;
+
+    for (pi = pcomp->inst; pi < pcomp->inst + pcomp->ninst; pi++) {
+        switch (blockKind(pi->op)) {
+        case BLOCK_END:
+            return depth == 1;
+
+        case BLOCK_PUSH:
+            if (++depth > CALC_BLOCK_DEPTH)
+                return 0;
+            break;
+
+        case BLOCK_FUSED:
+        case BLOCK_UNARY:
+            if (depth < 1)
+                return 0;
+            break;
+
+        case BLOCK_BINARY:
+            if (depth < 2)
+                return 0;
+            depth--;
+            break;
+
+        case BLOCK_NARY:
+            if (pi->arg < 1 || depth < pi->arg)
+                return 0;
+            depth -= pi->arg - 1;
+            break;
+
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/* Length of the instruction at pinst, 0 if it's not a valid opcode */
+static int instLength(const char *pinst)
+{
+    int op = *pinst;
+
+    if (op < 0 || op >= NOT_GENERATED)
+        return 0;
+    switch (op) {
+    case LITERAL_DOUBLE:
+        return 1 + sizeof(double);
+    case LITERAL_INT:
+        return 1 + sizeof(epicsInt32);
+    case MIN:
+    case MAX:
+    case FINITE:
+    case ISNAN:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+LIBCOM_API calcCompiled *
+    calcCompile(const char *ppostfix)
+{
+    calcCompiled *pcomp;
+    calcInst *pi;
+    int *index;     /* instruction index for each postfix byte offset */
+    int len = 0, ninst = 0, n;
+    int needFail = 0;
+    int op;
+
+    /* Check the opcodes and size the program */
+    while ((op = ppostfix[len]) != END_EXPRESSION) {
+        n = instLength(ppostfix + len);
+        if (!n)
+            return NULL;
+        len += n;
+        ninst++;
+    }
+
+    index = malloc((len + 1) * sizeof(int));
+    /* END_EXPRESSION, and FAIL for a bad conditional */
+    pcomp = malloc(sizeof(calcCompiled) + (ninst + 1) * sizeof(calcInst));
+    if (!index || !pcomp) {
+        free(index);
+        free(pcomp);
+        return NULL;
+    }
+    memset(pcomp->inst, 0, (ninst + 2) * sizeof(calcInst));
+
+    pi = pcomp->inst;
+    n = 0;
+    while (n <= len) {
+        const char *pinst = ppostfix + n;
+        const char *ptarget;
+        epicsInt32 itop;
+        int fused;
+
+        op = *pinst;
+        index[n] = pi - pcomp->inst;
+        n += op == END_EXPRESSION ? 1 : instLength(pinst);
+
+        switch (op) {
+        case END_EXPRESSION:
+            pi->op = END_EXPRESSION;
+            break;
+
+        case LITERAL_DOUBLE:
+            pi->op = PUSH_CONST;
+            memcpy(&pi->value, pinst + 1, sizeof(double));
+            break;
+
+        case LITERAL_INT:
+            pi->op = PUSH_CONST;
+            memcpy(&itop, pinst + 1, sizeof(epicsInt32));
+            pi->value = itop;
+            break;
+
+        case CONST_PI:
+            pi->op = PUSH_CONST;
+            pi->value = PI;
+            break;
+
+        case CONST_D2R:
+            pi->op = PUSH_CONST;
+            pi->value = PI/180.;
+            break;
+
+        case CONST_R2D:
+            pi->op = PUSH_CONST;
+            pi->value = 180./PI;
+            break;
+
+        case FETCH_A:
+        case FETCH_B:
+        case FETCH_C:
+        case FETCH_D:
+        case FETCH_E:
+        case FETCH_F:
+        case FETCH_G:
+        case FETCH_H:
+        case FETCH_I:
+        case FETCH_J:
+        case FETCH_K:
+        case FETCH_L:
+            pi->op = PUSH_ARG;
+            pi->arg = op - FETCH_A;
+            break;
+
+        case STORE_A:
+        case STORE_B:
+        case STORE_C:
+        case STORE_D:
+        case STORE_E:
+        case STORE_F:
+        case STORE_G:
+        case STORE_H:
+        case STORE_I:
+        case STORE_J:
+        case STORE_K:
+        case STORE_L:
+            pi->op = STORE_ARG;
+            pi->arg = op - STORE_A;
+            break;
+
+        case MIN:
+        case MAX:
+        case FINITE:
+        case ISNAN:
+            pi->op = op;
+            pi->arg = pinst[1];
+            break;
+
+        /* The jump field holds the postfix offset until fixed up below */
+        case COND_IF:
+            ptarget = pinst + 1;
+            pi->op = JUMP_IF_ZERO;
+            pi->jump = cond_search(&ptarget, COND_ELSE) ?
+                -1 : ptarget - ppostfix;
+            break;
+
+        case COND_ELSE:
+            ptarget = pinst + 1;
+            pi->op = JUMP;
+            pi->jump = cond_search(&ptarget, COND_END) ?
+                -1 : ptarget - ppostfix;
+            break;
+
+        case COND_END:
+            continue;
+
+        default:
+            pi->op = op;
+            break;
+        }
+
+        /* A push followed by a binary operator becomes one instruction.
+         * The operator can't be a jump target, which always follow a
+         * COND_ELSE or COND_END.
+         */
+        if ((pi->op == PUSH_ARG || pi->op == PUSH_CONST) &&
+            (fused = fuseOp(ppostfix[n], pi->op))) {
+            pi->op = fused;
+            index[n] = pi - pcomp->inst;
+            n++;
+        }
+        pi++;
+    }
+    pcomp->ninst = pi - pcomp->inst;
+
+    /* Resolve the jumps */
+    for (pi = pcomp->inst; pi < pcomp->inst + pcomp->ninst; pi++) {
+        if (pi->op != JUMP_IF_ZERO && pi->op != JUMP)
+            continue;
+        if (pi->jump < 0) {
+            pi->jump = pcomp->ninst;
+            needFail = 1;
+        }
+        else
+            pi->jump = index[pi->jump];
+    }
+    if (needFail)
+        pcomp->inst[pcomp->ninst++].op = FAIL;
+    pcomp->block = blockCheck(pcomp);
+    free(index);
+    return pcomp;
+}
+
+LIBCOM_API void
+    calcCompiledFree(calcCompiled *pcomp)
+{
+    free(pcomp);
+}
+
+/* calcCompiledPerform
+ *
+ * Evaluate a compiled expression
+ */
+LIBCOM_API long
+    calcCompiledPerform(const calcCompiled *pcomp, double *parg,
+        double *presult)
+{
+    double stack[CALCPERFORM_STACK+1];  /* zero'th entry not used */
+    double *ptop;                       /* stack pointer */
+    double top;                         /* value from top of stack */
+    epicsInt32 itop;                    /* integer from top of stack */
+    const calcInst *pi = pcomp->inst;
+    int nargs;
+
+    /* initialize */
+    ptop = stack;
+
+    /* evaluation loop */
+    for (;; pi++) {
+        switch (pi->op) {
+
+        case END_EXPRESSION:
+            /* The stack should now have one item on it, the expression value */
+            if (ptop != stack + 1)
+                return -1;
+            *presult = *ptop;
+            return 0;
+
+        case PUSH_CONST:
+            *++ptop = pi->value;
+            break;
+
+        case PUSH_ARG:
+            *++ptop = parg[pi->arg];
+            break;
+
+        case FETCH_VAL:
+            *++ptop = *presult;
+            break;
+
+        case STORE_ARG:
+            parg[pi->arg] = *ptop--;
+            break;
+
+        case JUMP_IF_ZERO:
+            if (*ptop-- == 0.0)
+                pi = pcomp->inst + pi->jump - 1;
+            break;
+
+        case JUMP:
+            pi = pcomp->inst + pi->jump - 1;
+            break;
+
+        case FAIL:
+            return -1;
+
+        case ADD_ARG:           *ptop += parg[pi->arg]; break;
+        case SUB_ARG:           *ptop -= parg[pi->arg]; break;
+        case MULT_ARG:          *ptop *= parg[pi->arg]; break;
+        case DIV_ARG:           *ptop /= parg[pi->arg]; break;
+        case NOT_EQ_ARG:        *ptop = *ptop != parg[pi->arg]; break;
+        case LESS_THAN_ARG:     *ptop = *ptop <  parg[pi->arg]; break;
+        case LESS_OR_EQ_ARG:    *ptop = *ptop <= parg[pi->arg]; break;
+        case EQUAL_ARG:         *ptop = *ptop == parg[pi->arg]; break;
+        case GR_OR_EQ_ARG:      *ptop = *ptop >= parg[pi->arg]; break;
+        case GR_THAN_ARG:       *ptop = *ptop >  parg[pi->arg]; break;
+
+        case ADD_CONST:         *ptop += pi->value; break;
+        case SUB_CONST:         *ptop -= pi->value; break;
+        case MULT_CONST:        *ptop *= pi->value; break;
+        case DIV_CONST:         *ptop /= pi->value; break;
+        case NOT_EQ_CONST:      *ptop = *ptop != pi->value; break;
+        case LESS_THAN_CONST:   *ptop = *ptop <  pi->value; break;
+        case LESS_OR_EQ_CONST:  *ptop = *ptop <= pi->value; break;
+        case EQUAL_CONST:       *ptop = *ptop == pi->value; break;
+        case GR_OR_EQ_CONST:    *ptop = *ptop >= pi->value; break;
+        case GR_THAN_CONST:     *ptop = *ptop >  pi->value; break;
+
+        /* The rest are as in calcPerform() */
+
+        case UNARY_NEG:
+            *ptop = - *ptop;
+            break;
+
+        case ADD:
+            top = *ptop--;
+            *ptop += top;
+            break;
+
+        case SUB:
+            top = *ptop--;
+            *ptop -= top;
+            break;
+
+        case MULT:
+            top = *ptop--;
+            *ptop *= top;
+            break;
+
+        case DIV:
+            top = *ptop--;
+            *ptop /= top;
+            break;
+
+        case MODULO:
+            itop = (epicsInt32) *ptop--;
+            if (itop)
+                *ptop = (epicsInt32) *ptop % itop;
+            else
+                *ptop = epicsNAN;
+            break;
+
+        case POWER:
+            top = *ptop--;
+            *ptop = pow(*ptop, top);
+            break;
+
+        case ABS_VAL:
+            *ptop = fabs(*ptop);
+            break;
+
+        case EXP:
+            *ptop = exp(*ptop);
+            break;
+
+        case LOG_10:
+            *ptop = log10(*ptop);
+            break;
+
+        case LOG_E:
+            *ptop = log(*ptop);
+            break;
+
+        case MAX:
+            nargs = pi->arg;
+            while (--nargs) {
+                top = *ptop--;
+                if (*ptop < top || isnan(top))
+                    *ptop = top;
+            }
+            break;
+
+        case MIN:
+            nargs = pi->arg;
+            while (--nargs) {
+                top = *ptop--;
+                if (*ptop > top || isnan(top))
+                    *ptop = top;
+            }
+            break;
+
+        case SQU_RT:
+            *ptop = sqrt(*ptop);
+            break;
+
+        case ACOS:
+            *ptop = acos(*ptop);
+            break;
+
+        case ASIN:
+            *ptop = asin(*ptop);
+            break;
+
+        case ATAN:
+            *ptop = atan(*ptop);
+            break;
+
+        case ATAN2:
+            top = *ptop--;
+            *ptop = atan2(top, *ptop);  /* Ouch!: Args backwards! */
+            break;
+
+        case COS:
+            *ptop = cos(*ptop);
+            break;
+
+        case SIN:
+            *ptop = sin(*ptop);
+            break;
+
+        case TAN:
+            *ptop = tan(*ptop);
+            break;
+
+        case COSH:
+            *ptop = cosh(*ptop);
+            break;
+
+        case SINH:
+            *ptop = sinh(*ptop);
+            break;
+
+        case TANH:
+            *ptop = tanh(*ptop);
+            break;
+
+        case CEIL:
+            *ptop = ceil(*ptop);
+            break;
+
+        case FLOOR:
+            *ptop = floor(*ptop);
+            break;
+
+        case FMOD:
+            top = *ptop--;
+            *ptop = fmod(*ptop, top);
+            break;
+
+        case FINITE:
+            nargs = pi->arg;
+            top = finite(*ptop);
+            while (--nargs) {
+                --ptop;
+                top = top && finite(*ptop);
+            }
+            *ptop = top;
+            break;
+
+        case ISINF:
+            *ptop = isinf(*ptop);
+            break;
+
+        case ISNAN:
+            nargs = pi->arg;
+            top = isnan(*ptop);
+            while (--nargs) {
+                --ptop;
+                top = top || isnan(*ptop);
+            }
+            *ptop = top;
+            break;
+
+        case NINT:
+            top = *ptop;
+            *ptop = (epicsInt32) (top >= 0 ? top + 0.5 : top - 0.5);
+            break;
+
+        case RANDOM:
+            *++ptop = calcRandom();
+            break;
+
+        case REL_OR:
+            top = *ptop--;
+            *ptop = *ptop || top;
+            break;
+
+        case REL_AND:
+            top = *ptop--;
+            *ptop = *ptop && top;
+            break;
+
+        case REL_NOT:
+            *ptop = ! *ptop;
+            break;
+
+        case BIT_OR:
+            top = *ptop--;
+            *ptop = (double)(d2i(*ptop) | d2i(top));
+            break;
+
+        case BIT_AND:
+            top = *ptop--;
+            *ptop = (double)(d2i(*ptop) & d2i(top));
+            break;
+
+        case BIT_EXCL_OR:
+            top = *ptop--;
+            *ptop = (double)(d2i(*ptop) ^ d2i(top));
+            break;
+
+        case BIT_NOT:
+            *ptop = (double)~d2i(*ptop);
+            break;
+
+        case RIGHT_SHIFT_ARITH:
+            top = *ptop--;
+            *ptop = (double)(d2i(*ptop) >> (d2i(top) & 31));
+            break;
+
+        case LEFT_SHIFT_ARITH:
+            top = *ptop--;
+            *ptop = (double)(d2i(*ptop) << (d2i(top) & 31));
+            break;
+
+        case RIGHT_SHIFT_LOGIC:
+            top = *ptop--;
+            *ptop = (double)(d2ui(*ptop) >> (d2ui(top) & 31u));
+            break;
+
+        case NOT_EQ:
+            top = *ptop--;
+            *ptop = *ptop != top;
+            break;
+
+        case LESS_THAN:
+            top = *ptop--;
+            *ptop = *ptop < top;
+            break;
+
+        case LESS_OR_EQ:
+            top = *ptop--;
+            *ptop = *ptop <= top;
+            break;
+
+        case EQUAL:
+            top = *ptop--;
+            *ptop = *ptop == top;
+            break;
+
+        case GR_OR_EQ:
+            top = *ptop--;
+            *ptop = *ptop >= top;
+            break;
+
+        case GR_THAN:
+            top = *ptop--;
+            *ptop = *ptop > top;
+            break;
+
+        default:
+            errlogPrintf("calcCompiledPerform: Bad Opcode %d at %p\n",
+                pi->op, pi);
+            return -1;
+        }
+    }
+}
+
 #if defined(_WIN32) && defined(_M_X64) && !defined(_MINGW)
 #  pragma optimize("", on)
 #endif
 
+/* The loops below are kept simple so they get vectorized */
+#define BLOCK_LOOP(expr) \
+    for (j = 0; j < n; j++) { \
+        double x = px[j]; \
+        pout[j] = (expr); \
+    }
+
+#define BLOCK_LOOP2(expr) \
+    for (j = 0; j < n; j++) { \
+        double x = px[j], y = py[j]; \
+        pout[j] = (expr); \
+    }
+
+static void blockUnary(int op, const double *px, double *pout, unsigned n)
+{
+    unsigned j;
+
+    switch (op) {
+    case UNARY_NEG: BLOCK_LOOP(- x); break;
+    case ABS_VAL:   BLOCK_LOOP(fabs(x)); break;
+    case EXP:       BLOCK_LOOP(exp(x)); break;
+    case LOG_10:    BLOCK_LOOP(log10(x)); break;
+    case LOG_E:     BLOCK_LOOP(log(x)); break;
+    case SQU_RT:    BLOCK_LOOP(sqrt(x)); break;
+    case ACOS:      BLOCK_LOOP(acos(x)); break;
+    case ASIN:      BLOCK_LOOP(asin(x)); break;
+    case ATAN:      BLOCK_LOOP(atan(x)); break;
+    case COS:       BLOCK_LOOP(cos(x)); break;
+    case SIN:       BLOCK_LOOP(sin(x)); break;
+    case TAN:       BLOCK_LOOP(tan(x)); break;
+    case COSH:      BLOCK_LOOP(cosh(x)); break;
+    case SINH:      BLOCK_LOOP(sinh(x)); break;
+    case TANH:      BLOCK_LOOP(tanh(x)); break;
+    case CEIL:      BLOCK_LOOP(ceil(x)); break;
+    case FLOOR:     BLOCK_LOOP(floor(x)); break;
+    case ISINF:     BLOCK_LOOP(isinf(x)); break;
+    case NINT:      BLOCK_LOOP((epicsInt32) (x >= 0 ? x + 0.5 : x - 0.5));
+                    break;
+    case REL_NOT:   BLOCK_LOOP(! x); break;
+    }
+}
+
+static void blockBinary(int op, const double *px, const double *py,
+    double *pout, unsigned n)
+{
+    unsigned j;
+
+    switch (op) {
+    case ADD:           BLOCK_LOOP2(x + y); break;
+    case SUB:           BLOCK_LOOP2(x - y); break;
+    case MULT:          BLOCK_LOOP2(x * y); break;
+    case DIV:           BLOCK_LOOP2(x / y); break;
+    case POWER:         BLOCK_LOOP2(pow(x, y)); break;
+    case ATAN2:         BLOCK_LOOP2(atan2(y, x)); break;
+    case FMOD:          BLOCK_LOOP2(fmod(x, y)); break;
+    case REL_OR:        BLOCK_LOOP2(x || y); break;
+    case REL_AND:       BLOCK_LOOP2(x && y); break;
+    case NOT_EQ:        BLOCK_LOOP2(x != y); break;
+    case LESS_THAN:     BLOCK_LOOP2(x <  y); break;
+    case LESS_OR_EQ:    BLOCK_LOOP2(x <= y); break;
+    case EQUAL:         BLOCK_LOOP2(x == y); break;
+    case GR_OR_EQ:      BLOCK_LOOP2(x >= y); break;
+    case GR_THAN:       BLOCK_LOOP2(x >  y); break;
+    case MAX:           BLOCK_LOOP2(x < y || isnan(y) ? y : x); break;
+    case MIN:           BLOCK_LOOP2(x > y || isnan(y) ? y : x); break;
+    }
+}
+
+/* Values of the operand of a push or fused instruction, filling buf with
+ * the value if it's the same for all elements
+ */
+static const double * blockOperand(const calcInst *pi, const double *parg,
+    const double *const *parray, double *presult, unsigned long offset,
+    double *buf, unsigned n)
+{
+    double value;
+    unsigned j;
+
+    if (pi->op == FETCH_VAL)
+        return presult + offset;
+    if (pi->op == PUSH_ARG || (pi->op >= ADD_ARG && pi->op < ADD_CONST)) {
+        if (parray && parray[pi->arg])
+            return parray[pi->arg] + offset;
+        value = parg[pi->arg];
+    }
+    else
+        value = pi->value;
+
+    for (j = 0; j < n; j++)
+        buf[j] = value;
+    return buf;
+}
+
+/* Evaluate an expression for n elements starting at offset */
+static void blockPerform(const calcCompiled *pcomp, const double *parg,
+    const double *const *parray, double *presult, unsigned long offset,
+    unsigned n)
+{
+    double stack[CALC_BLOCK_DEPTH][CALC_BLOCK_SIZE];
+    double operand[CALC_BLOCK_SIZE];
+    const double *ptop[CALC_BLOCK_DEPTH];  /* values of each stack entry */
+    const calcInst *pi;
+    int sp = -1;
+    int nargs;
+    unsigned j;
+
+    for (pi = pcomp->inst; pi->op != END_EXPRESSION; pi++) {
+        switch (blockKind(pi->op)) {
+        case BLOCK_PUSH:
+            sp++;
+            ptop[sp] = blockOperand(pi, parg, parray, presult, offset,
+                stack[sp], n);
+            break;
+
+        case BLOCK_FUSED:
+            blockBinary(fusable[(pi->op - ADD_ARG) % NELEMENTS(fusable)],
+                ptop[sp], blockOperand(pi, parg, parray, presult, offset,
+                    operand, n), stack[sp], n);
+            ptop[sp] = stack[sp];
+            break;
+
+        case BLOCK_UNARY:
+            blockUnary(pi->op, ptop[sp], stack[sp], n);
+            ptop[sp] = stack[sp];
+            break;
+
+        case BLOCK_BINARY:
+            sp--;
+            blockBinary(pi->op, ptop[sp], ptop[sp + 1], stack[sp], n);
+            ptop[sp] = stack[sp];
+            break;
+
+        case BLOCK_NARY:
+            nargs = pi->arg;
+            while (--nargs) {
+                sp--;
+                blockBinary(pi->op, ptop[sp], ptop[sp + 1], stack[sp], n);
+                ptop[sp] = stack[sp];
+            }
+            break;
+        }
+    }
+
+    if (ptop[0] != presult + offset) {
+        for (j = 0; j < n; j++)
+            presult[offset + j] = ptop[0][j];
+    }
+}
+
+/* calcCompiledPerformArray
+ *
+ * Evaluate a compiled expression for each element of its array arguments
+ */
+LIBCOM_API long
+    calcCompiledPerformArray(const calcCompiled *pcomp, const double *parg,
+        const double *const *parray, double *presult, unsigned long nelements)
+{
+    double args[CALCPERFORM_NARGS];
+    unsigned long i;
+    int k;
+
+    if (pcomp->block) {
+        for (i = 0; i < nelements; i += CALC_BLOCK_SIZE) {
+            unsigned n = nelements - i < CALC_BLOCK_SIZE ?
+                nelements - i : CALC_BLOCK_SIZE;
+
+            blockPerform(pcomp, parg, parray, presult, i, n);
+        }
+        return 0;
+    }
+
+    for (i = 0; i < nelements; i++) {
+        for (k = 0; k < CALCPERFORM_NARGS; k++)
+            args[k] = parray && parray[k] ? parray[k][i] : parg[k];
+        if (calcCompiledPerform(pcomp, args, &presult[i]))
+            return -1;
+    }
+    return 0;
+}
+
 LIBCOM_API long
 calcArgUsage(const char *pinst, unsigned long *pinputs, unsigned long *pstores)
 {
@@ -0,0 +1,104 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* for recvmmsg() and sendmmsg() */
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+#endif
+
+#include <string.h>
+
+#include "osiSock.h"
+
+/* mmsghdr arrays are on the stack, larger requests are done in chunks */
+#define BATCH_MAX 64
+
+/*
+ * epicsSocketRecvMany ()
+ * See https://man7.org/linux/man-pages/man2/recvmmsg.2.html
+ */
+int epicsStdCall epicsSocketRecvMany (
+    SOCKET sock, epicsSocketDatagram *dgs, unsigned count )
+{
+    struct mmsghdr msgs[BATCH_MAX];
+    struct iovec iovs[BATCH_MAX];
+    unsigned i;
+    int status;
+
+    if ( count > BATCH_MAX ) {
+        count = BATCH_MAX;
+    }
+    memset ( msgs, 0, count * sizeof ( msgs[0] ) );
+    for ( i = 0u; i < count; i++ ) {
+        iovs[i].iov_base = dgs[i].buf;
+        iovs[i].iov_len = dgs[i].bufSize;
+        msgs[i].msg_hdr.msg_name = & dgs[i].addr;
+        msgs[i].msg_hdr.msg_namelen = sizeof ( dgs[i].addr );
+        msgs[i].msg_hdr.msg_iov = & iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    /* wait for the first, take the rest only if already queued */
+    status = recvmmsg ( sock, msgs, count, MSG_WAITFORONE, NULL );
+    if ( status < 0 ) {
+        return -1;
+    }
+    for ( i = 0u; i < ( unsigned ) status; i++ ) {
+        dgs[i].len = msgs[i].msg_len;
+        dgs[i].truncated = ( msgs[i].msg_hdr.msg_flags & MSG_TRUNC ) != 0;
+    }
+    return status;
+}
+
+/*
+ * epicsSocketSendMany ()
+ * See https://man7.org/linux/man-pages/man2/sendmmsg.2.html
+ */
+int epicsStdCall epicsSocketSendMany (
+    SOCKET sock, const epicsSocketDatagram *dgs, unsigned count )
+{
+    unsigned sent = 0u;
+
+    while ( sent < count ) {
+        struct mmsghdr msgs[BATCH_MAX];
+        struct iovec iovs[BATCH_MAX];
+        unsigned i, n = count - sent;
+        int status;
+
+        if ( n > BATCH_MAX ) {
+            n = BATCH_MAX;
+        }
+        memset ( msgs, 0, n * sizeof ( msgs[0] ) );
+        for ( i = 0u; i < n; i++ ) {
+            const epicsSocketDatagram *pdg = & dgs[sent + i];
+
+            iovs[i].iov_base = pdg->buf;
+            iovs[i].iov_len = pdg->len;
+            msgs[i].msg_hdr.msg_name = ( void * ) & pdg->addr;
+            msgs[i].msg_hdr.msg_namelen = sizeof ( pdg->addr );
+            msgs[i].msg_hdr.msg_iov = & iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        status = sendmmsg ( sock, msgs, n, 0 );
+        if ( status < 0 ) {
+            return sent ? ( int ) sent : -1;
+        }
+        sent += ( unsigned ) status;
+        if ( ( unsigned ) status < n ) {
+            break;
+        }
+    }
+    return ( int ) sent;
+}
+
+/*
+ * epicsSocketRecvManyMax ()
+ */
+unsigned epicsStdCall epicsSocketRecvManyMax ( void )
+{
+    return BATCH_MAX;
+}
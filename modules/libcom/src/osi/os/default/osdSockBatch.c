@@ -0,0 +1,56 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include "osiSock.h"
+
+/*
+ * epicsSocketRecvMany ()
+ * One datagram per call where there's no batched receive.
+ */
+int epicsStdCall epicsSocketRecvMany (
+    SOCKET sock, epicsSocketDatagram *dgs, unsigned count )
+{
+    osiSocklen_t addrSize = sizeof ( dgs[0].addr );
+    int status;
+
+    if ( count == 0u ) {
+        return 0;
+    }
+    status = recvfrom ( sock, dgs[0].buf, dgs[0].bufSize, 0,
+        & dgs[0].addr.sa, & addrSize );
+    if ( status < 0 ) {
+        return -1;
+    }
+    dgs[0].len = ( unsigned ) status;
+    dgs[0].truncated = 0;
+    return 1;
+}
+
+/*
+ * epicsSocketSendMany ()
+ */
+int epicsStdCall epicsSocketSendMany (
+    SOCKET sock, const epicsSocketDatagram *dgs, unsigned count )
+{
+    unsigned i;
+
+    for ( i = 0u; i < count; i++ ) {
+        int status = sendto ( sock, dgs[i].buf, dgs[i].len, 0,
+            & dgs[i].addr.sa, sizeof ( dgs[i].addr ) );
+        if ( status < 0 ) {
+            return i ? ( int ) i : -1;
+        }
+    }
+    return ( int ) count;
+}
+
+/*
+ * epicsSocketRecvManyMax ()
+ */
+unsigned epicsStdCall epicsSocketRecvManyMax ( void )
+{
+    return 1u;
+}
@@ -409,6 +409,63 @@ LIBCOM_API void epicsStdCall osiSockDiscoverBroadcastAddresses
  */
 LIBCOM_API osiSockAddr epicsStdCall osiLocalAddr (SOCKET socket);
 
+/*!
+ * \brief One datagram for epicsSocketRecvMany() or epicsSocketSendMany()
+ */
+typedef struct epicsSocketDatagram {
+    //! Data buffer
+    void *buf;
+    //! Size of \p buf when receiving
+    unsigned bufSize;
+    //! Number of bytes received, or to be sent
+    unsigned len;
+    //! Source address of a received datagram, or destination when sending
+    osiSockAddr addr;
+    //! Set when a received datagram was longer than \p bufSize
+    int truncated;
+} epicsSocketDatagram;
+
+/*!
+ * \brief Receive several datagrams with one call where possible
+ *
+ * Blocks until at least one datagram has arrived on \p sock, then also
+ * takes up to \p count - 1 more which are already queued without waiting
+ * for any others.  On Linux this uses recvmmsg(), elsewhere it receives
+ * one datagram per call.
+ *
+ * \param sock A datagram socket
+ * \param dgs Array of \p count descriptors, with \p buf and \p bufSize set
+ * \param count Number of descriptors
+ * \return The number of datagrams received, or -1 on error with SOCKERRNO set.
+ */
+LIBCOM_API int epicsStdCall epicsSocketRecvMany (
+    SOCKET sock, epicsSocketDatagram *dgs, unsigned count );
+
+/*!
+ * \brief Send several datagrams with one call where possible
+ *
+ * Sends each of \p count datagrams to its own destination address.  On
+ * Linux this uses sendmmsg(), elsewhere sendto() for each datagram.
+ *
+ * \param sock A datagram socket
+ * \param dgs Array of \p count descriptors, with \p buf \p len and \p addr set
+ * \param count Number of descriptors
+ * \return The number of datagrams sent, which is less than \p count if
+ * one could not be sent, or -1 on error with SOCKERRNO set when none were sent.
+ */
+LIBCOM_API int epicsStdCall epicsSocketSendMany (
+    SOCKET sock, const epicsSocketDatagram *dgs, unsigned count );
+
+/*!
+ * \brief The most datagrams epicsSocketRecvMany() takes with one call
+ *
+ * Callers can use this to avoid allocating buffers for datagrams which
+ * would never be received in a batch.
+ *
+ * \return 1 on targets which receive one datagram per call.
+ */
+LIBCOM_API unsigned epicsStdCall epicsSocketRecvManyMax ( void );
+
 #ifdef __cplusplus
 }
 #endif
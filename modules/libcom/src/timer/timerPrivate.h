@@ -17,11 +17,13 @@
 #define epicsTimerPrivate_h
 
 #include <typeinfo>
+#include <vector>
 
 #include "tsFreeList.h"
 #include "epicsSingleton.h"
 #include "tsDLList.h"
 #include "epicsTimer.h"
+#include "epicsTypes.h"
 #include "compilerDependencies.h"
 
 #if __cplusplus<201103L
@@ -37,7 +39,7 @@
 
 template < class T > class epicsGuard;
 
-class timer : public epicsTimer, public tsDLNode < timer > {
+class timer : public epicsTimer {
 public:
     void destroy () override;
     void start ( class epicsTimerNotify &, const epicsTime & ) override final;
@@ -54,6 +56,8 @@ protected:
 private:
     enum state { statePending = 45, stateActive = 56, stateLimbo = 78 };
     epicsTime exp; // expiration time
+    epicsUInt64 seq; // orders timers with the same expiration time
+    unsigned heapIndex; // position in the queue's heap while pending
     state curState; // current state
     epicsTimerNotify * pNotify; // callback
     void privateStart ( epicsTimerNotify & notify, const epicsTime & );
@@ -104,7 +108,12 @@ private:
     tsFreeList < epicsTimerForC, 0x20 > timerForCFreeList;
     mutable epicsMutex mutex;
     epicsEvent cancelBlockingEvent;
-    tsDLList < timer > timerList;
+    // Pending timers, in a 4-ary min-heap ordered on expiration time and
+    // then on start order.  Room is reserved for every timer created on
+    // the queue so that starting a timer never allocates.
+    std::vector < timer * > heap;
+    unsigned nTimers;
+    epicsUInt64 nextSeq;
     epicsTimerQueueNotify & notify;
     timer * pExpireTmr;
     epicsThreadId processThread;
@@ -113,6 +122,14 @@ private:
     static const double exceptMsgMinPeriod;
     void printExceptMsg ( const char * pName,
                 const type_info & type );
+    timer * first () const;
+    static bool expiresBefore ( const timer *, const timer * );
+    void heapInsert ( timer & );
+    void heapRemove ( timer & );
+    void heapSiftUp ( unsigned index );
+    void heapSiftDown ( unsigned index );
+    void addTimer ();
+    void removeTimer ();
     timerQueue ( const timerQueue & );
     timerQueue & operator = ( const timerQueue & );
     friend class timer;
@@ -236,6 +253,11 @@ inline bool timerQueueActive::sharingOK () const
     return this->okToShare;
 }
 
+inline timer * timerQueue::first () const
+{
+    return this->heap.empty () ? 0 : this->heap.front ();
+}
+
 inline unsigned timerQueueActive::threadPriority () const
 {
     return thread.getPriority ();
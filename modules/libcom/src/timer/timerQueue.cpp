@@ -26,6 +26,8 @@ epicsTimerQueue::~epicsTimerQueue () {}
 
 timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
     mutex(__FILE__, __LINE__),
+    nTimers ( 0u ),
+    nextSeq ( 0u ),
     notify ( notifyIn ),
     pExpireTmr ( 0 ),
     processThread ( 0 ),
@@ -37,10 +39,99 @@ timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
 
 timerQueue::~timerQueue ()
 {
-    timer *pTmr;
-    while ( ( pTmr = this->timerList.get () ) ) {
-        pTmr->curState = timer::stateLimbo;
+    for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+        this->heap[i]->curState = timer::stateLimbo;
     }
+    this->heap.clear ();
+}
+
+bool timerQueue::expiresBefore ( const timer * pA, const timer * pB )
+{
+    return pA->exp < pB->exp ||
+        ( ! ( pB->exp < pA->exp ) && pA->seq < pB->seq );
+}
+
+void timerQueue::heapSiftUp ( unsigned index )
+{
+    timer * pTmr = this->heap[index];
+    while ( index > 0u ) {
+        unsigned parent = ( index - 1u ) / 4u;
+        if ( ! expiresBefore ( pTmr, this->heap[parent] ) ) {
+            break;
+        }
+        this->heap[index] = this->heap[parent];
+        this->heap[index]->heapIndex = index;
+        index = parent;
+    }
+    this->heap[index] = pTmr;
+    pTmr->heapIndex = index;
+}
+
+void timerQueue::heapSiftDown ( unsigned index )
+{
+    const unsigned n = static_cast < unsigned > ( this->heap.size () );
+    timer * pTmr = this->heap[index];
+    while ( true ) {
+        unsigned child = 4u * index + 1u;
+        if ( child >= n ) {
+            break;
+        }
+        unsigned last = child + 4u < n ? child + 4u : n;
+        unsigned best = child;
+        for ( unsigned i = child + 1u; i < last; i++ ) {
+            if ( expiresBefore ( this->heap[i], this->heap[best] ) ) {
+                best = i;
+            }
+        }
+        if ( ! expiresBefore ( this->heap[best], pTmr ) ) {
+            break;
+        }
+        this->heap[index] = this->heap[best];
+        this->heap[index]->heapIndex = index;
+        index = best;
+    }
+    this->heap[index] = pTmr;
+    pTmr->heapIndex = index;
+}
+
+void timerQueue::heapInsert ( timer & tmr )
+{
+    // never reallocates, see addTimer ()
+    this->heap.push_back ( & tmr );
+    this->heapSiftUp ( static_cast < unsigned > ( this->heap.size () - 1u ) );
+}
+
+void timerQueue::heapRemove ( timer & tmr )
+{
+    unsigned index = tmr.heapIndex;
+    timer * pLast = this->heap.back ();
+    this->heap.pop_back ();
+    if ( pLast != & tmr ) {
+        this->heap[index] = pLast;
+        pLast->heapIndex = index;
+        if ( index > 0u &&
+                expiresBefore ( pLast, this->heap[ ( index - 1u ) / 4u ] ) ) {
+            this->heapSiftUp ( index );
+        }
+        else {
+            this->heapSiftDown ( index );
+        }
+    }
+}
+
+// Called with the lock held when a timer is created
+void timerQueue::addTimer ()
+{
+    if ( this->nTimers >= this->heap.capacity () ) {
+        this->heap.reserve ( this->nTimers < 16u ? 16u : 2u * this->nTimers );
+    }
+    this->nTimers++;
+}
+
+// Called with the lock held when a timer is destroyed
+void timerQueue::removeTimer ()
+{
+    this->nTimers--;
 }
 
 void timerQueue ::
@@ -83,7 +174,7 @@ double timerQueue::process ( const epicsTime & currentTime )
     if ( this->pExpireTmr ) {
         // if some other thread is processing the queue
         // (or if this is a recursive call)
-        timer * pTmr = this->timerList.first ();
+        timer * pTmr = this->first ();
         if ( pTmr ) {
             double delay = pTmr->exp - currentTime;
             if ( delay < 0.0 ) {
@@ -100,10 +191,10 @@ double timerQueue::process ( const epicsTime & currentTime )
     // Tag current expired tmr so that we can detect if call back
     // is in progress when canceling the timer.
     //
-    if ( this->timerList.first () ) {
-        if ( currentTime >= this->timerList.first ()->exp ) {
-            this->pExpireTmr = this->timerList.first ();
-            this->timerList.remove ( *this->pExpireTmr );
+    if ( this->first () ) {
+        if ( currentTime >= this->first ()->exp ) {
+            this->pExpireTmr = this->first ();
+            this->heapRemove ( *this->pExpireTmr );
             this->pExpireTmr->curState = timer::stateActive;
             this->processThread = epicsThreadGetIdSelf ();
 #           ifdef DEBUG
@@ -111,7 +202,7 @@ double timerQueue::process ( const epicsTime & currentTime )
 #           endif
         }
         else {
-            double delay = this->timerList.first ()->exp - currentTime;
+            double delay = this->first ()->exp - currentTime;
             debugPrintf ( ( "no activity process %f to next\n", delay ) );
             return delay;
         }
@@ -178,17 +269,17 @@ double timerQueue::process ( const epicsTime & currentTime )
         }
         this->pExpireTmr = 0;
 
-        if ( this->timerList.first () ) {
-            if ( currentTime >= this->timerList.first ()->exp ) {
-                this->pExpireTmr = this->timerList.first ();
-                this->timerList.remove ( *this->pExpireTmr );
+        if ( this->first () ) {
+            if ( currentTime >= this->first ()->exp ) {
+                this->pExpireTmr = this->first ();
+                this->heapRemove ( *this->pExpireTmr );
                 this->pExpireTmr->curState = timer::stateActive;
 #               ifdef DEBUG
                     this->pExpireTmr->show ( 0u );
 #               endif
             }
             else {
-                delay = this->timerList.first ()->exp - currentTime;
+                delay = this->first ()->exp - currentTime;
                 this->processThread = 0;
                 break;
             }
@@ -215,12 +306,12 @@ epicsTimerForC & timerQueue::createTimerForC ( epicsTimerCallback pCallback, voi
 void timerQueue::show ( unsigned level ) const
 {
     epicsGuard < epicsMutex > locker ( this->mutex );
-    printf ( "epicsTimerQueue with %u items pending\n", this->timerList.count () );
+    printf ( "epicsTimerQueue with %u items pending\n",
+        static_cast < unsigned > ( this->heap.size () ) );
     if ( level >= 1u ) {
-        tsDLIterConst < timer > iter = this->timerList.firstIter ();
-        while ( iter.valid () ) {
-            iter->show ( level - 1u );
-            ++iter;
+        // in heap order, not in order of expiration
+        for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+            this->heap[i]->show ( level - 1u );
         }
     }
 }
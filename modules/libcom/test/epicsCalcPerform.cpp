@@ -0,0 +1,156 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+// Compares the rates at which calcPerform() and calcCompiledPerform()
+// evaluate some expressions typical of calc and calcout records, then
+// times calcCompiledPerformArray() on some waveform-sized arrays.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "postfix.h"
+#include "epicsTime.h"
+#include "testMain.h"
+
+namespace {
+
+const char * const expressions[] = {
+    "A+B",
+    "(A+B)*C/2",
+    "A*1.8+32",
+    "A>B?C:D",
+    "A<0?0:A>100?100:A",
+    "MAX(A,B,C,D)",
+    "(A&0xff)>>4",
+    "SQRT(A*A+B*B)",
+    "C:=C+1;C>=10?0:C",
+    "A>=B&&C!=D||E<F",
+};
+
+const unsigned nIterations = 1000000;
+
+void initArgs ( double * args )
+{
+    for ( int i = 0; i < CALCPERFORM_NARGS; i++ )
+        args[i] = i + 1.5;
+}
+
+double measure ( const char * expr )
+{
+    char rpn[MAX_POSTFIX_SIZE];
+    double args[CALCPERFORM_NARGS];
+    double result = 0.0, cresult = 0.0;
+    calcCompiled * pcomp;
+    epicsTime beg;
+    double interpreted, compiled;
+    short err;
+    unsigned i;
+
+    if ( postfix ( expr, rpn, & err ) ) {
+        printf ( "%s: %s\n", expr, calcErrorStr ( err ) );
+        return 0.0;
+    }
+    pcomp = calcCompile ( rpn );
+    if ( ! pcomp ) {
+        printf ( "%s: calcCompile failed\n", expr );
+        return 0.0;
+    }
+
+    initArgs ( args );
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < nIterations; i++ ) {
+        calcPerform ( args, & result, rpn );
+    }
+    interpreted = nIterations / ( epicsTime::getMonotonic () - beg );
+
+    initArgs ( args );
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < nIterations; i++ ) {
+        calcCompiledPerform ( pcomp, args, & cresult );
+    }
+    compiled = nIterations / ( epicsTime::getMonotonic () - beg );
+
+    printf ( "%-20s %10.3g %10.3g %6.2f%s\n", expr,
+        interpreted, compiled, compiled / interpreted,
+        memcmp ( & result, & cresult, sizeof ( double ) ) ?
+            "  results differ!" : "" );
+
+    calcCompiledFree ( pcomp );
+    return compiled / interpreted;
+}
+
+const char * const arrayExpressions[] = {
+    "A*B+C",
+    "A>B",
+    "(A-B)*(A-B)",
+    "MAX(MIN(A,C),B)",
+    "VAL*0.9+A*0.1",
+    "A>B?A:B",
+};
+
+const unsigned nElements = 1000000;
+const unsigned nRepeats = 10;
+
+void measureArray ( const char * expr )
+{
+    char rpn[MAX_POSTFIX_SIZE];
+    double args[CALCPERFORM_NARGS];
+    std::vector < double > a ( nElements ), result ( nElements );
+    const double * arrays[CALCPERFORM_NARGS] = { 0 };
+    calcCompiled * pcomp;
+    epicsTime beg;
+    double elapsed;
+    short err;
+    unsigned i;
+
+    if ( postfix ( expr, rpn, & err ) ||
+            ! ( pcomp = calcCompile ( rpn ) ) ) {
+        printf ( "%s: can't compile\n", expr );
+        return;
+    }
+
+    initArgs ( args );
+    for ( i = 0; i < nElements; i++ ) {
+        a[i] = i * 1e-3;
+    }
+    arrays[0] = & a[0];
+
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < nRepeats; i++ ) {
+        calcCompiledPerformArray ( pcomp, args, arrays, & result[0],
+            nElements );
+    }
+    elapsed = ( epicsTime::getMonotonic () - beg ) / nRepeats;
+
+    printf ( "%-20s %10.3f ms %10.3g elements/sec\n", expr,
+        elapsed * 1e3, nElements / elapsed );
+
+    calcCompiledFree ( pcomp );
+}
+
+} // namespace
+
+MAIN ( epicsCalcPerform )
+{
+    const unsigned n = sizeof ( expressions ) / sizeof ( expressions[0] );
+    double speedup = 0.0;
+
+    printf ( "%-20s %10s %10s %6s\n", "Expression",
+        "calc/sec", "comp/sec", "ratio" );
+    for ( unsigned i = 0; i < n; i++ ) {
+        speedup += measure ( expressions[i] );
+    }
+    printf ( "Average ratio %.2f\n", speedup / n );
+
+    printf ( "\n%-20s %13s for %u elements\n", "Expression",
+        "time", nElements );
+    for ( unsigned i = 0; i < sizeof ( arrayExpressions ) /
+            sizeof ( arrayExpressions[0] ); i++ ) {
+        measureArray ( arrayExpressions[i] );
+    }
+    return 0;
+}
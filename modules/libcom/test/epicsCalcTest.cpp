@@ -44,6 +44,91 @@ double doCalc(const char *expr) {
     return result;
 }
 
+bool testCompiled(const char *rpn, long status, double result) {
+    /* Evaluate compiled expression, test against calcPerform() */
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    calcCompiled *pcomp = calcCompile(rpn);
+    long cstatus, astatus;
+    double cresult = 0.0;
+    cresult /= cresult;  /* Start as NaN */
+    double aresult = cresult;
+
+    if (!pcomp) {
+        testDiag("calcCompile: failed");
+        return false;
+    }
+    astatus = calcCompiledPerformArray(pcomp, args, NULL, &aresult, 1);
+    cstatus = calcCompiledPerform(pcomp, args, &cresult);
+    calcCompiledFree(pcomp);
+
+    if (cstatus != status || memcmp(&cresult, &result, sizeof(double))) {
+        testDiag("calcCompiledPerform returned %ld and %g, not %ld and %g",
+                 cstatus, cresult, status, result);
+        return false;
+    }
+    if (astatus != status || memcmp(&aresult, &result, sizeof(double))) {
+        testDiag("calcCompiledPerformArray returned %ld and %g, not %ld and %g",
+                 astatus, aresult, status, result);
+        return false;
+    }
+    return true;
+}
+
+void testArray(const char *expr) {
+    /* Evaluate expression over arrays, test against calcCompiledPerform() */
+    const unsigned long n = 150;    /* more than two blocks */
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    double a[n], c[n], val[n], result[n], expected[n];
+    const double *arrays[CALCPERFORM_NARGS] = {a, NULL, c};
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcCompiled *pcomp = NULL;
+    short err;
+    long status = -1;
+    bool pass = true;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        a[i] = i * 0.25 - 10.0;
+        c[i] = (i % 7) - 3.0;
+        val[i] = i;
+    }
+
+    if (!rpn || postfix(expr, rpn, &err) || !(pcomp = calcCompile(rpn))) {
+        testFail("calcCompile: failed for '%s'", expr);
+        free(rpn);
+        return;
+    }
+
+    for (i = 0; pass && i < n; i++) {
+        double eargs[CALCPERFORM_NARGS];
+
+        memcpy(eargs, args, sizeof(args));
+        eargs[0] = a[i];
+        eargs[2] = c[i];
+        expected[i] = val[i];
+        pass = !calcCompiledPerform(pcomp, eargs, &expected[i]);
+    }
+    if (pass) {
+        memcpy(result, val, sizeof(val));
+        status = calcCompiledPerformArray(pcomp, args, arrays, result, n);
+        pass = !status && !memcmp(result, expected, sizeof(result));
+    }
+    for (i = 0; !pass && i < n; i++) {
+        if (memcmp(&result[i], &expected[i], sizeof(double))) {
+            testDiag("Element %lu is %g, expected %g",
+                     i, result[i], expected[i]);
+            break;
+        }
+    }
+    testOk(pass, "%s over arrays", expr);
+    calcCompiledFree(pcomp);
+    free(rpn);
+}
+
 void testCalc(const char *expr, double expected) {
     /* Evaluate expression, test against expected result */
     bool pass = false;
@@ -52,6 +137,7 @@ void testCalc(const char *expr, double expected) {
     };
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
+    long status = -1;
     double result = 0.0;
     result /= result;  /* Start as NaN */
 
@@ -63,7 +149,7 @@ void testCalc(const char *expr, double expected) {
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
     } else
-        if (calcPerform(args, &result, rpn) && finite(result)) {
+        if ((status = calcPerform(args, &result, rpn)) && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
         }
 
@@ -74,6 +160,8 @@ void testCalc(const char *expr, double expected) {
     } else {
         pass = (result == expected);
     }
+    if (pass && !err)
+        pass = testCompiled(rpn, status, result);
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is %g, actually got %g", expected, result);
         calcExprDump(rpn);
@@ -90,6 +178,7 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
     epicsUInt32 uresult;
+    long status = -1;
     double result = 0.0;
     result /= result;  /* Start as NaN */
 
@@ -101,12 +190,14 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
     } else
-        if (calcPerform(args, &result, rpn) && finite(result)) {
+        if ((status = calcPerform(args, &result, rpn)) && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
         }
 
     uresult = (result < 0.0 ? (epicsUInt32)(epicsInt32)result : (epicsUInt32)result);
     pass = (uresult == expected);
+    if (pass && !err)
+        pass = testCompiled(rpn, status, result);
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is 0x%x (%u), actually got 0x%x (%u)",
                  expected, expected, uresult, uresult);
@@ -298,7 +389,7 @@ MAIN(epicsCalcTest)
     const double a=1.0, b=2.0, c=3.0, d=4.0, e=5.0, f=6.0,
                  g=7.0, h=8.0, i=9.0, j=10.0, k=11.0, l=12.0;
 
-    testPlan(637);
+    testPlan(651);
 
     /* LITERAL_OPERAND elements */
     testExpr(0);
@@ -1012,5 +1103,23 @@ MAIN(epicsCalcTest)
     testUInt32Calc("-1431655766.1 << 0.1", 0xaaaaaaaau);
     testUInt32Calc("2863311530.1 << 0.1", 0xaaaaaaaau);
 
+    // Element-wise evaluation, A and C are arrays
+    testArray("A");
+    testArray("VAL");
+    testArray("A*B+C");
+    testArray("(A-1)/(C+B)*2.5");
+    testArray("VAL*0.5+A*0.5");
+    testArray("A>0 && C#0 || !(A<B)");
+    testArray("MAX(A,C,-B)+MIN(A,VAL)");
+    testArray("ABS(A)+SQRT(ABS(C))-NINT(A)+FLOOR(A)*CEIL(C)");
+    testArray("A**2+ATAN2(A,C)+FMOD(A,B)+LOG(B)");
+    testArray("(((((((A+1)*(C+2))+3)*4)+5)*6)+7)*(A-(C-(A-(C-(A-(C-(A-C)))))))");
+    testArray("A>C ? A : C");
+    testArray("D:=A*2; D+C");
+    testArray("A%3 + (C|4) + (A>>1)");
+
+    // Bad opcodes are left for calcPerform() to report
+    testOk(calcCompile("\x7f") == NULL, "calcCompile rejects bad opcode");
+
     return testDone();
 }
@@ -0,0 +1,113 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+// Measures the rates at which timers can be started, restarted, canceled
+// and expired on one timer queue holding many of them, as in clients
+// with many channels each having their own watchdog timers.
+//
+// A passive queue is used so that only the queue itself is timed.
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "epicsTimer.h"
+#include "epicsTime.h"
+#include "testMain.h"
+
+namespace {
+
+class nullNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+class countNotify : public epicsTimerNotify {
+public:
+    countNotify () : count ( 0u ) {}
+    expireStatus expire ( const epicsTime & )
+    {
+        count++;
+        return expireStatus ( noRestart );
+    }
+    unsigned long count;
+};
+
+// delays far enough ahead that nothing expires until we say so
+double randomDelay ()
+{
+    return 1000.0 + 100.0 * rand () / ( RAND_MAX + 1.0 );
+}
+
+void report ( const char * what, unsigned n, const epicsTime & beg )
+{
+    double elapsed = epicsTime::getMonotonic () - beg;
+    printf ( "%8u timers, %-22s %10.0f per second\n",
+        n, what, n / elapsed );
+}
+
+void measure ( unsigned n )
+{
+    nullNotify queueNotify;
+    countNotify notify;
+    epicsTimerQueuePassive & queue =
+        epicsTimerQueuePassive::create ( queueNotify );
+    std::vector < epicsTimer * > timers ( n );
+    epicsTime beg;
+    unsigned i;
+
+    for ( i = 0; i < n; i++ ) {
+        timers[i] = & queue.createTimer ();
+    }
+
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < n; i++ ) {
+        timers[i]->start ( notify, 1000.0 + i * 1e-6 );
+    }
+    report ( "start, in order", n, beg );
+
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < n; i++ ) {
+        timers[i]->start ( notify, randomDelay () );
+    }
+    report ( "restart, random order", n, beg );
+
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < n; i++ ) {
+        timers[i]->cancel ();
+    }
+    report ( "cancel", n, beg );
+
+    beg = epicsTime::getMonotonic ();
+    for ( i = 0; i < n; i++ ) {
+        timers[i]->start ( notify, randomDelay () );
+    }
+    report ( "start, random order", n, beg );
+
+    beg = epicsTime::getMonotonic ();
+    queue.process ( epicsTime::getCurrent () + 2000.0 );
+    report ( "expire", n, beg );
+
+    if ( notify.count != n ) {
+        printf ( "Only %lu of %u timers expired\n", notify.count, n );
+    }
+
+    for ( i = 0; i < n; i++ ) {
+        timers[i]->destroy ();
+    }
+    delete & queue;
+}
+
+} // namespace
+
+MAIN ( epicsTimerPerform )
+{
+    measure ( 10000 );
+    measure ( 100000 );
+    measure ( 1000000 );
+    return 0;
+}
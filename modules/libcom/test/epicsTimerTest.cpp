@@ -452,9 +452,97 @@ void testPeriodic ()
     queue.release ();
 }
 
+//
+// Timers must expire in order of expiration time, and timers with the
+// same expiration time in the order they were started, however they
+// were started, restarted and canceled.
+//
+class orderNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+class orderVerify : public epicsTimerNotify {
+public:
+    orderVerify () : id ( 0u ), pLog ( 0 ), pNext ( 0 ) {}
+    unsigned id;
+    unsigned * pLog;
+    unsigned * pNext;
+    expireStatus expire ( const epicsTime & )
+    {
+        pLog[ (*pNext)++ ] = id;
+        return expireStatus ( noRestart );
+    }
+};
+
+void testOrder ()
+{
+    static const unsigned nTimers = 1000u;
+    orderNotify notify;
+    epicsTimerQueuePassive & queue = epicsTimerQueuePassive::create ( notify );
+    epicsTimer * pTimers[nTimers];
+    orderVerify verify[nTimers];
+    unsigned log[nTimers];
+    unsigned next = 0u, i;
+    epicsTime base = epicsTime::getCurrent ();
+
+    testDiag ( "verifying expiration order" );
+
+    for ( i = 0u; i < nTimers; i++ ) {
+        verify[i].id = i;
+        verify[i].pLog = log;
+        verify[i].pNext = & next;
+        pTimers[i] = & queue.createTimer ();
+    }
+    // ten groups of timers with the same time, started in a scrambled
+    // order and some started twice or canceled first
+    for ( i = 0u; i < nTimers; i++ ) {
+        unsigned j = ( i * 7919u ) % nTimers;
+        pTimers[j]->start ( verify[j], base + 10.0 + j % 10u );
+        if ( i % 3u == 0u ) {
+            pTimers[j]->cancel ();
+        }
+    }
+    for ( i = 0u; i < nTimers; i++ ) {
+        unsigned j = ( i * 7919u ) % nTimers;
+        if ( i % 3u == 0u ) {
+            pTimers[j]->start ( verify[j], base + 10.0 + j % 10u );
+        }
+    }
+    queue.process ( base + 100.0 );
+
+    testOk ( next == nTimers, "%u of %u timers expired", next, nTimers );
+    bool ordered = true;
+    for ( i = 1u; i < next; i++ ) {
+        unsigned a = log[i - 1u], b = log[i];
+        if ( a % 10u > b % 10u ) {
+            ordered = false;
+        }
+        else if ( a % 10u == b % 10u ) {
+            // started in the order of (n * 7919) % nTimers, restarted
+            // ones (n % 3 == 0) after all others
+            unsigned na = 0u, nb = 0u;
+            while ( ( na * 7919u ) % nTimers != a ) na++;
+            while ( ( nb * 7919u ) % nTimers != b ) nb++;
+            unsigned ra = na % 3u == 0u, rb = nb % 3u == 0u;
+            if ( ra > rb || ( ra == rb && na > nb ) ) {
+                ordered = false;
+            }
+        }
+    }
+    testOk ( ordered, "Timers expired in order" );
+
+    for ( i = 0u; i < nTimers; i++ ) {
+        pTimers[i]->destroy ();
+    }
+    delete & queue;
+}
+
 MAIN(epicsTimerTest)
 {
-    testPlan(41);
+    testPlan(43);
+    testOrder ();
     testRefCount();
     testAccuracy ();
     testCancel ();
@@ -119,6 +119,71 @@ int doBind(int expect, SOCKET S, unsigned* port)
     }
 }
 
+static
+void udpSockBatchTest(void)
+{
+    enum {ndgs = 40, batch = 16};
+    SOCKET rx, tx;
+    unsigned port = 0, i, nrecv = 0, nbatch = 0, nbad = 0;
+    epicsSocketDatagram dgs[ndgs];
+    char bufs[ndgs][32];
+    int ret;
+
+    testDiag("udpSockBatchTest()");
+
+    rx = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    tx = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    if(rx==INVALID_SOCKET || tx==INVALID_SOCKET)
+        testAbort("Unable to allocate sockets");
+
+    if(doBind(0, rx, &port)) {
+        testSkip(3, "No loopback port");
+        goto done;
+    }
+
+    memset(dgs, 0, sizeof(dgs));
+    for(i=0; i<ndgs; i++) {
+        dgs[i].buf = bufs[i];
+        dgs[i].len = 1 + i % sizeof(bufs[i]);
+        memset(bufs[i], (char)i, dgs[i].len);
+        dgs[i].addr.ia.sin_family = AF_INET;
+        dgs[i].addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        dgs[i].addr.ia.sin_port = htons(port);
+    }
+
+    ret = epicsSocketSendMany(tx, dgs, ndgs);
+    testOk(ret==ndgs, "epicsSocketSendMany() sent %d of %d", ret, ndgs);
+
+    memset(dgs, 0, sizeof(dgs));
+    for(i=0; i<ndgs; i++) {
+        dgs[i].buf = bufs[i];
+        dgs[i].bufSize = sizeof(bufs[i]);
+        bufs[i][0] = -1;
+    }
+    while(ret > 0 && nrecv < ndgs) {
+        unsigned n = ndgs - nrecv;
+        ret = epicsSocketRecvMany(rx, &dgs[nrecv], n < batch ? n : batch);
+        if(ret > 0) {
+            nrecv += ret;
+            nbatch++;
+        }
+    }
+    for(i=0; i<nrecv; i++) {
+        if(dgs[i].len != 1 + i % sizeof(bufs[i]) || dgs[i].truncated ||
+           bufs[i][0] != (char)i)
+            nbad++;
+    }
+    testOk(nrecv==ndgs && nbad==0,
+           "epicsSocketRecvMany() received %u of %d in %u calls, %u bad",
+           nrecv, ndgs, nbatch, nbad);
+    testOk(epicsSocketRecvManyMax() > 1u || nbatch == nrecv,
+           "epicsSocketRecvManyMax() %u", epicsSocketRecvManyMax());
+
+done:
+    epicsSocketDestroy(rx);
+    epicsSocketDestroy(tx);
+}
+
 static
 void tcpSockReuseBindTest(int reuse)
 {
@@ -411,12 +476,13 @@ void udpSockFanoutTest()
 MAIN(osiSockTest)
 {
     int status;
-    testPlan(24);
+    testPlan(28);
 
     status = osiSockAttach();
     testOk(status, "osiSockAttach");
 
     udpSockTest();
+    udpSockBatchTest();
     udpSockFanoutBindTest();
     udpSockFanoutTest();
     tcpSockReuseBindTest(0);